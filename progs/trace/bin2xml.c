@@ -0,0 +1,194 @@
+/*
+ * Copyright 2009 VMware, Inc.
+ * All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * on the rights to use, copy, modify, merge, publish, distribute, sub
+ * license, and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT.  IN NO EVENT SHALL
+ * VMWARE AND/OR THEIR SUPPLIERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Convert a binary trace to the XML format written by the trace driver,
+ * for viewing with trace.xsl or the python retrace tools.
+ *
+ *  bin2xml trace.bin > trace.xml
+ */
+
+#include <stdio.h>
+
+#include "trace_reader.h"
+
+
+static void
+write_escaped(FILE *out, const char *str)
+{
+   const unsigned char *p = (const unsigned char *)str;
+   unsigned char c;
+
+   /* must match trace_dump_escape() */
+   while ((c = *p++) != 0) {
+      if (c == '<')
+         fputs("&lt;", out);
+      else if (c == '>')
+         fputs("&gt;", out);
+      else if (c == '&')
+         fputs("&amp;", out);
+      else if (c == '\'')
+         fputs("&apos;", out);
+      else if (c == '\"')
+         fputs("&quot;", out);
+      else if (c >= 0x20 && c <= 0x7e)
+         putc(c, out);
+      else
+         fprintf(out, "&#%u;", c);
+   }
+}
+
+
+static void
+write_bytes(FILE *out, const uint8_t *data, size_t size)
+{
+   static const char hex_table[16] = "0123456789ABCDEF";
+   size_t i;
+
+   fputs("<bytes>", out);
+   for (i = 0; i < size; ++i) {
+      putc(hex_table[data[i] >> 4], out);
+      putc(hex_table[data[i] & 0xf], out);
+   }
+   fputs("</bytes>", out);
+}
+
+
+int main(int argc, char **argv)
+{
+   struct trace_reader *reader;
+   struct trace_token tok;
+   FILE *out = stdout;
+
+   if (argc != 2) {
+      fprintf(stderr, "usage: %s <binary trace>\n", argv[0]);
+      return 1;
+   }
+
+   reader = trace_reader_open(argv[1]);
+   if (!reader) {
+      fprintf(stderr, "%s: could not open %s\n", argv[0], argv[1]);
+      return 1;
+   }
+
+   fputs("<?xml version='1.0' encoding='UTF-8'?>\n", out);
+   fputs("<?xml-stylesheet type='text/xsl' href='trace.xsl'?>\n", out);
+   fputs("<trace version='0.1'>\n", out);
+
+   while (trace_reader_next(reader, &tok)) {
+      switch (tok.op) {
+      case TR_BIN_CALL_BEGIN:
+         fprintf(out, "\t<call no='%lu' class='", tok.call_no);
+         write_escaped(out, tok.name);
+         fputs("' method='", out);
+         write_escaped(out, tok.method);
+         fputs("'>\n", out);
+         break;
+      case TR_BIN_CALL_END:
+         fputs("\t</call>\n", out);
+         break;
+      case TR_BIN_ARG_BEGIN:
+         fputs("\t\t<arg name='", out);
+         write_escaped(out, tok.name);
+         fputs("'>", out);
+         break;
+      case TR_BIN_ARG_END:
+         fputs("</arg>\n", out);
+         break;
+      case TR_BIN_RET_BEGIN:
+         fputs("\t\t<ret>", out);
+         break;
+      case TR_BIN_RET_END:
+         fputs("</ret>\n", out);
+         break;
+      case TR_BIN_BOOL:
+         fprintf(out, "<bool>%c</bool>", tok.ival ? '1' : '0');
+         break;
+      case TR_BIN_INT:
+         fprintf(out, "<int>%lli</int>", tok.ival);
+         break;
+      case TR_BIN_UINT:
+         fprintf(out, "<uint>%llu</uint>", tok.uval);
+         break;
+      case TR_BIN_FLOAT:
+         fprintf(out, "<float>%g</float>", tok.fval);
+         break;
+      case TR_BIN_BYTES:
+      case TR_BIN_BLOB:
+         write_bytes(out, tok.data, tok.size);
+         break;
+      case TR_BIN_STRING:
+         fputs("<string>", out);
+         write_escaped(out, tok.data);
+         fputs("</string>", out);
+         break;
+      case TR_BIN_ENUM:
+         fputs("<enum>", out);
+         write_escaped(out, tok.name);
+         fputs("</enum>", out);
+         break;
+      case TR_BIN_ARRAY_BEGIN:
+         fputs("<array>", out);
+         break;
+      case TR_BIN_ARRAY_END:
+         fputs("</array>", out);
+         break;
+      case TR_BIN_ELEM_BEGIN:
+         fputs("<elem>", out);
+         break;
+      case TR_BIN_ELEM_END:
+         fputs("</elem>", out);
+         break;
+      case TR_BIN_STRUCT_BEGIN:
+         fprintf(out, "<struct name='%s'>", tok.name);
+         break;
+      case TR_BIN_STRUCT_END:
+         fputs("</struct>", out);
+         break;
+      case TR_BIN_MEMBER_BEGIN:
+         fprintf(out, "<member name='%s'>", tok.name);
+         break;
+      case TR_BIN_MEMBER_END:
+         fputs("</member>", out);
+         break;
+      case TR_BIN_NULL:
+         fputs("<null/>", out);
+         break;
+      case TR_BIN_PTR:
+         fprintf(out, "<ptr>0x%08lx</ptr>", (unsigned long)tok.uval);
+         break;
+      }
+   }
+
+   fputs("</trace>\n", out);
+
+   if (trace_reader_error(reader)) {
+      fprintf(stderr, "%s: error reading %s\n", argv[0], argv[1]);
+      trace_reader_close(reader);
+      return 1;
+   }
+
+   trace_reader_close(reader);
+   return 0;
+}
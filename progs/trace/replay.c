@@ -0,0 +1,2258 @@
+/*
+ * Copyright 2009 VMware, Inc.
+ * All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * on the rights to use, copy, modify, merge, publish, distribute, sub
+ * license, and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT.  IN NO EVENT SHALL
+ * VMWARE AND/OR THEIR SUPPLIERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Replay a binary trace on a software driver and report where the time
+ * went.
+ *
+ *  replay [-d driver] [-n loops] [-f] trace.bin
+ *
+ * The whole trace is parsed into memory before replaying, so the
+ * timings contain no parsing or I/O.  Only the driver calls themselves
+ * are timed per call; frame times are wall clock between
+ * PIPE_FLUSH_FRAME flushes (or flush_frontbuffer calls) and so include
+ * the small replay overhead too.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "pipe/internal/p_winsys_screen.h"
+#include "pipe/p_context.h"
+#include "pipe/p_format.h"
+#include "pipe/p_inlines.h"
+#include "pipe/p_screen.h"
+#include "pipe/p_state.h"
+#include "util/u_format.h"
+#include "util/u_hash_table.h"
+#include "util/u_math.h"
+#include "util/u_memory.h"
+#include "util/u_string.h"
+#include "util/u_time.h"
+#include "tgsi/tgsi_parse.h"
+#include "tgsi/tgsi_text.h"
+#include "softpipe/sp_winsys.h"
+#ifdef GALLIUM_LLVMPIPE
+#include "llvmpipe/lp_winsys.h"
+#endif
+
+#include "trace_reader.h"
+
+
+#define REPLAY_MAX_DEPTH 32
+#define REPLAY_MAX_TOKENS 8192
+#define REPLAY_POOL_BLOCK_SIZE (256*1024)
+
+
+/**
+ * An argument, return value, struct member or array element.
+ */
+struct value
+{
+   unsigned type;               /**< TR_BIN_x, 0 if empty */
+   const char *key;             /**< arg or member name */
+   const char *name;            /**< struct or enum name */
+
+   long long ival;
+   unsigned long long uval;
+   double fval;
+   const void *data;
+   size_t size;
+
+   struct value *first;         /**< members or elements */
+   struct value *last;
+   struct value *next;
+
+   void *cache;                 /**< translated shader tokens */
+};
+
+
+struct call
+{
+   unsigned long no;
+   const char *klass;
+   const char *method;
+   int handler;                 /**< index in handlers[], -1 if unknown */
+   struct value args;
+   struct value *ret;
+};
+
+
+struct call_stats
+{
+   unsigned long count;
+   int64_t nanos;
+};
+
+
+struct pool_block
+{
+   struct pool_block *next;
+   size_t used;
+   size_t size;
+};
+
+
+/**
+ * A driver the trace can be replayed on.
+ */
+struct replay_driver
+{
+   const char *name;
+   struct pipe_screen *(*create_screen)(void);
+   struct pipe_context *(*create_context)(struct pipe_screen *screen);
+};
+
+
+struct replay
+{
+   const struct replay_driver *driver;
+
+   struct trace_reader *reader;
+   struct pool_block *pool;
+
+   struct call *calls;
+   unsigned num_calls;
+   unsigned max_calls;
+
+   struct hash_table *objects;
+   unsigned long call_no;
+
+   struct call_stats *stats;
+   int64_t begin;
+   int64_t elapsed;
+
+   int64_t frame_start;
+   int64_t *frames;
+   unsigned num_frames;
+   unsigned max_frames;
+};
+
+
+static INLINE int64_t
+replay_nanos(void)
+{
+#if defined(PIPE_OS_LINUX) && defined(CLOCK_MONOTONIC)
+   struct timespec ts;
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+#else
+   return (int64_t)util_time_micros() * 1000;
+#endif
+}
+
+
+/*
+ * Timing of the driver calls.  Handlers bracket the driver entry points
+ * so that argument decoding is not counted.
+ */
+
+static INLINE void
+replay_begin(struct replay *r)
+{
+   r->begin = replay_nanos();
+}
+
+
+static INLINE void
+replay_end(struct replay *r)
+{
+   r->elapsed += replay_nanos() - r->begin;
+}
+
+
+static void
+replay_end_frame(struct replay *r)
+{
+   int64_t now = replay_nanos();
+
+   if (r->num_frames == r->max_frames) {
+      unsigned max = r->max_frames ? 2 * r->max_frames : 256;
+      r->frames = REALLOC(r->frames, r->max_frames * sizeof *r->frames,
+                          max * sizeof *r->frames);
+      if (!r->frames) {
+         r->num_frames = r->max_frames = 0;
+         return;
+      }
+      r->max_frames = max;
+   }
+
+   r->frames[r->num_frames++] = now - r->frame_start;
+   r->frame_start = now;
+}
+
+
+/*
+ * Memory for the parsed trace.  Nothing is freed before exit.
+ */
+
+static void *
+pool_alloc(struct replay *r, size_t size)
+{
+   struct pool_block *block = r->pool;
+   void *ptr;
+
+   size = align(size, 8);
+
+   if (!block || block->used + size > block->size) {
+      size_t block_size = MAX2(size, REPLAY_POOL_BLOCK_SIZE);
+      block = MALLOC(sizeof *block + block_size);
+      if (!block)
+         return NULL;
+      block->used = 0;
+      block->size = block_size;
+      block->next = r->pool;
+      r->pool = block;
+   }
+
+   ptr = (uint8_t *)(block + 1) + block->used;
+   block->used += size;
+   return ptr;
+}
+
+
+static void
+pool_destroy(struct replay *r)
+{
+   while (r->pool) {
+      struct pool_block *next = r->pool->next;
+      FREE(r->pool);
+      r->pool = next;
+   }
+}
+
+
+/*
+ * Loading.
+ */
+
+static struct value *
+value_new(struct replay *r)
+{
+   struct value *v = pool_alloc(r, sizeof *v);
+   if (v)
+      memset(v, 0, sizeof *v);
+   return v;
+}
+
+
+static void
+value_append(struct value *parent, struct value *v)
+{
+   if (parent->last)
+      parent->last->next = v;
+   else
+      parent->first = v;
+   parent->last = v;
+}
+
+
+static boolean
+value_set(struct replay *r, struct value *v, const struct trace_token *tok)
+{
+   v->type = tok->op;
+
+   switch (tok->op) {
+   case TR_BIN_STRUCT_BEGIN:
+   case TR_BIN_ENUM:
+      v->name = tok->name;
+      break;
+   case TR_BIN_BOOL:
+   case TR_BIN_INT:
+      v->ival = tok->ival;
+      v->uval = (unsigned long long)tok->ival;
+      v->fval = (double)tok->ival;
+      break;
+   case TR_BIN_UINT:
+   case TR_BIN_PTR:
+      v->uval = tok->uval;
+      v->ival = (long long)tok->uval;
+      v->fval = (double)tok->uval;
+      break;
+   case TR_BIN_FLOAT:
+      v->fval = tok->fval;
+      v->ival = (long long)tok->fval;
+      v->uval = (unsigned long long)tok->fval;
+      break;
+   case TR_BIN_BLOB:
+      /* blob data lives as long as the reader */
+      v->type = TR_BIN_BYTES;
+      v->data = tok->data;
+      v->size = tok->size;
+      break;
+   case TR_BIN_BYTES:
+   case TR_BIN_STRING:
+      {
+         void *data = pool_alloc(r, tok->size + 1);
+         if (!data)
+            return FALSE;
+         memcpy(data, tok->data, tok->size + 1);
+         v->data = data;
+         v->size = tok->size;
+      }
+      break;
+   default:
+      break;
+   }
+
+   return TRUE;
+}
+
+
+static int
+find_handler(const char *klass, const char *method);
+
+
+static boolean
+add_call(struct replay *r, const struct call *call)
+{
+   if (r->num_calls == r->max_calls) {
+      unsigned max = r->max_calls ? 2 * r->max_calls : 4096;
+      r->calls = REALLOC(r->calls, r->max_calls * sizeof *r->calls,
+                         max * sizeof *r->calls);
+      if (!r->calls)
+         return FALSE;
+      r->max_calls = max;
+   }
+
+   r->calls[r->num_calls++] = *call;
+   return TRUE;
+}
+
+
+static boolean
+load_trace(struct replay *r, const char *filename)
+{
+   struct trace_token tok;
+   struct value *stack[REPLAY_MAX_DEPTH];
+   unsigned depth = 0;
+   struct call call;
+   boolean in_call = FALSE;
+
+   r->reader = trace_reader_open(filename);
+   if (!r->reader)
+      return FALSE;
+
+   memset(&call, 0, sizeof call);
+
+   while (trace_reader_next(r->reader, &tok)) {
+      struct value *top = depth ? stack[depth - 1] : NULL;
+      struct value *v;
+
+      switch (tok.op) {
+      case TR_BIN_CALL_BEGIN:
+         memset(&call, 0, sizeof call);
+         call.no = tok.call_no;
+         call.klass = tok.name;
+         call.method = tok.method;
+         in_call = TRUE;
+         depth = 0;
+         break;
+
+      case TR_BIN_CALL_END:
+         if (!in_call || depth)
+            goto malformed;
+         call.handler = find_handler(call.klass, call.method);
+         if (!add_call(r, &call))
+            goto no_memory;
+         in_call = FALSE;
+         break;
+
+      case TR_BIN_ARG_BEGIN:
+      case TR_BIN_RET_BEGIN:
+      case TR_BIN_MEMBER_BEGIN:
+      case TR_BIN_ELEM_BEGIN:
+         if (!in_call || depth == REPLAY_MAX_DEPTH)
+            goto malformed;
+         if ((tok.op == TR_BIN_ARG_BEGIN || tok.op == TR_BIN_RET_BEGIN) ?
+             top != NULL : top == NULL)
+            goto malformed;
+
+         v = value_new(r);
+         if (!v)
+            goto no_memory;
+
+         if (tok.op == TR_BIN_RET_BEGIN)
+            call.ret = v;
+         else {
+            v->key = tok.name;
+            value_append(top ? top : &call.args, v);
+         }
+
+         stack[depth++] = v;
+         break;
+
+      case TR_BIN_ARG_END:
+      case TR_BIN_RET_END:
+      case TR_BIN_MEMBER_END:
+      case TR_BIN_ELEM_END:
+         if (!depth)
+            goto malformed;
+         --depth;
+         break;
+
+      case TR_BIN_ARRAY_END:
+      case TR_BIN_STRUCT_END:
+         break;
+
+      default:
+         if (!top)
+            goto malformed;
+         if (!value_set(r, top, &tok))
+            goto no_memory;
+         break;
+      }
+   }
+
+   if (trace_reader_error(r->reader)) {
+      fprintf(stderr, "%s: read error after call %lu\n", filename, call.no);
+      return FALSE;
+   }
+
+   return TRUE;
+
+malformed:
+   fprintf(stderr, "%s: malformed trace at call %lu\n", filename, call.no);
+   return FALSE;
+
+no_memory:
+   fprintf(stderr, "out of memory\n");
+   return FALSE;
+}
+
+
+/*
+ * Argument decoding.
+ */
+
+static struct value *
+value_child(const struct value *v, const char *key)
+{
+   struct value *child;
+
+   if (!v)
+      return NULL;
+
+   for (child = v->first; child; child = child->next)
+      if (child->key && strcmp(child->key, key) == 0)
+         return child;
+
+   return NULL;
+}
+
+
+static struct value *
+value_elem(const struct value *v, unsigned index)
+{
+   struct value *elem;
+
+   if (!v || v->type != TR_BIN_ARRAY_BEGIN)
+      return NULL;
+
+   for (elem = v->first; elem && index; elem = elem->next)
+      --index;
+
+   return elem;
+}
+
+
+static INLINE struct value *
+arg(const struct call *call, const char *name)
+{
+   return value_child(&call->args, name);
+}
+
+
+static INLINE unsigned
+value_uint(const struct value *v)
+{
+   return v ? (unsigned)v->uval : 0;
+}
+
+
+static INLINE int
+value_int(const struct value *v)
+{
+   return v ? (int)v->ival : 0;
+}
+
+
+static INLINE double
+value_float(const struct value *v)
+{
+   return v ? v->fval : 0.0;
+}
+
+
+static void
+value_floats(const struct value *v, float *dst, unsigned count)
+{
+   const struct value *elem = v && v->type == TR_BIN_ARRAY_BEGIN ? v->first : NULL;
+   unsigned i;
+
+   for (i = 0; i < count; ++i) {
+      dst[i] = elem ? (float)elem->fval : 0.0f;
+      if (elem)
+         elem = elem->next;
+   }
+}
+
+
+static void *
+value_object(struct replay *r, const struct value *v)
+{
+   void *obj;
+
+   if (!v || v->type == TR_BIN_NULL)
+      return NULL;
+
+   if (v->type != TR_BIN_PTR) {
+      fprintf(stderr, "call %lu: expected a pointer\n", r->call_no);
+      return NULL;
+   }
+
+   obj = hash_table_get(r->objects, (void *)(uintptr_t)v->uval);
+   if (!obj)
+      fprintf(stderr, "call %lu: unknown object 0x%08llx\n",
+              r->call_no, v->uval);
+
+   return obj;
+}
+
+
+static void
+register_object(struct replay *r, const struct value *ret, void *obj)
+{
+   void *key;
+
+   if (!ret || ret->type != TR_BIN_PTR)
+      return;
+
+   key = (void *)(uintptr_t)ret->uval;
+   if (obj)
+      hash_table_set(r->objects, key, obj);
+   else
+      hash_table_remove(r->objects, key);
+}
+
+
+static void
+unregister_object(struct replay *r, const struct value *v)
+{
+   if (v && v->type == TR_BIN_PTR)
+      hash_table_remove(r->objects, (void *)(uintptr_t)v->uval);
+}
+
+
+static enum pipe_format
+value_format(struct replay *r, const struct value *v)
+{
+   const struct util_format_description *desc;
+
+   if (!v || v->type != TR_BIN_ENUM)
+      return PIPE_FORMAT_NONE;
+
+   /* pf_name() falls back to the number in release builds */
+   if (v->name[0] >= '0' && v->name[0] <= '9')
+      return (enum pipe_format)strtoul(v->name, NULL, 0);
+
+   for (desc = util_format_description_table;
+        desc->format != PIPE_FORMAT_NONE;
+        ++desc) {
+      if (strcmp(desc->name, v->name) == 0)
+         return desc->format;
+   }
+
+   fprintf(stderr, "call %lu: unknown format %s\n", r->call_no, v->name);
+   return PIPE_FORMAT_NONE;
+}
+
+
+static const struct tgsi_token *
+value_tokens(struct replay *r, const struct value *state)
+{
+   struct value *v = value_child(state, "tokens");
+
+   if (!v)
+      return NULL;
+
+   if (!v->cache) {
+      struct tgsi_token tokens[REPLAY_MAX_TOKENS];
+
+      if (v->type != TR_BIN_STRING ||
+          !tgsi_text_translate(v->data, tokens, Elements(tokens))) {
+         fprintf(stderr, "call %lu: failed to translate shader\n", r->call_no);
+         return NULL;
+      }
+
+      v->cache = tgsi_dup_tokens(tokens);
+   }
+
+   return v->cache;
+}
+
+
+#define MEMBER_UINT(v, s, m) \
+   (s)->m = value_uint(value_child(v, #m))
+
+#define MEMBER_FLOAT(v, s, m) \
+   (s)->m = (float)value_float(value_child(v, #m))
+
+#define MEMBER_FLOATS(v, s, m) \
+   value_floats(value_child(v, #m), (s)->m, Elements((s)->m))
+
+
+/*
+ * A screen with a malloc based winsys, like the python state tracker's.
+ */
+
+struct replay_buffer
+{
+   struct pipe_buffer base;
+   boolean user;
+   void *data;
+};
+
+
+static INLINE struct replay_buffer *
+replay_buffer(struct pipe_buffer *buf)
+{
+   return (struct replay_buffer *)buf;
+}
+
+
+static void *
+replay_winsys_buffer_map(struct pipe_winsys *winsys,
+                         struct pipe_buffer *buf,
+                         unsigned flags)
+{
+   return replay_buffer(buf)->data;
+}
+
+
+static void
+replay_winsys_buffer_unmap(struct pipe_winsys *winsys,
+                           struct pipe_buffer *buf)
+{
+}
+
+
+static void
+replay_winsys_buffer_destroy(struct pipe_buffer *buf)
+{
+   struct replay_buffer *buffer = replay_buffer(buf);
+
+   if (!buffer->user)
+      align_free(buffer->data);
+
+   FREE(buffer);
+}
+
+
+static struct pipe_buffer *
+replay_winsys_buffer_create(struct pipe_winsys *winsys,
+                            unsigned alignment,
+                            unsigned usage,
+                            unsigned size)
+{
+   struct replay_buffer *buffer = CALLOC_STRUCT(replay_buffer);
+
+   if (!buffer)
+      return NULL;
+
+   pipe_reference_init(&buffer->base.reference, 1);
+   buffer->base.alignment = alignment;
+   buffer->base.usage = usage;
+   buffer->base.size = size;
+
+   buffer->data = align_malloc(size, alignment);
+   if (!buffer->data) {
+      FREE(buffer);
+      return NULL;
+   }
+
+   return &buffer->base;
+}
+
+
+static struct pipe_buffer *
+replay_winsys_user_buffer_create(struct pipe_winsys *winsys,
+                                 void *ptr,
+                                 unsigned bytes)
+{
+   struct replay_buffer *buffer = CALLOC_STRUCT(replay_buffer);
+
+   if (!buffer)
+      return NULL;
+
+   pipe_reference_init(&buffer->base.reference, 1);
+   buffer->base.size = bytes;
+   buffer->user = TRUE;
+   buffer->data = ptr;
+
+   return &buffer->base;
+}
+
+
+static struct pipe_buffer *
+replay_winsys_surface_buffer_create(struct pipe_winsys *winsys,
+                                    unsigned width, unsigned height,
+                                    enum pipe_format format,
+                                    unsigned usage,
+                                    unsigned tex_usage,
+                                    unsigned *stride)
+{
+   const unsigned alignment = 64;
+   struct pipe_format_block block;
+   unsigned nblocksx, nblocksy;
+
+   pf_get_block(format, &block);
+   nblocksx = pf_get_nblocksx(&block, width);
+   nblocksy = pf_get_nblocksy(&block, height);
+   *stride = align(nblocksx * block.size, alignment);
+
+   return winsys->buffer_create(winsys, alignment, usage, *stride * nblocksy);
+}
+
+
+static void
+replay_winsys_flush_frontbuffer(struct pipe_winsys *winsys,
+                                struct pipe_surface *surf,
+                                void *context_private)
+{
+}
+
+
+static const char *
+replay_winsys_get_name(struct pipe_winsys *winsys)
+{
+   return "replay";
+}
+
+
+static void
+replay_winsys_fence_reference(struct pipe_winsys *winsys,
+                              struct pipe_fence_handle **ptr,
+                              struct pipe_fence_handle *fence)
+{
+}
+
+
+static int
+replay_winsys_fence_signalled(struct pipe_winsys *winsys,
+                              struct pipe_fence_handle *fence,
+                              unsigned flag)
+{
+   return 0;
+}
+
+
+static int
+replay_winsys_fence_finish(struct pipe_winsys *winsys,
+                           struct pipe_fence_handle *fence,
+                           unsigned flag)
+{
+   return 0;
+}
+
+
+static void
+replay_winsys_destroy(struct pipe_winsys *winsys)
+{
+   FREE(winsys);
+}
+
+
+static struct pipe_screen *
+replay_softpipe_create_screen(void)
+{
+   struct pipe_winsys *winsys;
+   struct pipe_screen *screen;
+
+   winsys = CALLOC_STRUCT(pipe_winsys);
+   if (!winsys)
+      return NULL;
+
+   winsys->destroy = replay_winsys_destroy;
+   winsys->buffer_create = replay_winsys_buffer_create;
+   winsys->user_buffer_create = replay_winsys_user_buffer_create;
+   winsys->buffer_map = replay_winsys_buffer_map;
+   winsys->buffer_unmap = replay_winsys_buffer_unmap;
+   winsys->buffer_destroy = replay_winsys_buffer_destroy;
+   winsys->surface_buffer_create = replay_winsys_surface_buffer_create;
+   winsys->fence_reference = replay_winsys_fence_reference;
+   winsys->fence_signalled = replay_winsys_fence_signalled;
+   winsys->fence_finish = replay_winsys_fence_finish;
+   winsys->flush_frontbuffer = replay_winsys_flush_frontbuffer;
+   winsys->get_name = replay_winsys_get_name;
+
+   screen = softpipe_create_screen(winsys);
+   if (!screen)
+      replay_winsys_destroy(winsys);
+
+   return screen;
+}
+
+
+#ifdef GALLIUM_LLVMPIPE
+
+/*
+ * llvmpipe allocates its own texture storage and only asks the winsys
+ * for display targets, which are plain malloc'ed memory here too.
+ */
+
+struct replay_displaytarget
+{
+   void *data;
+};
+
+
+static boolean
+replay_lp_is_displaytarget_format_supported(struct llvmpipe_winsys *ws,
+                                            enum pipe_format format)
+{
+   return TRUE;
+}
+
+
+static struct llvmpipe_displaytarget *
+replay_lp_displaytarget_create(struct llvmpipe_winsys *ws,
+                               enum pipe_format format,
+                               unsigned width, unsigned height,
+                               unsigned alignment,
+                               unsigned *stride)
+{
+   struct replay_displaytarget *dt = CALLOC_STRUCT(replay_displaytarget);
+   struct pipe_format_block block;
+   unsigned nblocksx, nblocksy;
+
+   if (!dt)
+      return NULL;
+
+   pf_get_block(format, &block);
+   nblocksx = pf_get_nblocksx(&block, width);
+   nblocksy = pf_get_nblocksy(&block, height);
+   *stride = align(nblocksx * block.size, alignment);
+
+   dt->data = align_malloc(*stride * nblocksy, alignment);
+   if (!dt->data) {
+      FREE(dt);
+      return NULL;
+   }
+
+   return (struct llvmpipe_displaytarget *)dt;
+}
+
+
+static void *
+replay_lp_displaytarget_map(struct llvmpipe_winsys *ws,
+                            struct llvmpipe_displaytarget *dt,
+                            unsigned flags)
+{
+   return ((struct replay_displaytarget *)dt)->data;
+}
+
+
+static void
+replay_lp_displaytarget_unmap(struct llvmpipe_winsys *ws,
+                              struct llvmpipe_displaytarget *dt)
+{
+}
+
+
+static void
+replay_lp_displaytarget_display(struct llvmpipe_winsys *ws,
+                                struct llvmpipe_displaytarget *dt,
+                                void *context_private)
+{
+}
+
+
+static void
+replay_lp_displaytarget_destroy(struct llvmpipe_winsys *ws,
+                                struct llvmpipe_displaytarget *dt)
+{
+   struct replay_displaytarget *rdt = (struct replay_displaytarget *)dt;
+
+   align_free(rdt->data);
+   FREE(rdt);
+}
+
+
+static void
+replay_lp_winsys_destroy(struct llvmpipe_winsys *ws)
+{
+   FREE(ws);
+}
+
+
+static struct pipe_screen *
+replay_llvmpipe_create_screen(void)
+{
+   struct llvmpipe_winsys *winsys;
+   struct pipe_screen *screen;
+
+   winsys = CALLOC_STRUCT(llvmpipe_winsys);
+   if (!winsys)
+      return NULL;
+
+   winsys->destroy = replay_lp_winsys_destroy;
+   winsys->is_displaytarget_format_supported =
+      replay_lp_is_displaytarget_format_supported;
+   winsys->displaytarget_create = replay_lp_displaytarget_create;
+   winsys->displaytarget_map = replay_lp_displaytarget_map;
+   winsys->displaytarget_unmap = replay_lp_displaytarget_unmap;
+   winsys->displaytarget_display = replay_lp_displaytarget_display;
+   winsys->displaytarget_destroy = replay_lp_displaytarget_destroy;
+
+   screen = llvmpipe_create_screen(winsys);
+   if (!screen)
+      replay_lp_winsys_destroy(winsys);
+
+   return screen;
+}
+
+#endif /* GALLIUM_LLVMPIPE */
+
+
+static const struct replay_driver drivers[] = {
+   { "softpipe", replay_softpipe_create_screen, softpipe_create },
+#ifdef GALLIUM_LLVMPIPE
+   { "llvmpipe", replay_llvmpipe_create_screen, llvmpipe_create },
+#endif
+};
+
+
+/*
+ * Global calls.
+ */
+
+static void
+replay_pipe_screen_create(struct replay *r, const struct call *call)
+{
+   struct pipe_screen *screen;
+
+   replay_begin(r);
+   screen = r->driver->create_screen();
+   replay_end(r);
+
+   register_object(r, call->ret, screen);
+}
+
+
+static void
+replay_pipe_context_create(struct replay *r, const struct call *call)
+{
+   struct pipe_screen *screen = value_object(r, arg(call, "screen"));
+   struct pipe_context *pipe = NULL;
+
+   if (screen) {
+      replay_begin(r);
+      pipe = r->driver->create_context(screen);
+      replay_end(r);
+   }
+
+   register_object(r, call->ret, pipe);
+}
+
+
+/*
+ * Screen calls.
+ */
+
+#define SCREEN_OR_RETURN(r, call) \
+   struct pipe_screen *screen = value_object(r, arg(call, "screen")); \
+   if (!screen) \
+      return
+
+
+static void
+replay_screen_destroy(struct replay *r, const struct call *call)
+{
+   SCREEN_OR_RETURN(r, call);
+
+   replay_begin(r);
+   screen->destroy(screen);
+   replay_end(r);
+
+   unregister_object(r, arg(call, "screen"));
+}
+
+
+static void
+replay_texture_create(struct replay *r, const struct call *call)
+{
+   const struct value *v = arg(call, "templat");
+   struct pipe_texture templat;
+   struct pipe_texture *texture;
+   SCREEN_OR_RETURN(r, call);
+
+   memset(&templat, 0, sizeof templat);
+   templat.target = value_uint(value_child(v, "target"));
+   templat.format = value_format(r, value_child(v, "format"));
+   templat.width[0] = value_uint(value_elem(value_child(v, "width"), 0));
+   templat.height[0] = value_uint(value_elem(value_child(v, "height"), 0));
+   templat.depth[0] = value_uint(value_elem(value_child(v, "depth"), 0));
+   pf_get_block(templat.format, &templat.block);
+   MEMBER_UINT(v, &templat, last_level);
+   MEMBER_UINT(v, &templat, tex_usage);
+
+   replay_begin(r);
+   texture = screen->texture_create(screen, &templat);
+   replay_end(r);
+
+   register_object(r, call->ret, texture);
+}
+
+
+static void
+replay_texture_destroy(struct replay *r, const struct call *call)
+{
+   struct pipe_texture *texture = value_object(r, arg(call, "texture"));
+
+   replay_begin(r);
+   pipe_texture_reference(&texture, NULL);
+   replay_end(r);
+
+   unregister_object(r, arg(call, "texture"));
+}
+
+
+static void
+replay_get_tex_surface(struct replay *r, const struct call *call)
+{
+   struct pipe_texture *texture = value_object(r, arg(call, "texture"));
+   struct pipe_surface *surface = NULL;
+   SCREEN_OR_RETURN(r, call);
+
+   if (texture) {
+      replay_begin(r);
+      surface = screen->get_tex_surface(screen, texture,
+                                        value_uint(arg(call, "face")),
+                                        value_uint(arg(call, "level")),
+                                        value_uint(arg(call, "zslice")),
+                                        value_uint(arg(call, "usage")));
+      replay_end(r);
+   }
+
+   register_object(r, call->ret, surface);
+}
+
+
+static void
+replay_tex_surface_destroy(struct replay *r, const struct call *call)
+{
+   struct pipe_surface *surface = value_object(r, arg(call, "surface"));
+
+   replay_begin(r);
+   pipe_surface_reference(&surface, NULL);
+   replay_end(r);
+
+   unregister_object(r, arg(call, "surface"));
+}
+
+
+static void
+replay_get_tex_transfer(struct replay *r, const struct call *call)
+{
+   struct pipe_texture *texture = value_object(r, arg(call, "texture"));
+   struct pipe_transfer *transfer = NULL;
+   SCREEN_OR_RETURN(r, call);
+
+   if (texture) {
+      replay_begin(r);
+      transfer = screen->get_tex_transfer(screen, texture,
+                                          value_uint(arg(call, "face")),
+                                          value_uint(arg(call, "level")),
+                                          value_uint(arg(call, "zslice")),
+                                          value_uint(arg(call, "usage")),
+                                          value_uint(arg(call, "x")),
+                                          value_uint(arg(call, "y")),
+                                          value_uint(arg(call, "w")),
+                                          value_uint(arg(call, "h")));
+      replay_end(r);
+   }
+
+   register_object(r, call->ret, transfer);
+}
+
+
+static void
+replay_tex_transfer_destroy(struct replay *r, const struct call *call)
+{
+   struct pipe_transfer *transfer = value_object(r, arg(call, "transfer"));
+   SCREEN_OR_RETURN(r, call);
+
+   if (transfer) {
+      replay_begin(r);
+      screen->tex_transfer_destroy(transfer);
+      replay_end(r);
+   }
+
+   unregister_object(r, arg(call, "transfer"));
+}
+
+
+static void
+replay_transfer_write(struct replay *r, const struct call *call)
+{
+   struct pipe_transfer *transfer = value_object(r, arg(call, "transfer"));
+   const struct value *data = arg(call, "data");
+   unsigned src_stride = value_uint(arg(call, "stride"));
+   const uint8_t *src;
+   uint8_t *map;
+   unsigned row_size, rows, y;
+   SCREEN_OR_RETURN(r, call);
+
+   if (!transfer || !data || data->type != TR_BIN_BYTES || !src_stride)
+      return;
+
+   /* the traced and the replayed transfer may have different strides */
+   row_size = MIN2(MIN2(src_stride, transfer->stride),
+                   transfer->nblocksx * transfer->block.size);
+   rows = MIN2(transfer->nblocksy, data->size / src_stride);
+   src = data->data;
+
+   replay_begin(r);
+   map = screen->transfer_map(screen, transfer);
+   if (map) {
+      for (y = 0; y < rows; ++y)
+         memcpy(map + y * transfer->stride, src + y * src_stride, row_size);
+      screen->transfer_unmap(screen, transfer);
+   }
+   replay_end(r);
+}
+
+
+static void
+replay_buffer_create(struct replay *r, const struct call *call)
+{
+   struct pipe_buffer *buffer;
+   SCREEN_OR_RETURN(r, call);
+
+   replay_begin(r);
+   buffer = screen->buffer_create(screen,
+                                  value_uint(arg(call, "alignment")),
+                                  value_uint(arg(call, "usage")),
+                                  value_uint(arg(call, "size")));
+   replay_end(r);
+
+   register_object(r, call->ret, buffer);
+}
+
+
+static void
+replay_user_buffer_create(struct replay *r, const struct call *call)
+{
+   const struct value *data = arg(call, "data");
+   struct pipe_buffer *buffer;
+   SCREEN_OR_RETURN(r, call);
+
+   if (!data || data->type != TR_BIN_BYTES)
+      return;
+
+   /* the trace data stays around, so it can back the user buffer */
+   replay_begin(r);
+   buffer = screen->user_buffer_create(screen, (void *)data->data,
+                                       (unsigned)data->size);
+   replay_end(r);
+
+   register_object(r, call->ret, buffer);
+}
+
+
+static void
+replay_buffer_write(struct replay *r, const struct call *call)
+{
+   struct pipe_buffer *buffer = value_object(r, arg(call, "buffer"));
+   const struct value *data = arg(call, "data");
+   unsigned offset = value_uint(arg(call, "offset"));
+   unsigned size;
+   SCREEN_OR_RETURN(r, call);
+
+   if (!buffer || !data || data->type != TR_BIN_BYTES)
+      return;
+
+   size = MIN2((unsigned)data->size, value_uint(arg(call, "size")));
+   if (!size || offset + size > buffer->size)
+      return;
+
+   replay_begin(r);
+   pipe_buffer_write(screen, buffer, offset, size, data->data);
+   replay_end(r);
+}
+
+
+static void
+replay_buffer_destroy(struct replay *r, const struct call *call)
+{
+   struct pipe_buffer *buffer = value_object(r, arg(call, "buffer"));
+
+   replay_begin(r);
+   pipe_buffer_reference(&buffer, NULL);
+   replay_end(r);
+
+   unregister_object(r, arg(call, "buffer"));
+}
+
+
+static void
+replay_flush_frontbuffer(struct replay *r, const struct call *call)
+{
+   struct pipe_surface *surface = value_object(r, arg(call, "surface"));
+   SCREEN_OR_RETURN(r, call);
+
+   replay_begin(r);
+   screen->flush_frontbuffer(screen, surface, NULL);
+   replay_end(r);
+
+   replay_end_frame(r);
+}
+
+
+/*
+ * Context calls.
+ */
+
+#define PIPE_OR_RETURN(r, call) \
+   struct pipe_context *pipe = value_object(r, arg(call, "pipe")); \
+   if (!pipe) \
+      return
+
+
+static void
+replay_context_destroy(struct replay *r, const struct call *call)
+{
+   PIPE_OR_RETURN(r, call);
+
+   replay_begin(r);
+   pipe->destroy(pipe);
+   replay_end(r);
+
+   unregister_object(r, arg(call, "pipe"));
+}
+
+
+static void
+replay_create_blend_state(struct replay *r, const struct call *call)
+{
+   const struct value *v = arg(call, "state");
+   struct pipe_blend_state state;
+   void *cso;
+   PIPE_OR_RETURN(r, call);
+
+   memset(&state, 0, sizeof state);
+   MEMBER_UINT(v, &state, blend_enable);
+   MEMBER_UINT(v, &state, rgb_func);
+   MEMBER_UINT(v, &state, rgb_src_factor);
+   MEMBER_UINT(v, &state, rgb_dst_factor);
+   MEMBER_UINT(v, &state, alpha_func);
+   MEMBER_UINT(v, &state, alpha_src_factor);
+   MEMBER_UINT(v, &state, alpha_dst_factor);
+   MEMBER_UINT(v, &state, logicop_enable);
+   MEMBER_UINT(v, &state, logicop_func);
+   MEMBER_UINT(v, &state, colormask);
+   MEMBER_UINT(v, &state, dither);
+
+   replay_begin(r);
+   cso = pipe->create_blend_state(pipe, &state);
+   replay_end(r);
+
+   register_object(r, call->ret, cso);
+}
+
+
+static void
+replay_create_sampler_state(struct replay *r, const struct call *call)
+{
+   const struct value *v = arg(call, "state");
+   struct pipe_sampler_state state;
+   void *cso;
+   PIPE_OR_RETURN(r, call);
+
+   memset(&state, 0, sizeof state);
+   MEMBER_UINT(v, &state, wrap_s);
+   MEMBER_UINT(v, &state, wrap_t);
+   MEMBER_UINT(v, &state, wrap_r);
+   MEMBER_UINT(v, &state, min_img_filter);
+   MEMBER_UINT(v, &state, min_mip_filter);
+   MEMBER_UINT(v, &state, mag_img_filter);
+   MEMBER_UINT(v, &state, compare_mode);
+   MEMBER_UINT(v, &state, compare_func);
+   MEMBER_UINT(v, &state, normalized_coords);
+   MEMBER_UINT(v, &state, prefilter);
+   MEMBER_FLOAT(v, &state, lod_bias);
+   MEMBER_FLOAT(v, &state, min_lod);
+   MEMBER_FLOAT(v, &state, max_lod);
+   MEMBER_FLOATS(v, &state, border_color);
+   MEMBER_FLOAT(v, &state, max_anisotropy);
+
+   replay_begin(r);
+   cso = pipe->create_sampler_state(pipe, &state);
+   replay_end(r);
+
+   register_object(r, call->ret, cso);
+}
+
+
+static void
+replay_create_rasterizer_state(struct replay *r, const struct call *call)
+{
+   const struct value *v = arg(call, "state");
+   const struct value *elem;
+   struct pipe_rasterizer_state state;
+   unsigned i;
+   void *cso;
+   PIPE_OR_RETURN(r, call);
+
+   memset(&state, 0, sizeof state);
+   MEMBER_UINT(v, &state, flatshade);
+   MEMBER_UINT(v, &state, light_twoside);
+   MEMBER_UINT(v, &state, front_winding);
+   MEMBER_UINT(v, &state, cull_mode);
+   MEMBER_UINT(v, &state, fill_cw);
+   MEMBER_UINT(v, &state, fill_ccw);
+   MEMBER_UINT(v, &state, offset_cw);
+   MEMBER_UINT(v, &state, offset_ccw);
+   MEMBER_UINT(v, &state, scissor);
+   MEMBER_UINT(v, &state, poly_smooth);
+   MEMBER_UINT(v, &state, poly_stipple_enable);
+   MEMBER_UINT(v, &state, point_smooth);
+   MEMBER_UINT(v, &state, point_sprite);
+   MEMBER_UINT(v, &state, point_size_per_vertex);
+   MEMBER_UINT(v, &state, multisample);
+   MEMBER_UINT(v, &state, line_smooth);
+   MEMBER_UINT(v, &state, line_stipple_enable);
+   MEMBER_UINT(v, &state, line_stipple_factor);
+   MEMBER_UINT(v, &state, line_stipple_pattern);
+   MEMBER_UINT(v, &state, line_last_pixel);
+   MEMBER_UINT(v, &state, bypass_vs_clip_and_viewport);
+   MEMBER_UINT(v, &state, flatshade_first);
+   MEMBER_UINT(v, &state, gl_rasterization_rules);
+   MEMBER_FLOAT(v, &state, line_width);
+   MEMBER_FLOAT(v, &state, point_size);
+   MEMBER_FLOAT(v, &state, point_size_min);
+   MEMBER_FLOAT(v, &state, point_size_max);
+   MEMBER_FLOAT(v, &state, offset_units);
+   MEMBER_FLOAT(v, &state, offset_scale);
+
+   elem = value_elem(value_child(v, "sprite_coord_mode"), 0);
+   for (i = 0; elem && i < Elements(state.sprite_coord_mode); ++i) {
+      state.sprite_coord_mode[i] = (ubyte)value_uint(elem);
+      elem = elem->next;
+   }
+
+   replay_begin(r);
+   cso = pipe->create_rasterizer_state(pipe, &state);
+   replay_end(r);
+
+   register_object(r, call->ret, cso);
+}
+
+
+static void
+replay_create_depth_stencil_alpha_state(struct replay *r,
+                                        const struct call *call)
+{
+   const struct value *v = arg(call, "state");
+   const struct value *depth = value_child(v, "depth");
+   const struct value *alpha = value_child(v, "alpha");
+   struct pipe_depth_stencil_alpha_state state;
+   unsigned i;
+   void *cso;
+   PIPE_OR_RETURN(r, call);
+
+   memset(&state, 0, sizeof state);
+   MEMBER_UINT(depth, &state.depth, enabled);
+   MEMBER_UINT(depth, &state.depth, writemask);
+   MEMBER_UINT(depth, &state.depth, func);
+
+   for (i = 0; i < 2; ++i) {
+      const struct value *stencil = value_elem(value_child(v, "stencil"), i);
+      MEMBER_UINT(stencil, &state.stencil[i], enabled);
+      MEMBER_UINT(stencil, &state.stencil[i], func);
+      MEMBER_UINT(stencil, &state.stencil[i], fail_op);
+      MEMBER_UINT(stencil, &state.stencil[i], zpass_op);
+      MEMBER_UINT(stencil, &state.stencil[i], zfail_op);
+      MEMBER_UINT(stencil, &state.stencil[i], ref_value);
+      MEMBER_UINT(stencil, &state.stencil[i], valuemask);
+      MEMBER_UINT(stencil, &state.stencil[i], writemask);
+   }
+
+   MEMBER_UINT(alpha, &state.alpha, enabled);
+   MEMBER_UINT(alpha, &state.alpha, func);
+   MEMBER_FLOAT(alpha, &state.alpha, ref_value);
+
+   replay_begin(r);
+   cso = pipe->create_depth_stencil_alpha_state(pipe, &state);
+   replay_end(r);
+
+   register_object(r, call->ret, cso);
+}
+
+
+static void
+replay_create_fs_state(struct replay *r, const struct call *call)
+{
+   struct pipe_shader_state state;
+   void *cso = NULL;
+   PIPE_OR_RETURN(r, call);
+
+   state.tokens = value_tokens(r, arg(call, "state"));
+   if (state.tokens) {
+      replay_begin(r);
+      cso = pipe->create_fs_state(pipe, &state);
+      replay_end(r);
+   }
+
+   register_object(r, call->ret, cso);
+}
+
+
+static void
+replay_create_vs_state(struct replay *r, const struct call *call)
+{
+   struct pipe_shader_state state;
+   void *cso = NULL;
+   PIPE_OR_RETURN(r, call);
+
+   state.tokens = value_tokens(r, arg(call, "state"));
+   if (state.tokens) {
+      replay_begin(r);
+      cso = pipe->create_vs_state(pipe, &state);
+      replay_end(r);
+   }
+
+   register_object(r, call->ret, cso);
+}
+
+
+/**
+ * Bind and delete calls all take a single state object.
+ */
+#define REPLAY_STATE_CALL(func) \
+static void \
+replay_##func(struct replay *r, const struct call *call) \
+{ \
+   void *state = value_object(r, arg(call, "state")); \
+   PIPE_OR_RETURN(r, call); \
+   \
+   replay_begin(r); \
+   pipe->func(pipe, state); \
+   replay_end(r); \
+}
+
+REPLAY_STATE_CALL(bind_blend_state)
+REPLAY_STATE_CALL(bind_rasterizer_state)
+REPLAY_STATE_CALL(bind_depth_stencil_alpha_state)
+REPLAY_STATE_CALL(bind_fs_state)
+REPLAY_STATE_CALL(bind_vs_state)
+
+
+#define REPLAY_DELETE_CALL(func) \
+static void \
+replay_##func(struct replay *r, const struct call *call) \
+{ \
+   void *state = value_object(r, arg(call, "state")); \
+   PIPE_OR_RETURN(r, call); \
+   \
+   if (state) { \
+      replay_begin(r); \
+      pipe->func(pipe, state); \
+      replay_end(r); \
+   } \
+   unregister_object(r, arg(call, "state")); \
+}
+
+REPLAY_DELETE_CALL(delete_blend_state)
+REPLAY_DELETE_CALL(delete_sampler_state)
+REPLAY_DELETE_CALL(delete_rasterizer_state)
+REPLAY_DELETE_CALL(delete_depth_stencil_alpha_state)
+REPLAY_DELETE_CALL(delete_fs_state)
+REPLAY_DELETE_CALL(delete_vs_state)
+
+
+static void
+replay_bind_sampler_states(struct replay *r, const struct call *call)
+{
+   const struct value *states = arg(call, "states");
+   unsigned num_states = value_uint(arg(call, "num_states"));
+   void *samplers[PIPE_MAX_SAMPLERS];
+   unsigned i;
+   PIPE_OR_RETURN(r, call);
+
+   num_states = MIN2(num_states, PIPE_MAX_SAMPLERS);
+   for (i = 0; i < num_states; ++i)
+      samplers[i] = value_object(r, value_elem(states, i));
+
+   replay_begin(r);
+   pipe->bind_sampler_states(pipe, num_states, samplers);
+   replay_end(r);
+}
+
+
+static void
+replay_set_blend_color(struct replay *r, const struct call *call)
+{
+   struct pipe_blend_color state;
+   PIPE_OR_RETURN(r, call);
+
+   MEMBER_FLOATS(arg(call, "state"), &state, color);
+
+   replay_begin(r);
+   pipe->set_blend_color(pipe, &state);
+   replay_end(r);
+}
+
+
+static void
+replay_set_clip_state(struct replay *r, const struct call *call)
+{
+   const struct value *v = arg(call, "state");
+   struct pipe_clip_state state;
+   unsigned i;
+   PIPE_OR_RETURN(r, call);
+
+   memset(&state, 0, sizeof state);
+   for (i = 0; i < PIPE_MAX_CLIP_PLANES; ++i)
+      value_floats(value_elem(value_child(v, "ucp"), i), state.ucp[i], 4);
+   MEMBER_UINT(v, &state, nr);
+
+   replay_begin(r);
+   pipe->set_clip_state(pipe, &state);
+   replay_end(r);
+}
+
+
+static void
+replay_set_constant_buffer(struct replay *r, const struct call *call)
+{
+   const struct value *v = arg(call, "buffer");
+   struct pipe_constant_buffer state;
+   PIPE_OR_RETURN(r, call);
+
+   state.buffer = value_object(r, value_child(v, "buffer"));
+
+   replay_begin(r);
+   pipe->set_constant_buffer(pipe,
+                             value_uint(arg(call, "shader")),
+                             value_uint(arg(call, "index")),
+                             v && v->type == TR_BIN_STRUCT_BEGIN ? &state : NULL);
+   replay_end(r);
+}
+
+
+static void
+replay_set_framebuffer_state(struct replay *r, const struct call *call)
+{
+   const struct value *v = arg(call, "state");
+   struct pipe_framebuffer_state state;
+   unsigned i;
+   PIPE_OR_RETURN(r, call);
+
+   memset(&state, 0, sizeof state);
+   MEMBER_UINT(v, &state, width);
+   MEMBER_UINT(v, &state, height);
+   MEMBER_UINT(v, &state, nr_cbufs);
+   for (i = 0; i < state.nr_cbufs && i < PIPE_MAX_COLOR_BUFS; ++i)
+      state.cbufs[i] = value_object(r, value_elem(value_child(v, "cbufs"), i));
+   state.zsbuf = value_object(r, value_child(v, "zsbuf"));
+
+   replay_begin(r);
+   pipe->set_framebuffer_state(pipe, &state);
+   replay_end(r);
+}
+
+
+static void
+replay_set_polygon_stipple(struct replay *r, const struct call *call)
+{
+   const struct value *elem;
+   struct pipe_poly_stipple state;
+   unsigned i;
+   PIPE_OR_RETURN(r, call);
+
+   memset(&state, 0, sizeof state);
+   elem = value_elem(value_child(arg(call, "state"), "stipple"), 0);
+   for (i = 0; elem && i < Elements(state.stipple); ++i) {
+      state.stipple[i] = value_uint(elem);
+      elem = elem->next;
+   }
+
+   replay_begin(r);
+   pipe->set_polygon_stipple(pipe, &state);
+   replay_end(r);
+}
+
+
+static void
+replay_set_scissor_state(struct replay *r, const struct call *call)
+{
+   const struct value *v = arg(call, "state");
+   struct pipe_scissor_state state;
+   PIPE_OR_RETURN(r, call);
+
+   MEMBER_UINT(v, &state, minx);
+   MEMBER_UINT(v, &state, miny);
+   MEMBER_UINT(v, &state, maxx);
+   MEMBER_UINT(v, &state, maxy);
+
+   replay_begin(r);
+   pipe->set_scissor_state(pipe, &state);
+   replay_end(r);
+}
+
+
+static void
+replay_set_viewport_state(struct replay *r, const struct call *call)
+{
+   const struct value *v = arg(call, "state");
+   struct pipe_viewport_state state;
+   PIPE_OR_RETURN(r, call);
+
+   MEMBER_FLOATS(v, &state, scale);
+   MEMBER_FLOATS(v, &state, translate);
+
+   replay_begin(r);
+   pipe->set_viewport_state(pipe, &state);
+   replay_end(r);
+}
+
+
+static void
+replay_set_sampler_textures(struct replay *r, const struct call *call)
+{
+   const struct value *textures = arg(call, "textures");
+   unsigned num_textures = value_uint(arg(call, "num_textures"));
+   struct pipe_texture *views[PIPE_MAX_SAMPLERS];
+   unsigned i;
+   PIPE_OR_RETURN(r, call);
+
+   num_textures = MIN2(num_textures, PIPE_MAX_SAMPLERS);
+   for (i = 0; i < num_textures; ++i)
+      views[i] = value_object(r, value_elem(textures, i));
+
+   replay_begin(r);
+   pipe->set_sampler_textures(pipe, num_textures, views);
+   replay_end(r);
+}
+
+
+static void
+replay_set_vertex_buffers(struct replay *r, const struct call *call)
+{
+   const struct value *buffers = arg(call, "buffers");
+   unsigned num_buffers = value_uint(arg(call, "num_buffers"));
+   struct pipe_vertex_buffer vbufs[PIPE_MAX_ATTRIBS];
+   unsigned i;
+   PIPE_OR_RETURN(r, call);
+
+   num_buffers = MIN2(num_buffers, PIPE_MAX_ATTRIBS);
+   for (i = 0; i < num_buffers; ++i) {
+      const struct value *v = value_elem(buffers, i);
+      MEMBER_UINT(v, &vbufs[i], stride);
+      MEMBER_UINT(v, &vbufs[i], max_index);
+      MEMBER_UINT(v, &vbufs[i], buffer_offset);
+      vbufs[i].buffer = value_object(r, value_child(v, "buffer"));
+   }
+
+   replay_begin(r);
+   pipe->set_vertex_buffers(pipe, num_buffers, vbufs);
+   replay_end(r);
+}
+
+
+static void
+replay_set_vertex_elements(struct replay *r, const struct call *call)
+{
+   const struct value *elements = arg(call, "elements");
+   unsigned num_elements = value_uint(arg(call, "num_elements"));
+   struct pipe_vertex_element velems[PIPE_MAX_ATTRIBS];
+   unsigned i;
+   PIPE_OR_RETURN(r, call);
+
+   num_elements = MIN2(num_elements, PIPE_MAX_ATTRIBS);
+   for (i = 0; i < num_elements; ++i) {
+      const struct value *v = value_elem(elements, i);
+      MEMBER_UINT(v, &velems[i], src_offset);
+      MEMBER_UINT(v, &velems[i], vertex_buffer_index);
+      MEMBER_UINT(v, &velems[i], nr_components);
+      velems[i].src_format = value_format(r, value_child(v, "src_format"));
+   }
+
+   replay_begin(r);
+   pipe->set_vertex_elements(pipe, num_elements, velems);
+   replay_end(r);
+}
+
+
+static void
+replay_draw_arrays(struct replay *r, const struct call *call)
+{
+   PIPE_OR_RETURN(r, call);
+
+   replay_begin(r);
+   pipe->draw_arrays(pipe,
+                     value_uint(arg(call, "mode")),
+                     value_uint(arg(call, "start")),
+                     value_uint(arg(call, "count")));
+   replay_end(r);
+}
+
+
+static void
+replay_draw_elements(struct replay *r, const struct call *call)
+{
+   struct pipe_buffer *index_buffer = value_object(r, arg(call, "indexBuffer"));
+   PIPE_OR_RETURN(r, call);
+
+   if (!index_buffer)
+      return;
+
+   replay_begin(r);
+   pipe->draw_elements(pipe, index_buffer,
+                       value_uint(arg(call, "indexSize")),
+                       value_uint(arg(call, "mode")),
+                       value_uint(arg(call, "start")),
+                       value_uint(arg(call, "count")));
+   replay_end(r);
+}
+
+
+static void
+replay_draw_range_elements(struct replay *r, const struct call *call)
+{
+   struct pipe_buffer *index_buffer = value_object(r, arg(call, "indexBuffer"));
+   PIPE_OR_RETURN(r, call);
+
+   if (!index_buffer)
+      return;
+
+   replay_begin(r);
+   pipe->draw_range_elements(pipe, index_buffer,
+                             value_uint(arg(call, "indexSize")),
+                             value_uint(arg(call, "minIndex")),
+                             value_uint(arg(call, "maxIndex")),
+                             value_uint(arg(call, "mode")),
+                             value_uint(arg(call, "start")),
+                             value_uint(arg(call, "count")));
+   replay_end(r);
+}
+
+
+static void
+replay_create_query(struct replay *r, const struct call *call)
+{
+   struct pipe_query *query;
+   PIPE_OR_RETURN(r, call);
+
+   replay_begin(r);
+   query = pipe->create_query(pipe, value_uint(arg(call, "query_type")));
+   replay_end(r);
+
+   register_object(r, call->ret, query);
+}
+
+
+static void
+replay_destroy_query(struct replay *r, const struct call *call)
+{
+   struct pipe_query *query = value_object(r, arg(call, "query"));
+   PIPE_OR_RETURN(r, call);
+
+   if (query) {
+      replay_begin(r);
+      pipe->destroy_query(pipe, query);
+      replay_end(r);
+   }
+
+   unregister_object(r, arg(call, "query"));
+}
+
+
+static void
+replay_begin_query(struct replay *r, const struct call *call)
+{
+   struct pipe_query *query = value_object(r, arg(call, "query"));
+   PIPE_OR_RETURN(r, call);
+
+   if (query) {
+      replay_begin(r);
+      pipe->begin_query(pipe, query);
+      replay_end(r);
+   }
+}
+
+
+static void
+replay_end_query(struct replay *r, const struct call *call)
+{
+   struct pipe_query *query = value_object(r, arg(call, "query"));
+   PIPE_OR_RETURN(r, call);
+
+   if (query) {
+      replay_begin(r);
+      pipe->end_query(pipe, query);
+      replay_end(r);
+   }
+}
+
+
+static void
+replay_surface_copy(struct replay *r, const struct call *call)
+{
+   struct pipe_surface *dest = value_object(r, arg(call, "dest"));
+   struct pipe_surface *src = value_object(r, arg(call, "src"));
+   PIPE_OR_RETURN(r, call);
+
+   if (!dest || !src)
+      return;
+
+   replay_begin(r);
+   pipe->surface_copy(pipe,
+                      dest,
+                      value_uint(arg(call, "destx")),
+                      value_uint(arg(call, "desty")),
+                      src,
+                      value_uint(arg(call, "srcx")),
+                      value_uint(arg(call, "srcy")),
+                      value_uint(arg(call, "width")),
+                      value_uint(arg(call, "height")));
+   replay_end(r);
+}
+
+
+static void
+replay_surface_fill(struct replay *r, const struct call *call)
+{
+   struct pipe_surface *dst = value_object(r, arg(call, "dst"));
+   PIPE_OR_RETURN(r, call);
+
+   if (!dst)
+      return;
+
+   /* the fill value is not in the trace */
+   replay_begin(r);
+   pipe->surface_fill(pipe,
+                      dst,
+                      value_uint(arg(call, "dstx")),
+                      value_uint(arg(call, "dsty")),
+                      value_uint(arg(call, "width")),
+                      value_uint(arg(call, "height")),
+                      0);
+   replay_end(r);
+}
+
+
+static void
+replay_clear(struct replay *r, const struct call *call)
+{
+   float rgba[4];
+   PIPE_OR_RETURN(r, call);
+
+   value_floats(arg(call, "rgba"), rgba, 4);
+
+   replay_begin(r);
+   pipe->clear(pipe,
+               value_uint(arg(call, "buffers")),
+               rgba,
+               value_float(arg(call, "depth")),
+               value_uint(arg(call, "stencil")));
+   replay_end(r);
+}
+
+
+static void
+replay_flush(struct replay *r, const struct call *call)
+{
+   unsigned flags = value_uint(arg(call, "flags"));
+   PIPE_OR_RETURN(r, call);
+
+   replay_begin(r);
+   pipe->flush(pipe, flags, NULL);
+   replay_end(r);
+
+   if (flags & PIPE_FLUSH_FRAME)
+      replay_end_frame(r);
+}
+
+
+static void
+replay_is_texture_referenced(struct replay *r, const struct call *call)
+{
+   struct pipe_texture *texture = value_object(r, arg(call, "texture"));
+   PIPE_OR_RETURN(r, call);
+
+   if (!texture)
+      return;
+
+   replay_begin(r);
+   pipe->is_texture_referenced(pipe, texture,
+                               value_uint(arg(call, "face")),
+                               value_uint(arg(call, "level")));
+   replay_end(r);
+}
+
+
+static void
+replay_is_buffer_referenced(struct replay *r, const struct call *call)
+{
+   struct pipe_buffer *buf = value_object(r, arg(call, "buf"));
+   PIPE_OR_RETURN(r, call);
+
+   if (!buf)
+      return;
+
+   replay_begin(r);
+   pipe->is_buffer_referenced(pipe, buf);
+   replay_end(r);
+}
+
+
+struct handler
+{
+   const char *klass;
+   const char *method;
+   /** NULL for calls that are deliberately skipped */
+   void (*func)(struct replay *r, const struct call *call);
+};
+
+
+static const struct handler handlers[] = {
+   { "", "pipe_screen_create", replay_pipe_screen_create },
+   { "", "pipe_context_create", replay_pipe_context_create },
+
+   { "pipe_screen", "destroy", replay_screen_destroy },
+   { "pipe_screen", "get_name", NULL },
+   { "pipe_screen", "get_vendor", NULL },
+   { "pipe_screen", "get_param", NULL },
+   { "pipe_screen", "get_paramf", NULL },
+   { "pipe_screen", "is_format_supported", NULL },
+   { "pipe_screen", "texture_create", replay_texture_create },
+   { "pipe_screen", "texture_destroy", replay_texture_destroy },
+   { "pipe_screen", "get_tex_surface", replay_get_tex_surface },
+   { "pipe_screen", "tex_surface_destroy", replay_tex_surface_destroy },
+   { "pipe_screen", "get_tex_transfer", replay_get_tex_transfer },
+   { "pipe_screen", "tex_transfer_destroy", replay_tex_transfer_destroy },
+   { "pipe_screen", "transfer_write", replay_transfer_write },
+   { "pipe_screen", "buffer_create", replay_buffer_create },
+   { "pipe_screen", "user_buffer_create", replay_user_buffer_create },
+   { "pipe_screen", "buffer_write", replay_buffer_write },
+   { "pipe_screen", "buffer_destroy", replay_buffer_destroy },
+   { "pipe_screen", "fence_reference", NULL },
+   { "pipe_screen", "fence_signalled", NULL },
+   { "pipe_screen", "fence_finish", NULL },
+   { "pipe_screen", "flush_frontbuffer", replay_flush_frontbuffer },
+
+   { "pipe_context", "destroy", replay_context_destroy },
+   { "pipe_context", "set_edgeflags", NULL },
+   { "pipe_context", "draw_arrays", replay_draw_arrays },
+   { "pipe_context", "draw_elements", replay_draw_elements },
+   { "pipe_context", "draw_range_elements", replay_draw_range_elements },
+   { "pipe_context", "create_query", replay_create_query },
+   { "pipe_context", "destroy_query", replay_destroy_query },
+   { "pipe_context", "begin_query", replay_begin_query },
+   { "pipe_context", "end_query", replay_end_query },
+   { "pipe_context", "get_query_result", NULL },
+   { "pipe_context", "create_blend_state", replay_create_blend_state },
+   { "pipe_context", "bind_blend_state", replay_bind_blend_state },
+   { "pipe_context", "delete_blend_state", replay_delete_blend_state },
+   { "pipe_context", "create_sampler_state", replay_create_sampler_state },
+   { "pipe_context", "bind_sampler_states", replay_bind_sampler_states },
+   { "pipe_context", "delete_sampler_state", replay_delete_sampler_state },
+   { "pipe_context", "create_rasterizer_state", replay_create_rasterizer_state },
+   { "pipe_context", "bind_rasterizer_state", replay_bind_rasterizer_state },
+   { "pipe_context", "delete_rasterizer_state", replay_delete_rasterizer_state },
+   { "pipe_context", "create_depth_stencil_alpha_state", replay_create_depth_stencil_alpha_state },
+   { "pipe_context", "bind_depth_stencil_alpha_state", replay_bind_depth_stencil_alpha_state },
+   { "pipe_context", "delete_depth_stencil_alpha_state", replay_delete_depth_stencil_alpha_state },
+   { "pipe_context", "create_fs_state", replay_create_fs_state },
+   { "pipe_context", "bind_fs_state", replay_bind_fs_state },
+   { "pipe_context", "delete_fs_state", replay_delete_fs_state },
+   { "pipe_context", "create_vs_state", replay_create_vs_state },
+   { "pipe_context", "bind_vs_state", replay_bind_vs_state },
+   { "pipe_context", "delete_vs_state", replay_delete_vs_state },
+   { "pipe_context", "set_blend_color", replay_set_blend_color },
+   { "pipe_context", "set_clip_state", replay_set_clip_state },
+   { "pipe_context", "set_constant_buffer", replay_set_constant_buffer },
+   { "pipe_context", "set_framebuffer_state", replay_set_framebuffer_state },
+   { "pipe_context", "set_polygon_stipple", replay_set_polygon_stipple },
+   { "pipe_context", "set_scissor_state", replay_set_scissor_state },
+   { "pipe_context", "set_viewport_state", replay_set_viewport_state },
+   { "pipe_context", "set_sampler_textures", replay_set_sampler_textures },
+   { "pipe_context", "set_vertex_buffers", replay_set_vertex_buffers },
+   { "pipe_context", "set_vertex_elements", replay_set_vertex_elements },
+   { "pipe_context", "surface_copy", replay_surface_copy },
+   { "pipe_context", "surface_fill", replay_surface_fill },
+   { "pipe_context", "clear", replay_clear },
+   { "pipe_context", "flush", replay_flush },
+   { "pipe_context", "is_texture_referenced", replay_is_texture_referenced },
+   { "pipe_context", "is_buffer_referenced", replay_is_buffer_referenced },
+};
+
+
+static int
+find_handler(const char *klass, const char *method)
+{
+   unsigned i;
+
+   for (i = 0; i < Elements(handlers); ++i) {
+      if (strcmp(handlers[i].klass, klass) == 0 &&
+          strcmp(handlers[i].method, method) == 0)
+         return (int)i;
+   }
+
+   return -1;
+}
+
+
+/*
+ * Replay and report.
+ */
+
+static unsigned
+pointer_hash(void *key)
+{
+   uintptr_t p = (uintptr_t)key;
+   return (unsigned)(p >> 4) ^ (unsigned)((uint64_t)p >> 32);
+}
+
+
+static int
+pointer_compare(void *key1, void *key2)
+{
+   return key1 != key2;
+}
+
+
+static void
+replay_run(struct replay *r)
+{
+   unsigned i;
+
+   r->frame_start = replay_nanos();
+
+   for (i = 0; i < r->num_calls; ++i) {
+      const struct call *call = &r->calls[i];
+      struct call_stats *stats;
+
+      if (call->handler < 0 || !handlers[call->handler].func)
+         continue;
+
+      r->call_no = call->no;
+      r->elapsed = 0;
+      handlers[call->handler].func(r, call);
+
+      stats = &r->stats[call->handler];
+      stats->count++;
+      stats->nanos += r->elapsed;
+   }
+
+   /* whatever the trace did not destroy is leaked */
+   hash_table_clear(r->objects);
+}
+
+
+static const struct call_stats *sort_stats;
+
+static int
+compare_handlers(const void *a, const void *b)
+{
+   int64_t ta = sort_stats[*(const unsigned *)a].nanos;
+   int64_t tb = sort_stats[*(const unsigned *)b].nanos;
+   return ta < tb ? 1 : ta > tb ? -1 : 0;
+}
+
+
+static void
+report(const struct replay *r, unsigned loops, boolean print_frames)
+{
+   unsigned order[Elements(handlers)];
+   int64_t total = 0, frames_total = 0;
+   int64_t min_frame = 0, max_frame = 0;
+   unsigned long unknown = 0;
+   unsigned i;
+
+   for (i = 0; i < r->num_calls; ++i)
+      if (r->calls[i].handler < 0)
+         ++unknown;
+   printf("driver: %s\n\n", r->driver->name);
+
+   if (unknown)
+      printf("skipped %lu calls without a handler\n\n", unknown);
+
+   for (i = 0; i < Elements(handlers); ++i) {
+      order[i] = i;
+      total += r->stats[i].nanos;
+   }
+
+   sort_stats = r->stats;
+   qsort(order, Elements(handlers), sizeof order[0], compare_handlers);
+
+   printf("%-48s %10s %12s %10s %6s\n",
+          "call", "count", "total ms", "avg us", "%");
+   for (i = 0; i < Elements(handlers); ++i) {
+      const struct handler *h = &handlers[order[i]];
+      const struct call_stats *stats = &r->stats[order[i]];
+      char name[128];
+
+      if (!stats->count)
+         continue;
+
+      util_snprintf(name, sizeof name, "%s%s%s",
+                    h->klass, h->klass[0] ? "::" : "", h->method);
+      printf("%-48s %10lu %12.3f %10.3f %6.2f\n",
+             name,
+             stats->count,
+             stats->nanos * 1e-6,
+             stats->nanos * 1e-3 / stats->count,
+             total ? stats->nanos * 100.0 / total : 0.0);
+   }
+   printf("%-48s %10s %12.3f\n\n", "total", "", total * 1e-6);
+
+   if (!r->num_frames) {
+      printf("no frames (no PIPE_FLUSH_FRAME flushes or flush_frontbuffer calls)\n");
+      return;
+   }
+
+   for (i = 0; i < r->num_frames; ++i) {
+      int64_t t = r->frames[i];
+      if (print_frames)
+         printf("frame %u: %.3f ms\n", i, t * 1e-6);
+      if (!i || t < min_frame)
+         min_frame = t;
+      if (!i || t > max_frame)
+         max_frame = t;
+      frames_total += t;
+   }
+   if (print_frames)
+      printf("\n");
+
+   printf("%u frames in %u loops: min %.3f ms, avg %.3f ms, max %.3f ms, %.2f fps\n",
+          r->num_frames, loops,
+          min_frame * 1e-6,
+          frames_total * 1e-6 / r->num_frames,
+          max_frame * 1e-6,
+          frames_total ? r->num_frames * 1e9 / frames_total : 0.0);
+}
+
+
+static void
+usage(const char *name)
+{
+   unsigned i;
+
+   fprintf(stderr, "usage: %s [-d driver] [-n loops] [-f] <binary trace>\n", name);
+   fprintf(stderr, "  -d driver replay on this driver (default %s):", drivers[0].name);
+   for (i = 0; i < Elements(drivers); ++i)
+      fprintf(stderr, " %s", drivers[i].name);
+   fprintf(stderr, "\n");
+   fprintf(stderr, "  -n loops  replay the trace this many times\n");
+   fprintf(stderr, "  -f        print the time of every frame\n");
+}
+
+
+static const struct replay_driver *
+find_driver(const char *name)
+{
+   unsigned i;
+
+   for (i = 0; i < Elements(drivers); ++i) {
+      if (strcmp(drivers[i].name, name) == 0)
+         return &drivers[i];
+   }
+
+   return NULL;
+}
+
+
+int main(int argc, char **argv)
+{
+   struct replay r;
+   const char *filename = NULL;
+   const struct replay_driver *driver = &drivers[0];
+   unsigned loops = 1;
+   boolean print_frames = FALSE;
+   unsigned i;
+   int ret = 0;
+
+   for (i = 1; i < (unsigned)argc; ++i) {
+      if (strcmp(argv[i], "-d") == 0 && i + 1 < (unsigned)argc) {
+         driver = find_driver(argv[++i]);
+         if (!driver) {
+            fprintf(stderr, "%s: unknown driver %s\n", argv[0], argv[i]);
+            usage(argv[0]);
+            return 1;
+         }
+      }
+      else if (strcmp(argv[i], "-n") == 0 && i + 1 < (unsigned)argc) {
+         int n = atoi(argv[++i]);
+         loops = n > 0 ? n : 1;
+      }
+      else if (strcmp(argv[i], "-f") == 0)
+         print_frames = TRUE;
+      else if (argv[i][0] != '-' && !filename)
+         filename = argv[i];
+      else {
+         usage(argv[0]);
+         return 1;
+      }
+   }
+
+   if (!filename) {
+      usage(argv[0]);
+      return 1;
+   }
+
+   memset(&r, 0, sizeof r);
+   r.driver = driver;
+   r.stats = CALLOC(Elements(handlers), sizeof *r.stats);
+   r.objects = hash_table_create(pointer_hash, pointer_compare);
+   if (!r.stats || !r.objects) {
+      fprintf(stderr, "%s: out of memory\n", argv[0]);
+      return 1;
+   }
+
+   if (!load_trace(&r, filename)) {
+      ret = 1;
+      goto out;
+   }
+
+   for (i = 0; i < loops; ++i)
+      replay_run(&r);
+
+   report(&r, loops, print_frames);
+
+out:
+   if (r.reader)
+      trace_reader_close(r.reader);
+   hash_table_destroy(r.objects);
+   pool_destroy(&r);
+   FREE(r.calls);
+   FREE(r.frames);
+   FREE(r.stats);
+   return ret;
+}
@@ -0,0 +1,383 @@
+/*
+ * Copyright 2009 VMware, Inc.
+ * All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * on the rights to use, copy, modify, merge, publish, distribute, sub
+ * license, and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT.  IN NO EVENT SHALL
+ * VMWARE AND/OR THEIR SUPPLIERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <stdio.h>
+
+#include "util/u_memory.h"
+#include "util/u_math.h"
+#include "util/u_debug.h"
+
+#include "trace_reader.h"
+
+
+/** Growable array of strings or blobs, indexed by id - 1 */
+struct trace_table
+{
+   void **data;
+   size_t *size;
+   unsigned count;
+   unsigned max;
+};
+
+
+struct trace_reader
+{
+   FILE *file;
+   boolean error;
+
+   struct trace_table strings;
+   struct trace_table blobs;
+
+   /** Inline bytes and strings */
+   uint8_t *scratch;
+   size_t scratch_size;
+};
+
+
+static boolean
+trace_table_set(struct trace_table *table, uint64_t id,
+                void *data, size_t size)
+{
+   if (id == 0 || id > table->count + 1) {
+      FREE(data);
+      return FALSE;
+   }
+
+   if (id > table->max) {
+      unsigned max = table->max ? table->max * 2 : 256;
+      table->data = REALLOC(table->data, table->max * sizeof *table->data,
+                            max * sizeof *table->data);
+      table->size = REALLOC(table->size, table->max * sizeof *table->size,
+                            max * sizeof *table->size);
+      if (!table->data || !table->size) {
+         FREE(data);
+         return FALSE;
+      }
+      table->max = max;
+   }
+
+   if (id > table->count)
+      table->count = (unsigned)id;
+   else
+      FREE(table->data[id - 1]);
+
+   table->data[id - 1] = data;
+   table->size[id - 1] = size;
+   return TRUE;
+}
+
+
+static void
+trace_table_destroy(struct trace_table *table)
+{
+   unsigned i;
+   for (i = 0; i < table->count; ++i)
+      FREE(table->data[i]);
+   FREE(table->data);
+   FREE(table->size);
+}
+
+
+static boolean
+read_varint(struct trace_reader *reader, uint64_t *value)
+{
+   uint64_t v = 0;
+   unsigned shift = 0;
+   int c;
+
+   do {
+      c = getc(reader->file);
+      if (c == EOF || shift > 63) {
+         reader->error = TRUE;
+         return FALSE;
+      }
+      v |= (uint64_t)(c & 0x7f) << shift;
+      shift += 7;
+   } while (c & 0x80);
+
+   *value = v;
+   return TRUE;
+}
+
+
+/**
+ * Read size bytes into freshly allocated memory, nul terminated.
+ */
+static void *
+read_data(struct trace_reader *reader, size_t size)
+{
+   uint8_t *data = MALLOC(size + 1);
+   if (!data || fread(data, 1, size, reader->file) != size) {
+      FREE(data);
+      reader->error = TRUE;
+      return NULL;
+   }
+   data[size] = 0;
+   return data;
+}
+
+
+/**
+ * Read size bytes into the scratch buffer, nul terminated.
+ */
+static void *
+read_scratch(struct trace_reader *reader, size_t size)
+{
+   if (size + 1 > reader->scratch_size) {
+      FREE(reader->scratch);
+      reader->scratch_size = MAX2(size + 1, 2 * reader->scratch_size);
+      reader->scratch = MALLOC(reader->scratch_size);
+      if (!reader->scratch) {
+         reader->scratch_size = 0;
+         reader->error = TRUE;
+         return NULL;
+      }
+   }
+
+   if (fread(reader->scratch, 1, size, reader->file) != size) {
+      reader->error = TRUE;
+      return NULL;
+   }
+   reader->scratch[size] = 0;
+   return reader->scratch;
+}
+
+
+static const char *
+read_name(struct trace_reader *reader)
+{
+   uint64_t id;
+
+   if (!read_varint(reader, &id))
+      return NULL;
+
+   if (id == 0 || id > reader->strings.count) {
+      reader->error = TRUE;
+      return NULL;
+   }
+
+   return (const char *)reader->strings.data[id - 1];
+}
+
+
+/**
+ * Read a string or blob definition into the given table.
+ */
+static boolean
+read_def(struct trace_reader *reader, struct trace_table *table)
+{
+   uint64_t id, size;
+   void *data;
+
+   if (!read_varint(reader, &id) || !read_varint(reader, &size))
+      return FALSE;
+
+   data = read_data(reader, (size_t)size);
+   if (!data)
+      return FALSE;
+
+   if (!trace_table_set(table, id, data, (size_t)size)) {
+      reader->error = TRUE;
+      return FALSE;
+   }
+
+   return TRUE;
+}
+
+
+struct trace_reader *
+trace_reader_open(const char *filename)
+{
+   struct trace_reader *reader;
+   char header[8];
+
+   reader = CALLOC_STRUCT(trace_reader);
+   if (!reader)
+      return NULL;
+
+   reader->file = fopen(filename, "rb");
+   if (!reader->file) {
+      FREE(reader);
+      return NULL;
+   }
+
+   if (fread(header, 1, 8, reader->file) != 8 ||
+       memcmp(header, TR_BIN_MAGIC, 4) != 0 ||
+       (uint8_t)header[4] != TR_BIN_VERSION) {
+      debug_printf("%s: not a binary trace\n", filename);
+      fclose(reader->file);
+      FREE(reader);
+      return NULL;
+   }
+
+   return reader;
+}
+
+
+boolean
+trace_reader_next(struct trace_reader *reader, struct trace_token *token)
+{
+   uint64_t v;
+   int op;
+
+   memset(token, 0, sizeof *token);
+
+   for (;;) {
+      op = getc(reader->file);
+      if (op == EOF)
+         return FALSE;
+
+      if (op == TR_BIN_STRING_DEF) {
+         if (!read_def(reader, &reader->strings))
+            return FALSE;
+      }
+      else if (op == TR_BIN_BLOB_DEF) {
+         if (!read_def(reader, &reader->blobs))
+            return FALSE;
+      }
+      else
+         break;
+   }
+
+   token->op = op;
+
+   switch (op) {
+   case TR_BIN_CALL_BEGIN:
+      if (!read_varint(reader, &v))
+         return FALSE;
+      token->call_no = (unsigned long)v;
+      token->name = read_name(reader);
+      token->method = read_name(reader);
+      if (!token->name || !token->method)
+         return FALSE;
+      break;
+
+   case TR_BIN_ARG_BEGIN:
+   case TR_BIN_ENUM:
+   case TR_BIN_STRUCT_BEGIN:
+   case TR_BIN_MEMBER_BEGIN:
+      token->name = read_name(reader);
+      if (!token->name)
+         return FALSE;
+      break;
+
+   case TR_BIN_BOOL:
+      {
+         int c = getc(reader->file);
+         if (c == EOF) {
+            reader->error = TRUE;
+            return FALSE;
+         }
+         token->ival = c ? 1 : 0;
+      }
+      break;
+
+   case TR_BIN_INT:
+      if (!read_varint(reader, &v))
+         return FALSE;
+      token->ival = (long long)((v >> 1) ^ (~(v & 1) + 1));
+      break;
+
+   case TR_BIN_UINT:
+   case TR_BIN_PTR:
+      if (!read_varint(reader, &v))
+         return FALSE;
+      token->uval = v;
+      break;
+
+   case TR_BIN_FLOAT:
+      {
+         uint8_t buf[8];
+         unsigned i;
+         if (fread(buf, 1, 8, reader->file) != 8) {
+            reader->error = TRUE;
+            return FALSE;
+         }
+         v = 0;
+         for (i = 0; i < 8; ++i)
+            v |= (uint64_t)buf[i] << (i * 8);
+         memcpy(&token->fval, &v, 8);
+      }
+      break;
+
+   case TR_BIN_BYTES:
+   case TR_BIN_STRING:
+      if (!read_varint(reader, &v))
+         return FALSE;
+      token->size = (size_t)v;
+      token->data = read_scratch(reader, token->size);
+      if (!token->data)
+         return FALSE;
+      break;
+
+   case TR_BIN_BLOB:
+      if (!read_varint(reader, &v))
+         return FALSE;
+      if (v == 0 || v > reader->blobs.count) {
+         reader->error = TRUE;
+         return FALSE;
+      }
+      token->data = reader->blobs.data[v - 1];
+      token->size = reader->blobs.size[v - 1];
+      break;
+
+   case TR_BIN_CALL_END:
+   case TR_BIN_ARG_END:
+   case TR_BIN_RET_BEGIN:
+   case TR_BIN_RET_END:
+   case TR_BIN_ARRAY_BEGIN:
+   case TR_BIN_ARRAY_END:
+   case TR_BIN_ELEM_BEGIN:
+   case TR_BIN_ELEM_END:
+   case TR_BIN_STRUCT_END:
+   case TR_BIN_MEMBER_END:
+   case TR_BIN_NULL:
+      break;
+
+   default:
+      debug_printf("unknown trace opcode %d\n", op);
+      reader->error = TRUE;
+      return FALSE;
+   }
+
+   return TRUE;
+}
+
+
+boolean
+trace_reader_error(const struct trace_reader *reader)
+{
+   return reader->error;
+}
+
+
+void
+trace_reader_close(struct trace_reader *reader)
+{
+   fclose(reader->file);
+   trace_table_destroy(&reader->strings);
+   trace_table_destroy(&reader->blobs);
+   FREE(reader->scratch);
+   FREE(reader);
+}
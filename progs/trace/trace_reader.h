@@ -0,0 +1,83 @@
+/*
+ * Copyright 2009 VMware, Inc.
+ * All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * on the rights to use, copy, modify, merge, publish, distribute, sub
+ * license, and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT.  IN NO EVENT SHALL
+ * VMWARE AND/OR THEIR SUPPLIERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Sequential reader for binary traces written by the trace driver with
+ * GALLIUM_TRACE_BINARY set.  See src/gallium/drivers/trace/tr_dump_bin.h
+ * for the format.
+ */
+
+#ifndef TRACE_READER_H
+#define TRACE_READER_H
+
+#include "pipe/p_compiler.h"
+#include "trace/tr_dump_bin.h"
+
+
+struct trace_reader;
+
+/**
+ * One record of the trace.  The string and name definitions are
+ * consumed by the reader and never returned.
+ */
+struct trace_token
+{
+   unsigned op;                 /**< enum tr_bin_opcode */
+
+   unsigned long call_no;       /**< TR_BIN_CALL_BEGIN */
+   const char *name;            /**< class, or arg/struct/member/enum name */
+   const char *method;          /**< TR_BIN_CALL_BEGIN */
+
+   long long ival;              /**< TR_BIN_INT, TR_BIN_BOOL */
+   unsigned long long uval;     /**< TR_BIN_UINT, TR_BIN_PTR */
+   double fval;                 /**< TR_BIN_FLOAT */
+
+   /**
+    * TR_BIN_BYTES, TR_BIN_BLOB and TR_BIN_STRING (nul terminated).
+    * Blob data stays valid until the reader is closed, the others only
+    * until the next call to trace_reader_next().
+    */
+   const void *data;
+   size_t size;
+};
+
+
+struct trace_reader *
+trace_reader_open(const char *filename);
+
+/**
+ * Read the next record.  Returns FALSE at the end of the trace or if
+ * the trace is malformed (see trace_reader_error()).
+ */
+boolean
+trace_reader_next(struct trace_reader *reader, struct trace_token *token);
+
+boolean
+trace_reader_error(const struct trace_reader *reader);
+
+void
+trace_reader_close(struct trace_reader *reader);
+
+
+#endif /* TRACE_READER_H */
@@ -285,6 +285,25 @@ draw_enable_point_sprites(struct draw_context *draw, boolean enable)
 }
 
 
+/**
+ * Tell the draw module the window coordinate range the rasterizer can
+ * handle (its guard band).  Filled triangles lying inside it aren't
+ * clipped against the viewport x/y planes, so the driver must scissor
+ * to the viewport itself.  An empty range disables guard band clipping.
+ */
+void
+draw_set_guard_band(struct draw_context *draw,
+                    float xmin, float ymin, float xmax, float ymax)
+{
+   draw_do_flush( draw, DRAW_FLUSH_STATE_CHANGE );
+   draw->guard_band.enabled = (xmin < xmax && ymin < ymax);
+   draw->guard_band.xmin = xmin;
+   draw->guard_band.ymin = ymin;
+   draw->guard_band.xmax = xmax;
+   draw->guard_band.ymax = ymax;
+}
+
+
 void
 draw_set_force_passthrough( struct draw_context *draw, boolean enable )
 {
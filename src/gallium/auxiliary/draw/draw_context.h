@@ -72,6 +72,9 @@ void draw_enable_line_stipple(struct draw_context *draw, boolean enable);
 
 void draw_enable_point_sprites(struct draw_context *draw, boolean enable);
 
+void draw_set_guard_band(struct draw_context *draw,
+                         float xmin, float ymin, float xmax, float ymax);
+
 void draw_set_mrd(struct draw_context *draw, double mrd);
 
 boolean
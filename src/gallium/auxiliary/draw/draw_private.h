@@ -217,6 +217,12 @@ struct draw_context
    float plane[12][4];
    unsigned nr_planes;
 
+   /** Rasterizer guard band, in window coords, see draw_set_guard_band() */
+   struct {
+      boolean enabled;
+      float xmin, ymin, xmax, ymax;
+   } guard_band;
+
    /* If a prim stage introduces new vertex attributes, they'll be stored here
     */
    struct {
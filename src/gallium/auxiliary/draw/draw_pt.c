@@ -93,9 +93,12 @@ draw_pt_arrays(struct draw_context *draw,
       }
    }
       
+   /* The fetch/shade/emit path does its own cliptest, handing any
+    * batch which needs clipping to the general middle-end.
+    */
    if (opt == 0) 
       middle = draw->pt.middle.fetch_emit;
-   else if (opt == PT_SHADE && !draw->pt.no_fse)
+   else if ((opt & ~PT_CLIPTEST) == PT_SHADE && !draw->pt.no_fse)
       middle = draw->pt.middle.fetch_shade_emit;
    else
       middle = draw->pt.middle.general;
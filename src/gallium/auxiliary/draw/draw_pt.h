@@ -215,10 +215,15 @@ boolean draw_pt_post_vs_run( struct pt_post_vs *pvs,
 			     unsigned count );
 
 void draw_pt_post_vs_prepare( struct pt_post_vs *pvs,
+			      unsigned prim,
 			      boolean bypass_clipping,
 			      boolean bypass_viewport,
 			      boolean opengl );
 
+void draw_pt_clip_limits( const struct draw_context *draw,
+                          unsigned prim,
+                          float limits[4] );
+
 struct pt_post_vs *draw_pt_post_vs_create( struct draw_context *draw );
 
 void draw_pt_post_vs_destroy( struct pt_post_vs *pvs );
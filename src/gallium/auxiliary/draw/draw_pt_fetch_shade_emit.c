@@ -64,6 +64,13 @@ struct fetch_shade_emit {
 
 
    const struct vertex_info *vinfo;
+
+   /* When cliptesting, the x/y clip limits and whether the general
+    * middle-end has been prepared to take batches which need clipping:
+    */
+   unsigned opt;
+   float clip_limits[4];
+   boolean fallback_prepared;
 };
 
 
@@ -81,6 +88,9 @@ static void fse_prepare( struct draw_pt_middle_end *middle,
    unsigned i;
    unsigned nr_vbs = 0;
    
+   fse->prim = prim;
+   fse->opt = opt;
+   fse->fallback_prepared = FALSE;
 
    if (!draw->render->set_primitive( draw->render, 
                                      prim )) {
@@ -180,6 +190,9 @@ static void fse_prepare( struct draw_pt_middle_end *middle,
       return ;
    }
 
+   if (opt & PT_CLIPTEST)
+      draw_pt_clip_limits( draw, prim, fse->clip_limits );
+
    if (0) debug_printf("%s: found const_vbuffers: %x\n", __FUNCTION__, 
                        fse->active->key.const_vbuffers);
 
@@ -223,18 +236,59 @@ static void fse_prepare( struct draw_pt_middle_end *middle,
 
 
 
+/* Batches which need clipping, or all of them if the varient can't
+ * cliptest, are handed to the general middle-end instead.  It is
+ * prepared on first use, and the render primitive reset afterwards
+ * as the pipeline may have changed it.
+ */
+static struct draw_pt_middle_end *fse_fallback( struct fetch_shade_emit *fse )
+{
+   struct draw_pt_middle_end *general = fse->draw->pt.middle.general;
+
+   if (!fse->fallback_prepared) {
+      unsigned max_vertices;
+
+      general->prepare( general, fse->prim, fse->opt, &max_vertices );
+      fse->fallback_prepared = TRUE;
+   }
+
+   return general;
+}
+
+
+static boolean fse_need_fallback( struct fetch_shade_emit *fse,
+                                  boolean elts )
+{
+   if (!(fse->opt & PT_CLIPTEST))
+      return FALSE;
+
+   if (elts)
+      return fse->active->run_elts_cliptest == NULL;
+   else
+      return fse->active->run_linear_cliptest == NULL;
+}
+
+
 static void fse_run_linear( struct draw_pt_middle_end *middle, 
                             unsigned start, 
                             unsigned count )
 {
    struct fetch_shade_emit *fse = (struct fetch_shade_emit *)middle;
    struct draw_context *draw = fse->draw;
+   struct draw_pt_middle_end *general;
    char *hw_verts;
 
+   if (fse_need_fallback( fse, FALSE ))
+      goto fallback;
+
    /* XXX: need to flush to get prim_vbuf.c to release its allocation??
     */
    draw_do_flush( draw, DRAW_FLUSH_BACKEND );
 
+   if (fse->fallback_prepared &&
+       !draw->render->set_primitive( draw->render, fse->prim ))
+      goto fail;
+
    if (count >= UNDEFINED_VERTEX_ID) 
       goto fail;
 
@@ -248,12 +302,24 @@ static void fse_run_linear( struct draw_pt_middle_end *middle,
       goto fail;
 
    /* Single routine to fetch vertices, run shader and emit HW verts.
-    * Clipping is done elsewhere -- either by the API or on hardware,
-    * or for some other reason not required...
+    * Clipping is either not required, or was tested for and isn't
+    * needed by any of these vertices.
     */
-   fse->active->run_linear( fse->active, 
-                            start, count,
-                            hw_verts );
+   if (fse->opt & PT_CLIPTEST) {
+      if (!fse->active->run_linear_cliptest( fse->active, 
+                                             start, count,
+                                             fse->clip_limits,
+                                             hw_verts )) {
+         draw->render->unmap_vertices( draw->render, 0, (ushort)(count - 1) );
+         draw->render->release_vertices( draw->render );
+         goto fallback;
+      }
+   }
+   else {
+      fse->active->run_linear( fse->active, 
+                               start, count,
+                               hw_verts );
+   }
 
 
    if (0) {
@@ -282,6 +348,11 @@ static void fse_run_linear( struct draw_pt_middle_end *middle,
 
    return;
 
+fallback:
+   general = fse_fallback( fse );
+   general->run_linear( general, start, count );
+   return;
+
 fail:
    assert(0);
    return;
@@ -297,12 +368,20 @@ fse_run(struct draw_pt_middle_end *middle,
 {
    struct fetch_shade_emit *fse = (struct fetch_shade_emit *)middle;
    struct draw_context *draw = fse->draw;
+   struct draw_pt_middle_end *general;
    void *hw_verts;
+
+   if (fse_need_fallback( fse, TRUE ))
+      goto fallback;
    
    /* XXX: need to flush to get prim_vbuf.c to release its allocation?? 
     */
    draw_do_flush( draw, DRAW_FLUSH_BACKEND );
 
+   if (fse->fallback_prepared &&
+       !draw->render->set_primitive( draw->render, fse->prim ))
+      goto fail;
+
    if (fetch_count >= UNDEFINED_VERTEX_ID) 
       goto fail;
 
@@ -318,10 +397,23 @@ fse_run(struct draw_pt_middle_end *middle,
 					
    /* Single routine to fetch vertices, run shader and emit HW verts.
     */
-   fse->active->run_elts( fse->active, 
-                          fetch_elts,
-                          fetch_count,
-                          hw_verts );
+   if (fse->opt & PT_CLIPTEST) {
+      if (!fse->active->run_elts_cliptest( fse->active, 
+                                           fetch_elts,
+                                           fetch_count,
+                                           fse->clip_limits,
+                                           hw_verts )) {
+         draw->render->unmap_vertices( draw->render, 0, (ushort)(fetch_count - 1) );
+         draw->render->release_vertices( draw->render );
+         goto fallback;
+      }
+   }
+   else {
+      fse->active->run_elts( fse->active, 
+                             fetch_elts,
+                             fetch_count,
+                             hw_verts );
+   }
 
 
    if (0) {
@@ -344,6 +436,11 @@ fse_run(struct draw_pt_middle_end *middle,
    draw->render->release_vertices( draw->render );
    return;
 
+fallback:
+   general = fse_fallback( fse );
+   general->run( general, fetch_elts, fetch_count, draw_elts, draw_count );
+   return;
+
 fail:
    assert(0);
    return;
@@ -359,12 +456,20 @@ static boolean fse_run_linear_elts( struct draw_pt_middle_end *middle,
 {
    struct fetch_shade_emit *fse = (struct fetch_shade_emit *)middle;
    struct draw_context *draw = fse->draw;
+   struct draw_pt_middle_end *general;
    char *hw_verts;
 
+   if (fse_need_fallback( fse, FALSE ))
+      goto fallback;
+
    /* XXX: need to flush to get prim_vbuf.c to release its allocation??
     */
    draw_do_flush( draw, DRAW_FLUSH_BACKEND );
 
+   if (fse->fallback_prepared &&
+       !draw->render->set_primitive( draw->render, fse->prim ))
+      return FALSE;
+
    if (count >= UNDEFINED_VERTEX_ID)
       return FALSE;
 
@@ -378,12 +483,22 @@ static boolean fse_run_linear_elts( struct draw_pt_middle_end *middle,
       return FALSE;
 
    /* Single routine to fetch vertices, run shader and emit HW verts.
-    * Clipping is done elsewhere -- either by the API or on hardware,
-    * or for some other reason not required...
     */
-   fse->active->run_linear( fse->active, 
-                            start, count,
-                            hw_verts );
+   if (fse->opt & PT_CLIPTEST) {
+      if (!fse->active->run_linear_cliptest( fse->active, 
+                                             start, count,
+                                             fse->clip_limits,
+                                             hw_verts )) {
+         draw->render->unmap_vertices( draw->render, 0, (ushort)(count - 1) );
+         draw->render->release_vertices( draw->render );
+         goto fallback;
+      }
+   }
+   else {
+      fse->active->run_linear( fse->active, 
+                               start, count,
+                               hw_verts );
+   }
 
 
    draw->render->draw( draw->render, 
@@ -396,12 +511,24 @@ static boolean fse_run_linear_elts( struct draw_pt_middle_end *middle,
    draw->render->release_vertices( draw->render );
 
    return TRUE;
+
+fallback:
+   general = fse_fallback( fse );
+   return general->run_linear_elts( general, start, count,
+                                    draw_elts, draw_count );
 }
 
 
 
 static void fse_finish( struct draw_pt_middle_end *middle )
 {
+   struct fetch_shade_emit *fse = (struct fetch_shade_emit *)middle;
+
+   if (fse->fallback_prepared) {
+      struct draw_pt_middle_end *general = fse->draw->pt.middle.general;
+      general->finish( general );
+      fse->fallback_prepared = FALSE;
+   }
 }
 
 
@@ -83,6 +83,7 @@ static void fetch_pipeline_prepare( struct draw_pt_middle_end *middle,
     * but gl vs dx9 clip spaces.
     */
    draw_pt_post_vs_prepare( fpme->post_vs,
+			    prim,
 			    (boolean)draw->bypass_clipping,
 			    (boolean)(draw->identity_viewport ||
                                       draw->rasterizer->bypass_vs_clip_and_viewport),
@@ -25,7 +25,10 @@
  *
  **************************************************************************/
 
+#include "util/u_math.h"
 #include "util/u_memory.h"
+#include "util/u_prim.h"
+#include "util/u_sse.h"
 #include "pipe/p_context.h"
 #include "draw/draw_context.h"
 #include "draw/draw_private.h"
@@ -36,6 +39,11 @@
 struct pt_post_vs {
    struct draw_context *draw;
 
+   /* Limits of the x/y clip tests in normalized device coords: the
+    * viewport is [-1,1], a guard band makes them wider.
+    */
+   float xmin, xmax, ymin, ymax;
+
    boolean (*run)( struct pt_post_vs *pvs,
 		struct vertex_header *vertices,
 		unsigned count,
@@ -56,7 +64,8 @@ dot4(const float *a, const float *b)
 
 
 static INLINE unsigned
-compute_clipmask_gl(const float *clip, /*const*/ float plane[][4], unsigned nr)
+compute_clipmask_gl(const struct pt_post_vs *pvs,
+                    const float *clip, /*const*/ float plane[][4], unsigned nr)
 {
    unsigned mask = 0x0;
    unsigned i;
@@ -69,10 +78,10 @@ compute_clipmask_gl(const float *clip, /*const*/ float plane[][4], unsigned nr)
 
    /* Do the hardwired planes first:
     */
-   if (-clip[0] + clip[3] < 0) mask |= (1<<0);
-   if ( clip[0] + clip[3] < 0) mask |= (1<<1);
-   if (-clip[1] + clip[3] < 0) mask |= (1<<2);
-   if ( clip[1] + clip[3] < 0) mask |= (1<<3);
+   if (clip[0] > pvs->xmax * clip[3]) mask |= (1<<0);
+   if (clip[0] < pvs->xmin * clip[3]) mask |= (1<<1);
+   if (clip[1] > pvs->ymax * clip[3]) mask |= (1<<2);
+   if (clip[1] < pvs->ymin * clip[3]) mask |= (1<<3);
    if ( clip[2] + clip[3] < 0) mask |= (1<<4); /* match mesa clipplane numbering - for now */
    if (-clip[2] + clip[3] < 0) mask |= (1<<5); /* match mesa clipplane numbering - for now */
 
@@ -115,7 +124,8 @@ static boolean post_vs_cliptest_viewport_gl( struct pt_post_vs *pvs,
       out->clip[3] = position[3];
 
       out->vertex_id = 0xffff;
-      out->clipmask = compute_clipmask_gl(out->clip, 
+      out->clipmask = compute_clipmask_gl(pvs,
+                                          out->clip, 
 					  pvs->draw->plane,
 					  pvs->draw->nr_planes);
       clipped += out->clipmask;
@@ -146,6 +156,112 @@ static boolean post_vs_cliptest_viewport_gl( struct pt_post_vs *pvs,
 }
 
 
+#if defined(PIPE_ARCH_SSE)
+
+/* As above, but the six hardwired planes are tested and the viewport
+ * mapping done for four vertices at a time.  Gives the same results.
+ */
+static boolean post_vs_cliptest_viewport_gl_sse( struct pt_post_vs *pvs,
+                                                 struct vertex_header *vertices,
+                                                 unsigned count,
+                                                 unsigned stride )
+{
+   struct draw_context *draw = pvs->draw;
+   const unsigned pos = draw->vs.position_output;
+   const unsigned nr_planes = draw->nr_planes;
+   const __m128 xmax = _mm_set1_ps(pvs->xmax);
+   const __m128 xmin = _mm_set1_ps(pvs->xmin);
+   const __m128 ymax = _mm_set1_ps(pvs->ymax);
+   const __m128 ymin = _mm_set1_ps(pvs->ymin);
+   const __m128 zero = _mm_setzero_ps();
+   const __m128 one = _mm_set1_ps(1.0f);
+   const __m128 sx = _mm_set1_ps(draw->viewport.scale[0]);
+   const __m128 sy = _mm_set1_ps(draw->viewport.scale[1]);
+   const __m128 sz = _mm_set1_ps(draw->viewport.scale[2]);
+   const __m128 tx = _mm_set1_ps(draw->viewport.translate[0]);
+   const __m128 ty = _mm_set1_ps(draw->viewport.translate[1]);
+   const __m128 tz = _mm_set1_ps(draw->viewport.translate[2]);
+   struct vertex_header *out = vertices;
+   unsigned clipped = 0;
+   unsigned j, k, i;
+
+   for (j = 0; j + 4 <= count; j += 4) {
+      struct vertex_header *v[4];
+      __m128 x, y, z, w, rw;
+      unsigned m[6];
+
+      for (k = 0; k < 4; k++) {
+         v[k] = out;
+         out = (struct vertex_header *)( (char *)out + stride );
+      }
+
+      x = _mm_loadu_ps(v[0]->data[pos]);
+      y = _mm_loadu_ps(v[1]->data[pos]);
+      z = _mm_loadu_ps(v[2]->data[pos]);
+      w = _mm_loadu_ps(v[3]->data[pos]);
+      _mm_storeu_ps(v[0]->clip, x);
+      _mm_storeu_ps(v[1]->clip, y);
+      _mm_storeu_ps(v[2]->clip, z);
+      _mm_storeu_ps(v[3]->clip, w);
+      _MM_TRANSPOSE4_PS(x, y, z, w);
+
+      /* one bit per vertex for each plane */
+      m[0] = _mm_movemask_ps(_mm_cmpgt_ps(x, _mm_mul_ps(xmax, w)));
+      m[1] = _mm_movemask_ps(_mm_cmplt_ps(x, _mm_mul_ps(xmin, w)));
+      m[2] = _mm_movemask_ps(_mm_cmpgt_ps(y, _mm_mul_ps(ymax, w)));
+      m[3] = _mm_movemask_ps(_mm_cmplt_ps(y, _mm_mul_ps(ymin, w)));
+      m[4] = _mm_movemask_ps(_mm_cmplt_ps(_mm_add_ps(z, w), zero));
+      m[5] = _mm_movemask_ps(_mm_cmplt_ps(_mm_sub_ps(w, z), zero));
+
+      /* divide by w and viewport mapping, only stored for the
+       * vertices that pass
+       */
+      rw = _mm_div_ps(one, w);
+      x = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(x, rw), sx), tx);
+      y = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(y, rw), sy), ty);
+      z = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(z, rw), sz), tz);
+      w = rw;
+      _MM_TRANSPOSE4_PS(x, y, z, w);
+
+      for (k = 0; k < 4; k++) {
+         unsigned mask = (((m[0] >> k) & 1) |
+                          (((m[1] >> k) & 1) << 1) |
+                          (((m[2] >> k) & 1) << 2) |
+                          (((m[3] >> k) & 1) << 3) |
+                          (((m[4] >> k) & 1) << 4) |
+                          (((m[5] >> k) & 1) << 5));
+
+         for (i = 6; i < nr_planes; i++) {
+            if (dot4(v[k]->clip, draw->plane[i]) < 0)
+               mask |= (1 << i);
+         }
+
+         v[k]->vertex_id = 0xffff;
+         v[k]->clipmask = mask;
+         clipped += mask;
+      }
+
+      if (!v[0]->clipmask)
+         _mm_storeu_ps(v[0]->data[pos], x);
+      if (!v[1]->clipmask)
+         _mm_storeu_ps(v[1]->data[pos], y);
+      if (!v[2]->clipmask)
+         _mm_storeu_ps(v[2]->data[pos], z);
+      if (!v[3]->clipmask)
+         _mm_storeu_ps(v[3]->data[pos], w);
+   }
+
+   if (j < count) {
+      if (post_vs_cliptest_viewport_gl( pvs, out, count - j, stride ))
+         clipped = 1;
+   }
+
+   return clipped != 0;
+}
+
+#endif /* PIPE_ARCH_SSE */
+
+
 
 /* If bypass_clipping is set, skip cliptest and rhw divide.
  */
@@ -198,7 +314,48 @@ boolean draw_pt_post_vs_run( struct pt_post_vs *pvs,
 }
 
 
+/**
+ * Work out the limits of the x/y clip tests in normalized device
+ * coords, as {xmin, xmax, ymin, ymax}.  Filled triangles may use the
+ * guard band mapped back through the viewport transform, but never
+ * narrower than the viewport itself.  Lines and points are still
+ * clipped exactly to the viewport.
+ */
+void draw_pt_clip_limits( const struct draw_context *draw,
+                          unsigned prim,
+                          float limits[4] )
+{
+   const float *scale = draw->viewport.scale;
+   const float *trans = draw->viewport.translate;
+   float lo, hi;
+
+   limits[0] = limits[2] = -1.0f;
+   limits[1] = limits[3] = 1.0f;
+
+   if (!draw->guard_band.enabled ||
+       u_reduced_prim(prim) != PIPE_PRIM_TRIANGLES ||
+       draw->rasterizer->fill_cw != PIPE_POLYGON_MODE_FILL ||
+       draw->rasterizer->fill_ccw != PIPE_POLYGON_MODE_FILL)
+      return;
+
+   if (scale[0] != 0.0f) {
+      lo = (draw->guard_band.xmin - trans[0]) / scale[0];
+      hi = (draw->guard_band.xmax - trans[0]) / scale[0];
+      limits[0] = MIN2(MIN2(lo, hi), -1.0f);
+      limits[1] = MAX2(MAX2(lo, hi), 1.0f);
+   }
+
+   if (scale[1] != 0.0f) {
+      lo = (draw->guard_band.ymin - trans[1]) / scale[1];
+      hi = (draw->guard_band.ymax - trans[1]) / scale[1];
+      limits[2] = MIN2(MIN2(lo, hi), -1.0f);
+      limits[3] = MAX2(MAX2(lo, hi), 1.0f);
+   }
+}
+
+
 void draw_pt_post_vs_prepare( struct pt_post_vs *pvs,
+			      unsigned prim,
 			      boolean bypass_clipping,
 			      boolean bypass_viewport,
 			      boolean opengl )
@@ -210,8 +367,20 @@ void draw_pt_post_vs_prepare( struct pt_post_vs *pvs,
 	 pvs->run = post_vs_viewport;
    }
    else {
+      float limits[4];
+
+      draw_pt_clip_limits( pvs->draw, prim, limits );
+      pvs->xmin = limits[0];
+      pvs->xmax = limits[1];
+      pvs->ymin = limits[2];
+      pvs->ymax = limits[3];
+
       //if (opengl) 
+#if defined(PIPE_ARCH_SSE)
+      pvs->run = post_vs_cliptest_viewport_gl_sse;
+#else
       pvs->run = post_vs_cliptest_viewport_gl;
+#endif
    }
 }
 
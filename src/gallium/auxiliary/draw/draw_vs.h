@@ -91,6 +91,25 @@ struct draw_vs_varient {
                                 unsigned count,
                                 void *output_buffer );
 
+   /* Optional.  As above, but the shaded positions are also tested
+    * against the view volume, widened in x/y to the given
+    * {xmin, xmax, ymin, ymax} NDC limits, and any user clip planes.
+    * Returns FALSE if some vertex needs clipping, in which case the
+    * contents of output_buffer are undefined and the caller must send
+    * the vertices down the clipping pipeline instead.
+    */
+   boolean (*run_linear_cliptest)( struct draw_vs_varient *shader,
+                                   unsigned start,
+                                   unsigned count,
+                                   const float *clip_limits,
+                                   void *output_buffer );
+
+   boolean (*run_elts_cliptest)( struct draw_vs_varient *shader,
+                                 const unsigned *elts,
+                                 unsigned count,
+                                 const float *clip_limits,
+                                 void *output_buffer );
+
    void (*destroy)( struct draw_vs_varient * );
 };
 
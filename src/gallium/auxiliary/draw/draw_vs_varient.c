@@ -40,6 +40,10 @@
 #include "translate/translate.h"
 #include "translate/translate_cache.h"
 
+/* Vertices are put through fetch, shader and emit this many at a time.
+ */
+#define VSVG_BATCH 64
+
 /* A first pass at incorporating vertex fetch/emit functionality into 
  */
 struct draw_vs_varient_generic {
@@ -58,6 +62,7 @@ struct draw_vs_varient_generic {
    struct translate *emit;
 
    unsigned temp_vertex_stride;
+   void *temp_buffer;           /* VSVG_BATCH vertices */
 };
 
 
@@ -125,52 +130,73 @@ static void do_viewport( struct draw_vs_varient_generic *vsvg,
 }
                          
 
-static void PIPE_CDECL vsvg_run_elts( struct draw_vs_varient *varient,
-                                      const unsigned *elts,
-                                      unsigned count,
-                                      void *output_buffer)
+/**
+ * Test the shaded positions in the temp buffer against the view
+ * volume and user clip planes.  Returns FALSE as soon as a vertex is
+ * found which needs clipping.
+ */
+static boolean vsvg_cliptest( struct draw_vs_varient_generic *vsvg,
+                              unsigned count,
+                              const float *limits )
 {
-   struct draw_vs_varient_generic *vsvg = (struct draw_vs_varient_generic *)varient;
-   unsigned temp_vertex_stride = vsvg->temp_vertex_stride;
-   void *temp_buffer = MALLOC( align(count,4) * temp_vertex_stride );
-   
-   if (0) debug_printf("%s %d \n", __FUNCTION__,  count);
-			
-   /* Want to do this in small batches for cache locality?
-    */
-   
-   vsvg->fetch->run_elts( vsvg->fetch, 
-                          elts,
-                          count,
-                          temp_buffer );
-
-   vsvg->base.vs->run_linear( vsvg->base.vs, 
-                              temp_buffer,
-                              temp_buffer,
-                              (const float (*)[4])vsvg->base.vs->draw->pt.user.constants,
-                              count,
-                              temp_vertex_stride, 
-                              temp_vertex_stride);
-
-
-   if (vsvg->base.key.clip) {
-      /* not really handling clipping, just do the rhw so we can
-       * see the results...
+   const struct draw_context *draw = vsvg->draw;
+   const char *ptr = (const char *)vsvg->temp_buffer;
+   unsigned stride = vsvg->temp_vertex_stride;
+   unsigned nr_planes = draw->nr_planes;
+   unsigned i, j;
+
+   ptr += vsvg->base.vs->position_output * 4 * sizeof(float);
+
+   for (j = 0; j < count; j++, ptr += stride) {
+      const float *clip = (const float *)ptr;
+
+      /* Same tests and plane order as draw_pt_post_vs.c:
        */
-      do_rhw_viewport( vsvg,
-                       count,
-                       temp_buffer );
-   }
-   else if (vsvg->base.key.viewport) {
-      do_viewport( vsvg,
-                   count,
-                   temp_buffer );
+      if (clip[0] > limits[1] * clip[3] ||
+          clip[0] < limits[0] * clip[3] ||
+          clip[1] > limits[3] * clip[3] ||
+          clip[1] < limits[2] * clip[3] ||
+          clip[2] + clip[3] < 0 ||
+          -clip[2] + clip[3] < 0)
+         return FALSE;
+
+      for (i = 6; i < nr_planes; i++) {
+         const float *plane = draw->plane[i];
+         if (clip[0] * plane[0] +
+             clip[1] * plane[1] +
+             clip[2] * plane[2] +
+             clip[3] * plane[3] < 0)
+            return FALSE;
+      }
    }
 
+   return TRUE;
+}
+
+
+/* Fetch, shade and emit in batches of VSVG_BATCH vertices so that the
+ * temp buffer stays in cache.  Linear if elts is NULL.  If clip_limits
+ * is non-NULL, each batch is cliptested before it is emitted.
+ */
+static boolean vsvg_run( struct draw_vs_varient_generic *vsvg,
+                         const unsigned *elts,
+                         unsigned start,
+                         unsigned count,
+                         const float *clip_limits,
+                         void *output_buffer )
+{
+   struct draw_vertex_shader *vs = vsvg->base.vs;
+   unsigned temp_vertex_stride = vsvg->temp_vertex_stride;
+   char *out = (char *)output_buffer;
+   unsigned i, n;
+
+   if (0) debug_printf("%s %d %d (sz %d, %d)\n", __FUNCTION__, start, count,
+                       vsvg->base.key.output_stride,
+                       temp_vertex_stride);
 
    vsvg->emit->set_buffer( vsvg->emit,
                            0, 
-                           temp_buffer,
+                           vsvg->temp_buffer,
                            temp_vertex_stride );
 
    vsvg->emit->set_buffer( vsvg->emit, 
@@ -178,11 +204,63 @@ static void PIPE_CDECL vsvg_run_elts( struct draw_vs_varient *varient,
                            &vsvg->draw->rasterizer->point_size,
                            0);
 
-   vsvg->emit->run( vsvg->emit,
-                    0, count,
-                    output_buffer );
+   for (i = 0; i < count; i += n) {
+      n = MIN2(count - i, VSVG_BATCH);
+
+      if (elts)
+         vsvg->fetch->run_elts( vsvg->fetch, 
+                                elts + i,
+                                n,
+                                vsvg->temp_buffer );
+      else
+         vsvg->fetch->run( vsvg->fetch, 
+                           start + i,
+                           n,
+                           vsvg->temp_buffer );
+
+      vs->run_linear( vs, 
+                      vsvg->temp_buffer,
+                      vsvg->temp_buffer,
+                      (const float (*)[4])vs->draw->pt.user.constants,
+                      n,
+                      temp_vertex_stride, 
+                      temp_vertex_stride );
+
+      if (clip_limits) {
+         if (!vsvg_cliptest( vsvg, n, clip_limits ))
+            return FALSE;
+
+         do_rhw_viewport( vsvg, n, vsvg->temp_buffer );
+      }
+      else if (vsvg->base.key.clip) {
+         /* not really handling clipping, just do the rhw so we can
+          * see the results...
+          */
+         do_rhw_viewport( vsvg, n, vsvg->temp_buffer );
+      }
+      else if (vsvg->base.key.viewport) {
+         do_viewport( vsvg, n, vsvg->temp_buffer );
+      }
+
+      vsvg->emit->run( vsvg->emit,
+                       0, n,
+                       out );
+
+      out += n * vsvg->base.key.output_stride;
+   }
+
+   return TRUE;
+}
+
+
+static void PIPE_CDECL vsvg_run_elts( struct draw_vs_varient *varient,
+                                      const unsigned *elts,
+                                      unsigned count,
+                                      void *output_buffer)
+{
+   struct draw_vs_varient_generic *vsvg = (struct draw_vs_varient_generic *)varient;
 
-   FREE(temp_buffer);
+   vsvg_run( vsvg, elts, 0, count, NULL, output_buffer );
 }
 
 
@@ -192,63 +270,40 @@ static void PIPE_CDECL vsvg_run_linear( struct draw_vs_varient *varient,
                                         void *output_buffer )
 {
    struct draw_vs_varient_generic *vsvg = (struct draw_vs_varient_generic *)varient;
-   unsigned temp_vertex_stride = vsvg->temp_vertex_stride;
-   void *temp_buffer = MALLOC( align(count,4) * temp_vertex_stride );
-	
-   if (0) debug_printf("%s %d %d (sz %d, %d)\n", __FUNCTION__, start, count,
-                       vsvg->base.key.output_stride,
-                       temp_vertex_stride);
 
-   vsvg->fetch->run( vsvg->fetch, 
-                     start,
-                     count,
-                     temp_buffer );
-
-   vsvg->base.vs->run_linear( vsvg->base.vs, 
-                              temp_buffer,
-                              temp_buffer,
-                              (const float (*)[4])vsvg->base.vs->draw->pt.user.constants,
-                              count,
-                              temp_vertex_stride, 
-                              temp_vertex_stride);
-
-   if (vsvg->base.key.clip) {
-      /* not really handling clipping, just do the rhw so we can
-       * see the results...
-       */
-      do_rhw_viewport( vsvg,
-                       count,
-                       temp_buffer );
-   }
-   else if (vsvg->base.key.viewport) {
-      do_viewport( vsvg,
-                   count,
-                   temp_buffer );
-   }
+   vsvg_run( vsvg, NULL, start, count, NULL, output_buffer );
+}
 
-   vsvg->emit->set_buffer( vsvg->emit,
-                           0, 
-                           temp_buffer,
-                           temp_vertex_stride );
-   
-   vsvg->emit->set_buffer( vsvg->emit, 
-                           1,
-                           &vsvg->draw->rasterizer->point_size,
-                           0);
-   
-   vsvg->emit->run( vsvg->emit,
-                    0, count,
-                    output_buffer );
 
-   FREE(temp_buffer);
+static boolean vsvg_run_elts_cliptest( struct draw_vs_varient *varient,
+                                       const unsigned *elts,
+                                       unsigned count,
+                                       const float *clip_limits,
+                                       void *output_buffer )
+{
+   struct draw_vs_varient_generic *vsvg = (struct draw_vs_varient_generic *)varient;
+
+   return vsvg_run( vsvg, elts, 0, count, clip_limits, output_buffer );
 }
 
 
+static boolean vsvg_run_linear_cliptest( struct draw_vs_varient *varient,
+                                         unsigned start,
+                                         unsigned count,
+                                         const float *clip_limits,
+                                         void *output_buffer )
+{
+   struct draw_vs_varient_generic *vsvg = (struct draw_vs_varient_generic *)varient;
 
+   return vsvg_run( vsvg, NULL, start, count, clip_limits, output_buffer );
+}
 
 
 static void vsvg_destroy( struct draw_vs_varient *varient )
 {
+   struct draw_vs_varient_generic *vsvg = (struct draw_vs_varient_generic *)varient;
+
+   FREE(vsvg->temp_buffer);
    FREE(varient);
 }
 
@@ -268,6 +323,8 @@ struct draw_vs_varient *draw_vs_varient_generic( struct draw_vertex_shader *vs,
    vsvg->base.set_buffer    = vsvg_set_buffer;
    vsvg->base.run_elts      = vsvg_run_elts;
    vsvg->base.run_linear    = vsvg_run_linear;
+   vsvg->base.run_elts_cliptest   = vsvg_run_elts_cliptest;
+   vsvg->base.run_linear_cliptest = vsvg_run_linear_cliptest;
    vsvg->base.destroy       = vsvg_destroy;
 
    vsvg->draw = vs->draw;
@@ -275,6 +332,12 @@ struct draw_vs_varient *draw_vs_varient_generic( struct draw_vertex_shader *vs,
    vsvg->temp_vertex_stride = MAX2(key->nr_inputs,
                                    vsvg->base.vs->info.num_outputs) * 4 * sizeof(float);
 
+   vsvg->temp_buffer = MALLOC( VSVG_BATCH * vsvg->temp_vertex_stride );
+   if (vsvg->temp_buffer == NULL) {
+      FREE(vsvg);
+      return NULL;
+   }
+
    /* Build free-standing fetch and emit functions:
     */
    fetch.nr_elements = key->nr_inputs;
@@ -110,6 +110,9 @@ lp_depth_type(const struct util_format_description *format_desc,
 
 /**
  * Depth test.
+ *
+ * The incoming depth values in src must already be scaled to the bit width
+ * of the depth channel, i.e., be in the least significant bits.
  */
 void
 lp_build_depth_test(LLVMBuilderRef builder,
@@ -121,7 +124,11 @@ lp_build_depth_test(LLVMBuilderRef builder,
                     LLVMValueRef dst_ptr)
 {
    struct lp_build_context bld;
+   union lp_type cmp_type;
+   struct lp_build_context cmp_bld;
    unsigned z_swizzle;
+   unsigned padding_left = 0;
+   unsigned padding_right = 0;
    LLVMValueRef dst;
    LLVMValueRef z_bitmask = NULL;
    LLVMValueRef test;
@@ -167,8 +174,6 @@ lp_build_depth_test(LLVMBuilderRef builder,
       /* nothing to do */
    }
    else {
-      unsigned padding_left;
-      unsigned padding_right;
       unsigned chan;
 
       assert(format_desc->layout == UTIL_FORMAT_LAYOUT_ARITH);
@@ -188,17 +193,24 @@ lp_build_depth_test(LLVMBuilderRef builder,
          z_bitmask = lp_build_int_const_scalar(type, mask_left ^ mask_right);
       }
 
-      if(padding_left)
-         src = LLVMBuildLShr(builder, src, lp_build_int_const_scalar(type, padding_left), "");
       if(padding_right)
-         src = LLVMBuildAnd(builder, src, z_bitmask, "");
+         src = LLVMBuildShl(builder, src, lp_build_int_const_scalar(type, padding_right), "");
       if(padding_left || padding_right)
          dst = LLVMBuildAnd(builder, dst, z_bitmask, "");
    }
 
    lp_build_name(dst, "zsbuf.z");
 
-   test = lp_build_cmp(&bld, state->func, src, dst);
+   /* When the depth bits don't reach the most significant bit (e.g. Z24X8)
+    * a signed comparison gives the same result, and is cheaper than the
+    * unsigned one, which SSE2 can only do by flipping the sign bits first.
+    */
+   cmp_type = type;
+   if(!type.floating && padding_left)
+      cmp_type.sign = TRUE;
+   lp_build_context_init(&cmp_bld, builder, cmp_type);
+
+   test = lp_build_cmp(&cmp_bld, state->func, src, dst);
    lp_build_mask_update(mask, test);
 
    if(state->writemask) {
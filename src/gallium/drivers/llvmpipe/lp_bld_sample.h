@@ -69,6 +69,9 @@ struct lp_sampler_static_state
    unsigned compare_func:3;
    unsigned normalized_coords:1;
    unsigned prefilter:4;
+   float lod_bias;
+   float min_lod;
+   float max_lod;
 };
 
 
@@ -97,11 +100,19 @@ struct lp_sampler_dynamic_state
               LLVMBuilderRef builder,
               unsigned unit);
 
+   /** Obtain the number of mipmap levels minus one. */
    LLVMValueRef
-   (*stride)( struct lp_sampler_dynamic_state *state,
-              LLVMBuilderRef builder,
-              unsigned unit);
+   (*last_level)( struct lp_sampler_dynamic_state *state,
+                  LLVMBuilderRef builder,
+                  unsigned unit);
+
+   /** Obtain a pointer to the array of row strides, one per level. */
+   LLVMValueRef
+   (*row_stride)( struct lp_sampler_dynamic_state *state,
+                  LLVMBuilderRef builder,
+                  unsigned unit);
 
+   /** Obtain a pointer to the array of data pointers, one per level. */
    LLVMValueRef
    (*data_ptr)( struct lp_sampler_dynamic_state *state,
                 LLVMBuilderRef builder,
@@ -79,6 +79,9 @@ lp_sampler_static_state(struct lp_sampler_static_state *state,
    }
    state->normalized_coords = sampler->normalized_coords;
    state->prefilter         = sampler->prefilter;
+   state->lod_bias          = sampler->lod_bias;
+   state->min_lod           = sampler->min_lod;
+   state->max_lod           = sampler->max_lod;
 }
 
 
@@ -107,16 +110,26 @@ struct lp_build_sample_context
    /** Output texels type and build context */
    union lp_type texel_type;
    struct lp_build_context texel_bld;
+
+   /** Level 0 dimensions, as scalars */
+   LLVMValueRef width;
+   LLVMValueRef height;
+   LLVMValueRef last_level;
+
+   /** Pointers to the per-level row stride and data pointer arrays */
+   LLVMValueRef row_stride_array;
+   LLVMValueRef data_array;
 };
 
 
-static void
-lp_build_sample_texel(struct lp_build_sample_context *bld,
-                      LLVMValueRef x,
-                      LLVMValueRef y,
-                      LLVMValueRef y_stride,
-                      LLVMValueRef data_ptr,
-                      LLVMValueRef *texel)
+/**
+ * Byte offset of the texels at x, y.
+ */
+static LLVMValueRef
+lp_build_sample_offset(struct lp_build_sample_context *bld,
+                       LLVMValueRef x,
+                       LLVMValueRef y,
+                       LLVMValueRef y_stride)
 {
    struct lp_build_context *int_coord_bld = &bld->int_coord_bld;
    LLVMValueRef x_stride;
@@ -165,6 +178,22 @@ lp_build_sample_texel(struct lp_build_sample_context *bld,
       offset = lp_build_add(int_coord_bld, x_offset, y_offset);
    }
 
+   return offset;
+}
+
+
+static void
+lp_build_sample_texel(struct lp_build_sample_context *bld,
+                      LLVMValueRef x,
+                      LLVMValueRef y,
+                      LLVMValueRef y_stride,
+                      LLVMValueRef data_ptr,
+                      LLVMValueRef *texel)
+{
+   LLVMValueRef offset;
+
+   offset = lp_build_sample_offset(bld, x, y, y_stride);
+
    lp_build_load_rgba_soa(bld->builder,
                           bld->format_desc,
                           bld->texel_type,
@@ -190,18 +219,26 @@ lp_build_sample_wrap(struct lp_build_sample_context *bld,
    case PIPE_TEX_WRAP_REPEAT:
       if(is_pot)
          coord = LLVMBuildAnd(bld->builder, coord, length_minus_one, "");
-      else
-         /* Signed remainder won't give the right results for negative
-          * dividends but unsigned remainder does.*/
-         coord = LLVMBuildURem(bld->builder, coord, length, "");
+      else {
+         /* The signed remainder takes the sign of the dividend, so fold
+          * negative results back into [0, length - 1] */
+         LLVMValueRef is_neg;
+         coord = LLVMBuildSRem(bld->builder, coord, length, "");
+         is_neg = lp_build_cmp(int_coord_bld, PIPE_FUNC_LESS, coord, int_coord_bld->zero);
+         coord = lp_build_select(int_coord_bld, is_neg,
+                                 lp_build_add(int_coord_bld, coord, length),
+                                 coord);
+      }
       break;
 
    case PIPE_TEX_WRAP_CLAMP:
+   case PIPE_TEX_WRAP_CLAMP_TO_EDGE:
+      /* FIXME: PIPE_TEX_WRAP_CLAMP should blend with the border color when
+       * filtering linearly */
       coord = lp_build_max(int_coord_bld, coord, int_coord_bld->zero);
       coord = lp_build_min(int_coord_bld, coord, length_minus_one);
       break;
 
-   case PIPE_TEX_WRAP_CLAMP_TO_EDGE:
    case PIPE_TEX_WRAP_CLAMP_TO_BORDER:
    case PIPE_TEX_WRAP_MIRROR_REPEAT:
    case PIPE_TEX_WRAP_MIRROR_CLAMP:
@@ -298,6 +335,470 @@ lp_build_sample_2d_linear_soa(struct lp_build_sample_context *bld,
 }
 
 
+/**
+ * Whether the texels are four 8bit unsigned normalized channels, which can
+ * be filtered in packed integer arithmetic.
+ */
+static boolean
+lp_build_sample_is_u8n(const struct lp_build_sample_context *bld)
+{
+   const struct util_format_description *format_desc = bld->format_desc;
+   unsigned chan;
+
+   if(format_desc->layout != UTIL_FORMAT_LAYOUT_ARITH ||
+      format_desc->colorspace == UTIL_FORMAT_COLORSPACE_ZS ||
+      format_desc->block.width != 1 ||
+      format_desc->block.height != 1 ||
+      format_desc->block.bits != 32)
+      return FALSE;
+
+   for(chan = 0; chan < 4; ++chan) {
+      if(format_desc->channel[chan].type != UTIL_FORMAT_TYPE_UNSIGNED ||
+         format_desc->channel[chan].size != 8 ||
+         !format_desc->channel[chan].normalized)
+         return FALSE;
+   }
+
+   /* four texels of four bytes fill a 128bit register */
+   return bld->texel_type.floating &&
+          bld->texel_type.width == 32 &&
+          bld->texel_type.length == 4;
+}
+
+
+/**
+ * Shuffle that replicates word 'first', 'first' + 2, ... of a <8 x i16>
+ * vector four times each, i.e., broadcasts the 16bit weights of two
+ * texels over their four channels.
+ */
+static LLVMValueRef
+lp_build_sample_weight_shuffle(unsigned first)
+{
+   LLVMValueRef elems[8];
+   unsigned i;
+
+   for(i = 0; i < 8; ++i)
+      elems[i] = LLVMConstInt(LLVMInt32Type(), first + 2*(i/4), 0);
+
+   return LLVMConstVector(elems, 8);
+}
+
+
+/**
+ * Shuffle matching PUNPCKLBW (lo_hi = 0) or PUNPCKHBW (lo_hi = 1).
+ */
+static LLVMValueRef
+lp_build_sample_unpack_shuffle(unsigned lo_hi)
+{
+   LLVMValueRef elems[16];
+   unsigned i;
+
+   for(i = 0; i < 8; ++i) {
+      elems[2*i + 0] = LLVMConstInt(LLVMInt32Type(), lo_hi*8 + i, 0);
+      elems[2*i + 1] = LLVMConstInt(LLVMInt32Type(), 16 + lo_hi*8 + i, 0);
+   }
+
+   return LLVMConstVector(elems, 16);
+}
+
+
+/**
+ * Shuffle that takes the low byte of every 16bit word of two vectors.
+ */
+static LLVMValueRef
+lp_build_sample_pack_shuffle(void)
+{
+   LLVMValueRef elems[16];
+   unsigned i;
+
+   for(i = 0; i < 16; ++i)
+      elems[i] = LLVMConstInt(LLVMInt32Type(), 2*i, 0);
+
+   return LLVMConstVector(elems, 16);
+}
+
+
+/**
+ * (a*(256 - w) + b*w + 128) >> 8 on 16bit words, with a, b and w in
+ * [0, 255]; all intermediate values fit in 16 unsigned bits.
+ */
+static LLVMValueRef
+lp_build_sample_lerp_u16(LLVMBuilderRef builder,
+                         LLVMValueRef w,
+                         LLVMValueRef a,
+                         LLVMValueRef b)
+{
+   LLVMTypeRef i16_type = LLVMInt16Type();
+   LLVMValueRef c256[8], c128[8], c8[8];
+   LLVMValueRef res;
+   unsigned i;
+
+   for(i = 0; i < 8; ++i) {
+      c256[i] = LLVMConstInt(i16_type, 256, 0);
+      c128[i] = LLVMConstInt(i16_type, 128, 0);
+      c8[i] = LLVMConstInt(i16_type, 8, 0);
+   }
+
+   /* PSUBW, PMULLW, PADDW, PSRLW */
+   res = LLVMBuildMul(builder, a, LLVMBuildSub(builder, LLVMConstVector(c256, 8), w, ""), "");
+   res = LLVMBuildAdd(builder, res, LLVMBuildMul(builder, b, w, ""), "");
+   res = LLVMBuildAdd(builder, res, LLVMConstVector(c128, 8), "");
+   res = LLVMBuildLShr(builder, res, LLVMConstVector(c8, 8), "");
+
+   return res;
+}
+
+
+/**
+ * Bilinear filtering of texels with four 8bit unorm channels.
+ *
+ * Instead of unpacking all four neighbours of every pixel to floats, the
+ * coordinates are computed in 8.8 fixed point and the packed texels are
+ * interpolated with 16bit integer arithmetic, two texels (eight channels)
+ * per operation.  Only the filtered result is converted to floats.
+ */
+static void
+lp_build_sample_2d_linear_u8n_soa(struct lp_build_sample_context *bld,
+                                  LLVMValueRef s,
+                                  LLVMValueRef t,
+                                  LLVMValueRef width,
+                                  LLVMValueRef height,
+                                  LLVMValueRef stride,
+                                  LLVMValueRef data_ptr,
+                                  LLVMValueRef *texel)
+{
+   LLVMBuilderRef builder = bld->builder;
+   struct lp_build_context *int_coord_bld = &bld->int_coord_bld;
+   LLVMTypeRef i16x8 = LLVMVectorType(LLVMInt16Type(), 8);
+   LLVMTypeRef i8x16 = LLVMVectorType(LLVMInt8Type(), 16);
+   LLVMTypeRef i32x4 = LLVMVectorType(LLVMInt32Type(), 4);
+   LLVMValueRef i8_zero = LLVMConstNull(i8x16);
+   LLVMValueRef scale, half;
+   LLVMValueRef eight, mask;
+   LLVMValueRef s_fixed, t_fixed;
+   LLVMValueRef s_weight, t_weight;
+   LLVMValueRef x0, x1, y0, y1;
+   LLVMValueRef offsets[2][2];
+   LLVMValueRef rows[2][2];
+   LLVMValueRef packed;
+   unsigned lo_hi;
+   unsigned i, j;
+
+   /* 8.8 fixed point coordinates relative to the texel centers */
+   scale = lp_build_const_scalar(bld->coord_type, 256.0);
+   half = lp_build_const_scalar(bld->coord_type, 128.0);
+   s = lp_build_sub(&bld->coord_bld, lp_build_mul(&bld->coord_bld, s, scale), half);
+   t = lp_build_sub(&bld->coord_bld, lp_build_mul(&bld->coord_bld, t, scale), half);
+   s_fixed = lp_build_ifloor(&bld->coord_bld, s);
+   t_fixed = lp_build_ifloor(&bld->coord_bld, t);
+
+   eight = lp_build_int_const_scalar(bld->int_coord_type, 8);
+   mask = lp_build_int_const_scalar(bld->int_coord_type, 0xff);
+
+   x0 = LLVMBuildAShr(builder, s_fixed, eight, "");
+   y0 = LLVMBuildAShr(builder, t_fixed, eight, "");
+   s_weight = LLVMBuildAnd(builder, s_fixed, mask, "");
+   t_weight = LLVMBuildAnd(builder, t_fixed, mask, "");
+
+   x1 = lp_build_add(int_coord_bld, x0, int_coord_bld->one);
+   y1 = lp_build_add(int_coord_bld, y0, int_coord_bld->one);
+
+   x0 = lp_build_sample_wrap(bld, x0, width,  bld->static_state->pot_width,  bld->static_state->wrap_s);
+   y0 = lp_build_sample_wrap(bld, y0, height, bld->static_state->pot_height, bld->static_state->wrap_t);
+   x1 = lp_build_sample_wrap(bld, x1, width,  bld->static_state->pot_width,  bld->static_state->wrap_s);
+   y1 = lp_build_sample_wrap(bld, y1, height, bld->static_state->pot_height, bld->static_state->wrap_t);
+
+   offsets[0][0] = lp_build_sample_offset(bld, x0, y0, stride);
+   offsets[0][1] = lp_build_sample_offset(bld, x1, y0, stride);
+   offsets[1][0] = lp_build_sample_offset(bld, x0, y1, stride);
+   offsets[1][1] = lp_build_sample_offset(bld, x1, y1, stride);
+
+   /* the weights are below 256, so only the low word of each is set */
+   s_weight = LLVMBuildBitCast(builder, s_weight, i16x8, "");
+   t_weight = LLVMBuildBitCast(builder, t_weight, i16x8, "");
+
+   for(j = 0; j < 2; ++j) {
+      for(i = 0; i < 2; ++i) {
+         LLVMValueRef texels;
+         texels = lp_build_gather(builder, 4, 32, 32, data_ptr, offsets[j][i]);
+         rows[j][i] = LLVMBuildBitCast(builder, texels, i8x16, "");
+      }
+   }
+
+   /* texels 0 and 1 in the low half, 2 and 3 in the high half */
+   packed = NULL;
+   for(lo_hi = 0; lo_hi < 2; ++lo_hi) {
+      LLVMValueRef unpack = lp_build_sample_unpack_shuffle(lo_hi);
+      LLVMValueRef weights = lp_build_sample_weight_shuffle(lo_hi*4);
+      LLVMValueRef sw, tw;
+      LLVMValueRef neighbors[2][2];
+      LLVMValueRef row0, row1, res;
+
+      sw = LLVMBuildShuffleVector(builder, s_weight, LLVMGetUndef(i16x8), weights, "");
+      tw = LLVMBuildShuffleVector(builder, t_weight, LLVMGetUndef(i16x8), weights, "");
+
+      for(j = 0; j < 2; ++j) {
+         for(i = 0; i < 2; ++i) {
+            /* PUNPCKLBW, PUNPCKHBW */
+            neighbors[j][i] = LLVMBuildShuffleVector(builder, rows[j][i], i8_zero, unpack, "");
+            neighbors[j][i] = LLVMBuildBitCast(builder, neighbors[j][i], i16x8, "");
+         }
+      }
+
+      row0 = lp_build_sample_lerp_u16(builder, sw, neighbors[0][0], neighbors[0][1]);
+      row1 = lp_build_sample_lerp_u16(builder, sw, neighbors[1][0], neighbors[1][1]);
+      res = lp_build_sample_lerp_u16(builder, tw, row0, row1);
+      res = LLVMBuildBitCast(builder, res, i8x16, "");
+
+      if(packed)
+         /* PACKUSWB */
+         packed = LLVMBuildShuffleVector(builder, packed, res,
+                                         lp_build_sample_pack_shuffle(), "");
+      else
+         packed = res;
+   }
+
+   packed = LLVMBuildBitCast(builder, packed, i32x4, "");
+
+   lp_build_unpack_rgba_soa(builder, bld->format_desc, bld->texel_type,
+                            packed, texel);
+}
+
+
+/**
+ * Dimension of the given mipmap level, i.e., max(size >> level, 1).
+ */
+static LLVMValueRef
+lp_build_sample_minify(LLVMBuilderRef builder,
+                       LLVMValueRef base_size,
+                       LLVMValueRef level)
+{
+   LLVMValueRef one = LLVMConstInt(LLVMInt32Type(), 1, 0);
+   LLVMValueRef size;
+   LLVMValueRef is_zero;
+
+   size = LLVMBuildLShr(builder, base_size, level, "");
+   is_zero = LLVMBuildICmp(builder, LLVMIntULT, size, one, "");
+   return LLVMBuildSelect(builder, is_zero, one, size, "");
+}
+
+
+/**
+ * Sample a single mipmap level of a 2D texture.
+ *
+ * @param level  integer scalar with the mipmap level
+ */
+static void
+lp_build_sample_2d_level(struct lp_build_sample_context *bld,
+                         LLVMValueRef s,
+                         LLVMValueRef t,
+                         LLVMValueRef level,
+                         unsigned img_filter,
+                         LLVMValueRef *texel)
+{
+   LLVMBuilderRef builder = bld->builder;
+   LLVMValueRef indices[2];
+   LLVMValueRef width;
+   LLVMValueRef height;
+   LLVMValueRef stride;
+   LLVMValueRef data_ptr;
+
+   indices[0] = LLVMConstInt(LLVMInt32Type(), 0, 0);
+   indices[1] = level;
+
+   stride = LLVMBuildGEP(builder, bld->row_stride_array, indices, Elements(indices), "");
+   stride = LLVMBuildLoad(builder, stride, "");
+   data_ptr = LLVMBuildGEP(builder, bld->data_array, indices, Elements(indices), "");
+   data_ptr = LLVMBuildLoad(builder, data_ptr, "");
+
+   width = lp_build_sample_minify(builder, bld->width, level);
+   height = lp_build_sample_minify(builder, bld->height, level);
+
+   width = lp_build_broadcast_scalar(&bld->int_coord_bld, width);
+   height = lp_build_broadcast_scalar(&bld->int_coord_bld, height);
+   stride = lp_build_broadcast_scalar(&bld->int_coord_bld, stride);
+
+   if(bld->static_state->normalized_coords) {
+      LLVMTypeRef coord_vec_type = lp_build_vec_type(bld->coord_type);
+      LLVMValueRef fp_width = LLVMBuildSIToFP(builder, width, coord_vec_type, "");
+      LLVMValueRef fp_height = LLVMBuildSIToFP(builder, height, coord_vec_type, "");
+      s = lp_build_mul(&bld->coord_bld, s, fp_width);
+      t = lp_build_mul(&bld->coord_bld, t, fp_height);
+   }
+
+   switch (img_filter) {
+   case PIPE_TEX_FILTER_NEAREST:
+      lp_build_sample_2d_nearest_soa(bld, s, t, width, height, stride, data_ptr, texel);
+      break;
+   case PIPE_TEX_FILTER_LINEAR:
+   case PIPE_TEX_FILTER_ANISO:
+      if(lp_build_sample_is_u8n(bld))
+         lp_build_sample_2d_linear_u8n_soa(bld, s, t, width, height, stride, data_ptr, texel);
+      else
+         lp_build_sample_2d_linear_soa(bld, s, t, width, height, stride, data_ptr, texel);
+      break;
+   default:
+      assert(0);
+   }
+}
+
+
+/**
+ * Shuffle that replicates the given elements of a 4 wide vector.
+ */
+static LLVMValueRef
+lp_build_sample_quad_shuffle(unsigned a, unsigned b)
+{
+   LLVMValueRef elems[4];
+
+   elems[0] = LLVMConstInt(LLVMInt32Type(), a, 0);
+   elems[1] = LLVMConstInt(LLVMInt32Type(), b, 0);
+   elems[2] = LLVMConstInt(LLVMInt32Type(), a, 0);
+   elems[3] = LLVMConstInt(LLVMInt32Type(), b, 0);
+
+   return LLVMConstVector(elems, 4);
+}
+
+
+/**
+ * Level of detail of the quad, as a float scalar, biased and clamped to
+ * the sampler's [min_lod, max_lod] but not to the texture's levels.
+ *
+ * The quad pixels are laid out as upper left, upper right, lower left,
+ * lower right, so the derivatives are just differences between elements.
+ * Rho is approximated by the largest absolute derivative, measured in
+ * level 0 texels.
+ */
+static LLVMValueRef
+lp_build_sample_lambda(struct lp_build_sample_context *bld,
+                       LLVMValueRef s,
+                       LLVMValueRef t,
+                       LLVMValueRef lodbias)
+{
+   LLVMBuilderRef builder = bld->builder;
+   struct lp_build_context *coord_bld = &bld->coord_bld;
+   LLVMValueRef deriv_shuffle = lp_build_sample_quad_shuffle(1, 2);
+   LLVMValueRef origin_shuffle = lp_build_sample_quad_shuffle(0, 0);
+   LLVMValueRef ds, dt;
+   LLVMTypeRef float_type = LLVMFloatType();
+   LLVMValueRef rho;
+   LLVMValueRef lambda;
+   LLVMValueRef min_lod, max_lod;
+   LLVMValueRef cond;
+
+   assert(bld->coord_type.length == 4);
+
+   /* ds/dx, ds/dy, ds/dx, ds/dy */
+   ds = lp_build_sub(coord_bld,
+                     LLVMBuildShuffleVector(builder, s, s, deriv_shuffle, ""),
+                     LLVMBuildShuffleVector(builder, s, s, origin_shuffle, ""));
+   dt = lp_build_sub(coord_bld,
+                     LLVMBuildShuffleVector(builder, t, t, deriv_shuffle, ""),
+                     LLVMBuildShuffleVector(builder, t, t, origin_shuffle, ""));
+
+   if(bld->static_state->normalized_coords) {
+      LLVMTypeRef coord_vec_type = lp_build_vec_type(bld->coord_type);
+      LLVMValueRef width = lp_build_broadcast_scalar(&bld->int_coord_bld, bld->width);
+      LLVMValueRef height = lp_build_broadcast_scalar(&bld->int_coord_bld, bld->height);
+      ds = lp_build_mul(coord_bld, ds, LLVMBuildSIToFP(builder, width, coord_vec_type, ""));
+      dt = lp_build_mul(coord_bld, dt, LLVMBuildSIToFP(builder, height, coord_vec_type, ""));
+   }
+
+   rho = lp_build_max(coord_bld, lp_build_abs(coord_bld, ds), lp_build_abs(coord_bld, dt));
+   rho = lp_build_max(coord_bld, rho,
+                      LLVMBuildShuffleVector(builder, rho, rho,
+                                             lp_build_sample_quad_shuffle(1, 0), ""));
+
+   lambda = lp_build_log2(coord_bld, rho);
+   if(lodbias)
+      lambda = lp_build_add(coord_bld, lambda, lodbias);
+
+   lambda = LLVMBuildExtractElement(builder, lambda,
+                                    LLVMConstInt(LLVMInt32Type(), 0, 0), "");
+
+   /* sampler's lod bias, then clamp to [min_lod, max_lod] */
+   if(bld->static_state->lod_bias != 0.0f)
+      lambda = LLVMBuildFAdd(builder, lambda,
+                             LLVMConstReal(float_type, bld->static_state->lod_bias), "");
+
+   min_lod = LLVMConstReal(float_type, bld->static_state->min_lod);
+   max_lod = LLVMConstReal(float_type, bld->static_state->max_lod);
+   cond = LLVMBuildFCmp(builder, LLVMRealOGT, lambda, min_lod, "");
+   lambda = LLVMBuildSelect(builder, cond, lambda, min_lod, "");
+   cond = LLVMBuildFCmp(builder, LLVMRealOLT, lambda, max_lod, "");
+   lambda = LLVMBuildSelect(builder, cond, lambda, max_lod, "");
+
+   return lambda;
+}
+
+
+/**
+ * Sample a minified 2D texture, choosing and blending mipmap levels
+ * according to the mip filter.
+ */
+static void
+lp_build_sample_2d_mipmap(struct lp_build_sample_context *bld,
+                          LLVMValueRef s,
+                          LLVMValueRef t,
+                          LLVMValueRef lambda,
+                          LLVMValueRef *texel)
+{
+   LLVMBuilderRef builder = bld->builder;
+   unsigned img_filter = bld->static_state->min_img_filter;
+   LLVMTypeRef float_type = LLVMFloatType();
+   LLVMTypeRef int_type = LLVMInt32Type();
+   LLVMValueRef zero = LLVMConstNull(float_type);
+   LLVMValueRef last_level;
+   LLVMValueRef lod;
+   LLVMValueRef level0, level1;
+   LLVMValueRef fpart;
+   LLVMValueRef texel0[4], texel1[4];
+   LLVMValueRef cond;
+   unsigned chan;
+
+   if(bld->static_state->min_mip_filter == PIPE_TEX_MIPFILTER_NONE) {
+      lp_build_sample_2d_level(bld, s, t, LLVMConstNull(int_type), img_filter, texel);
+      return;
+   }
+
+   /* clamp to [0, last_level] */
+   last_level = LLVMBuildSIToFP(builder, bld->last_level, float_type, "");
+   cond = LLVMBuildFCmp(builder, LLVMRealOGT, lambda, zero, "");
+   lod = LLVMBuildSelect(builder, cond, lambda, zero, "");
+   cond = LLVMBuildFCmp(builder, LLVMRealOLT, lod, last_level, "");
+   lod = LLVMBuildSelect(builder, cond, lod, last_level, "");
+
+   switch(bld->static_state->min_mip_filter) {
+   case PIPE_TEX_MIPFILTER_NEAREST:
+      lod = LLVMBuildFAdd(builder, lod, LLVMConstReal(float_type, 0.5), "");
+      level0 = LLVMBuildFPToSI(builder, lod, int_type, "");
+      lp_build_sample_2d_level(bld, s, t, level0, img_filter, texel);
+      break;
+
+   case PIPE_TEX_MIPFILTER_LINEAR:
+      /* lod is not negative, so truncation is the floor */
+      level0 = LLVMBuildFPToSI(builder, lod, int_type, "");
+      fpart = LLVMBuildFSub(builder, lod,
+                            LLVMBuildSIToFP(builder, level0, float_type, ""), "");
+
+      level1 = LLVMBuildAdd(builder, level0, LLVMConstInt(int_type, 1, 0), "");
+      cond = LLVMBuildICmp(builder, LLVMIntSLT, level0, bld->last_level, "");
+      level1 = LLVMBuildSelect(builder, cond, level1, level0, "");
+
+      lp_build_sample_2d_level(bld, s, t, level0, img_filter, texel0);
+      lp_build_sample_2d_level(bld, s, t, level1, img_filter, texel1);
+
+      fpart = lp_build_broadcast_scalar(&bld->texel_bld, fpart);
+      for(chan = 0; chan < 4; ++chan)
+         texel[chan] = lp_build_lerp(&bld->texel_bld, fpart, texel0[chan], texel1[chan]);
+      break;
+
+   default:
+      assert(0);
+   }
+}
+
+
 static void
 lp_build_sample_compare(struct lp_build_sample_context *bld,
                         LLVMValueRef p,
@@ -345,10 +846,6 @@ lp_build_sample_soa(LLVMBuilderRef builder,
                     LLVMValueRef *texel)
 {
    struct lp_build_sample_context bld;
-   LLVMValueRef width;
-   LLVMValueRef height;
-   LLVMValueRef stride;
-   LLVMValueRef data_ptr;
    LLVMValueRef s;
    LLVMValueRef t;
    LLVMValueRef p;
@@ -361,50 +858,55 @@ lp_build_sample_soa(LLVMBuilderRef builder,
    bld.format_desc = util_format_description(static_state->format);
    bld.coord_type = type;
    bld.int_coord_type = lp_int_type(type);
+   bld.int_coord_type.sign = 1; /* texel coordinates can be negative before wrapping */
    bld.texel_type = type;
    lp_build_context_init(&bld.coord_bld, builder, bld.coord_type);
    lp_build_context_init(&bld.int_coord_bld, builder, bld.int_coord_type);
    lp_build_context_init(&bld.texel_bld, builder, bld.texel_type);
 
    /* Get the dynamic state */
-   width = dynamic_state->width(dynamic_state, builder, unit);
-   height = dynamic_state->height(dynamic_state, builder, unit);
-   stride = dynamic_state->stride(dynamic_state, builder, unit);
-   data_ptr = dynamic_state->data_ptr(dynamic_state, builder, unit);
+   bld.width = dynamic_state->width(dynamic_state, builder, unit);
+   bld.height = dynamic_state->height(dynamic_state, builder, unit);
+   bld.last_level = dynamic_state->last_level(dynamic_state, builder, unit);
+   bld.row_stride_array = dynamic_state->row_stride(dynamic_state, builder, unit);
+   bld.data_array = dynamic_state->data_ptr(dynamic_state, builder, unit);
 
    s = coords[0];
    t = coords[1];
    p = coords[2];
 
-   width = lp_build_broadcast_scalar(&bld.int_coord_bld, width);
-   height = lp_build_broadcast_scalar(&bld.int_coord_bld, height);
-   stride = lp_build_broadcast_scalar(&bld.int_coord_bld, stride);
-
    if(static_state->target == PIPE_TEXTURE_1D)
       t = bld.coord_bld.zero;
 
-   if(static_state->normalized_coords) {
-      LLVMTypeRef coord_vec_type = lp_build_vec_type(bld.coord_type);
-      LLVMValueRef fp_width = LLVMBuildSIToFP(builder, width, coord_vec_type, "");
-      LLVMValueRef fp_height = LLVMBuildSIToFP(builder, height, coord_vec_type, "");
-      s = lp_build_mul(&bld.coord_bld, s, fp_width);
-      t = lp_build_mul(&bld.coord_bld, t, fp_height);
+   if(static_state->min_mip_filter == PIPE_TEX_MIPFILTER_NONE &&
+      static_state->min_img_filter == static_state->mag_img_filter) {
+      /* No need for the level of detail */
+      lp_build_sample_2d_level(&bld, s, t, LLVMConstNull(LLVMInt32Type()),
+                               static_state->min_img_filter, texel);
    }
+   else {
+      LLVMValueRef lambda;
 
-   switch (static_state->min_img_filter) {
-   case PIPE_TEX_FILTER_NEAREST:
-      lp_build_sample_2d_nearest_soa(&bld, s, t, width, height, stride, data_ptr, texel);
-      break;
-   case PIPE_TEX_FILTER_LINEAR:
-   case PIPE_TEX_FILTER_ANISO:
-      lp_build_sample_2d_linear_soa(&bld, s, t, width, height, stride, data_ptr, texel);
-      break;
-   default:
-      assert(0);
+      lambda = lp_build_sample_lambda(&bld, s, t, lodbias);
+
+      lp_build_sample_2d_mipmap(&bld, s, t, lambda, texel);
+
+      if(static_state->mag_img_filter != static_state->min_img_filter) {
+         LLVMValueRef mag_texel[4];
+         LLVMValueRef is_mag;
+         unsigned chan;
+
+         lp_build_sample_2d_level(&bld, s, t, LLVMConstNull(LLVMInt32Type()),
+                                  static_state->mag_img_filter, mag_texel);
+
+         /* the whole quad is either magnified or minified */
+         is_mag = LLVMBuildFCmp(builder, LLVMRealOLE, lambda,
+                                LLVMConstNull(LLVMFloatType()), "");
+         for(chan = 0; chan < 4; ++chan)
+            texel[chan] = LLVMBuildSelect(builder, is_mag, mag_texel[chan], texel[chan], "");
+      }
    }
 
-   /* FIXME: respect static_state->min_mip_filter */;
-   /* FIXME: respect static_state->mag_img_filter */;
    /* FIXME: respect static_state->prefilter */;
 
    lp_build_sample_compare(&bld, p, texel);
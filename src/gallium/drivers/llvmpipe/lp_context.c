@@ -39,6 +39,7 @@
 #include "lp_flush.h"
 #include "lp_prim_setup.h"
 #include "lp_prim_vbuf.h"
+#include "lp_screen.h"
 #include "lp_state.h"
 #include "lp_surface.h"
 #include "lp_tile_cache.h"
@@ -254,6 +255,10 @@ llvmpipe_create( struct pipe_screen *screen )
    if (!llvmpipe->draw) 
       goto fail;
 
+   draw_set_guard_band(llvmpipe->draw,
+                       -LP_GUARD_BAND, -LP_GUARD_BAND,
+                       LP_GUARD_BAND, LP_GUARD_BAND);
+
    draw_texture_samplers(llvmpipe->draw,
                          PIPE_MAX_SAMPLERS,
                          (struct tgsi_sampler **)
@@ -112,6 +112,11 @@ struct llvmpipe_context {
    /** Derived from scissor and surface bounds: */
    struct pipe_scissor_state cliprect;
 
+   /** cliprect limited to the viewport too, for triangle prims (see
+    * draw_set_guard_band())
+    */
+   struct pipe_scissor_state tri_cliprect;
+
    unsigned line_stipple_counter;
 
    /** TGSI exec things */
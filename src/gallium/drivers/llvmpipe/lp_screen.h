@@ -43,6 +43,14 @@
 #include "pipe/p_defines.h"
 
 
+/**
+ * Window coordinates the triangle setup code copes with, in each
+ * direction.  Triangles inside aren't clipped to the viewport by the
+ * draw module, setup scissors them instead.
+ */
+#define LP_GUARD_BAND 8192.0f
+
+
 struct llvmpipe_winsys;
 
 
@@ -763,14 +763,18 @@ static void setup_tri_edges( struct setup_context *setup )
 
 /**
  * Render the upper or lower half of a triangle.
- * Scissoring/cliprect is applied here too.
+ * Scissoring/cliprect is applied here too, as is the viewport since the
+ * draw module doesn't clip triangles inside the guard band.
  */
 static void subtriangle( struct setup_context *setup,
 			 struct edge *eleft,
 			 struct edge *eright,
 			 unsigned lines )
 {
-   const struct pipe_scissor_state *cliprect = &setup->llvmpipe->cliprect;
+   const struct llvmpipe_context *lp = setup->llvmpipe;
+   const struct pipe_scissor_state *cliprect =
+      (lp->reduced_api_prim == PIPE_PRIM_TRIANGLES ?
+       &lp->tri_cliprect : &lp->cliprect);
    const int minx = (int) cliprect->minx;
    const int maxx = (int) cliprect->maxx;
    const int miny = (int) cliprect->miny;
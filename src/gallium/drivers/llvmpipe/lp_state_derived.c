@@ -34,6 +34,7 @@
 #include "lp_context.h"
 #include "lp_screen.h"
 #include "lp_tex_cache.h"
+#include "lp_tile_cache.h"
 #include "lp_state.h"
 
 
@@ -191,6 +192,30 @@ compute_cliprect(struct llvmpipe_context *lp)
       lp->cliprect.maxx = surfWidth;
       lp->cliprect.maxy = surfHeight;
    }
+
+   lp->tri_cliprect = lp->cliprect;
+
+   /* LP_NEW_VIEWPORT
+    */
+   if (!lp->rasterizer->bypass_vs_clip_and_viewport) {
+      /* Pixels whose centers fall inside the viewport */
+      const float *scale = lp->viewport.scale;
+      const float *trans = lp->viewport.translate;
+      int minx = (int) ceilf(trans[0] - fabsf(scale[0]) - 0.5f);
+      int maxx = (int) ceilf(trans[0] + fabsf(scale[0]) - 0.5f);
+      int miny = (int) ceilf(trans[1] - fabsf(scale[1]) - 0.5f);
+      int maxy = (int) ceilf(trans[1] + fabsf(scale[1]) - 0.5f);
+
+      minx = CLAMP(minx, (int) lp->cliprect.minx, (int) lp->cliprect.maxx);
+      maxx = CLAMP(maxx, minx, (int) lp->cliprect.maxx);
+      miny = CLAMP(miny, (int) lp->cliprect.miny, (int) lp->cliprect.maxy);
+      maxy = CLAMP(maxy, miny, (int) lp->cliprect.maxy);
+
+      lp->tri_cliprect.minx = minx;
+      lp->tri_cliprect.maxx = maxx;
+      lp->tri_cliprect.miny = miny;
+      lp->tri_cliprect.maxy = maxy;
+   }
 }
 
 
@@ -214,6 +239,10 @@ update_tgsi_samplers( struct llvmpipe_context *llvmpipe )
    }
 
    for (i = 0; i < PIPE_MAX_SAMPLERS; i++) {
+      /* the generated code reads the texture memory directly */
+      if (llvmpipe->texture[i])
+         lp_tile_cache_flush_clear(llvmpipe->pipe.screen, llvmpipe->texture[i]);
+
       lp_tex_tile_cache_validate_texture( llvmpipe->tex_cache[i] );
    }
 
@@ -244,6 +273,7 @@ void llvmpipe_update_derived( struct llvmpipe_context *llvmpipe )
       invalidate_vertex_layout( llvmpipe );
 
    if (llvmpipe->dirty & (LP_NEW_SCISSOR |
+                          LP_NEW_VIEWPORT |
                           LP_NEW_RASTERIZER |
                           LP_NEW_FRAMEBUFFER))
       compute_cliprect(llvmpipe);
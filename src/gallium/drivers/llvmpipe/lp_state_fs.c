@@ -140,6 +140,7 @@ generate_depth(LLVMBuilderRef builder,
 {
    const struct util_format_description *format_desc;
    union lp_type dst_type;
+   unsigned z_swizzle;
 
    if(!key->depth.enabled)
       return;
@@ -147,6 +148,10 @@ generate_depth(LLVMBuilderRef builder,
    format_desc = util_format_description(key->zsbuf_format);
    assert(format_desc);
 
+   z_swizzle = format_desc->swizzle[0];
+   if(z_swizzle == UTIL_FORMAT_SWIZZLE_NONE)
+      return;
+
    /* Pick the depth type. */
    dst_type = lp_depth_type(format_desc, src_type.width*src_type.length);
 
@@ -154,14 +159,14 @@ generate_depth(LLVMBuilderRef builder,
    assert(dst_type.width == src_type.width);
    assert(dst_type.length == src_type.length);
 
-#if 1
-   src = lp_build_clamped_float_to_unsigned_norm(builder,
-                                                 src_type,
-                                                 dst_type.width,
-                                                 src);
-#else
-   lp_build_conv(builder, src_type, dst_type, &src, 1, &src, 1);
-#endif
+   /* Scale straight to the depth channel bits, so that the comparison is
+    * done on 32bit integers without any further shifting for Z24 formats */
+   if(!dst_type.floating) {
+      src = lp_build_clamped_float_to_unsigned_norm(builder,
+                                                    src_type,
+                                                    format_desc->channel[z_swizzle].size,
+                                                    src);
+   }
 
    lp_build_depth_test(builder,
                        &key->depth,
@@ -102,11 +102,16 @@ llvmpipe_set_sampler_textures(struct pipe_context *pipe,
       if(tex) {
          struct llvmpipe_texture *lp_tex = llvmpipe_texture(tex);
          struct lp_jit_texture *jit_tex = &llvmpipe->jit_context.textures[i];
+         unsigned level;
          jit_tex->width = tex->width[0];
          jit_tex->height = tex->height[0];
-         jit_tex->stride = lp_tex->stride[0];
-         if(!lp_tex->dt)
-            jit_tex->data = lp_tex->data;
+         jit_tex->last_level = tex->last_level;
+         for (level = 0; level <= tex->last_level; ++level) {
+            jit_tex->row_stride[level] = lp_tex->stride[level];
+            if(!lp_tex->dt)
+               jit_tex->data[level] = (uint8_t *)lp_tex->data +
+                                      lp_tex->level_offset[level];
+         }
       }
    }
 
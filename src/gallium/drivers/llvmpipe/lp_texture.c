@@ -41,6 +41,7 @@
 #include "lp_state.h"
 #include "lp_texture.h"
 #include "lp_tex_cache.h"
+#include "lp_tile_cache.h"
 #include "lp_screen.h"
 #include "lp_winsys.h"
 
@@ -201,6 +202,7 @@ llvmpipe_texture_destroy(struct pipe_texture *pt)
    else
       align_free(lpt->data);
 
+   FREE(lpt->clear);
    FREE(lpt);
 }
 
@@ -351,6 +353,10 @@ llvmpipe_transfer_map( struct pipe_screen *_screen,
    assert(transfer->texture);
    lpt = llvmpipe_texture(transfer->texture);
 
+   /* Anybody but the tile cache needs to see the deferred clears */
+   if (lpt->clear && !llvmpipe_transfer(transfer)->tile_cache)
+      lp_tile_cache_flush_clear(_screen, transfer->texture);
+
    if(lpt->dt) {
       struct llvmpipe_winsys *winsys = screen->winsys;
       unsigned flags = 0;
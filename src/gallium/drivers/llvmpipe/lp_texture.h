@@ -36,6 +36,7 @@ struct pipe_context;
 struct pipe_screen;
 struct llvmpipe_context;
 struct llvmpipe_displaytarget;
+struct llvmpipe_tile_clear;
 
 struct llvmpipe_texture
 {
@@ -56,6 +57,9 @@ struct llvmpipe_texture
    void *data;
 
    unsigned timestamp;
+
+   /** Deferred clear of one of the surfaces, see lp_tile_cache.c */
+   struct llvmpipe_tile_clear *clear;
 };
 
 struct llvmpipe_transfer
@@ -63,6 +67,9 @@ struct llvmpipe_transfer
    struct pipe_transfer base;
 
    unsigned long offset;
+
+   /** Mapped by a tile cache, which knows about deferred clears */
+   boolean tile_cache;
 };
 
 
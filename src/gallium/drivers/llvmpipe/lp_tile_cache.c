@@ -38,12 +38,53 @@
 #include "util/u_tile.h"
 #include "util/u_rect.h"
 #include "lp_context.h"
+#include "lp_screen.h"
 #include "lp_surface.h"
 #include "lp_texture.h"
 #include "lp_tile_soa.h"
 #include "lp_tile_cache.h"
 
 
+/**
+ * Deferred clear of one surface of a texture.
+ *
+ * Tiles flagged here were cleared and haven't been drawn to since, so
+ * their contents in the texture are stale.  The tile cache fills them in
+ * as it fetches them, and lp_tile_cache_flush_clear() fills in the rest
+ * once somebody else needs to look at the texture.
+ */
+struct llvmpipe_tile_clear
+{
+   unsigned face, level, zslice;  /**< which surface */
+   uint8_t color[4];  /**< for color bufs */
+   uint value;        /**< packed clear value */
+   boolean cleared[MAX_HEIGHT/TILE_SIZE][MAX_WIDTH/TILE_SIZE];
+};
+
+
+/**
+ * Return the deferred clear of the surface being cached, if any.
+ */
+static INLINE struct llvmpipe_tile_clear *
+get_tile_clear(const struct llvmpipe_tile_cache *tc)
+{
+   const struct pipe_surface *ps = tc->surface;
+   struct llvmpipe_tile_clear *clear;
+
+   if (!ps)
+      return NULL;
+
+   clear = llvmpipe_texture(ps->texture)->clear;
+   if (clear &&
+       clear->face == ps->face &&
+       clear->level == ps->level &&
+       clear->zslice == ps->zslice)
+      return clear;
+
+   return NULL;
+}
+
+
 struct llvmpipe_tile_cache *
 lp_create_tile_cache( struct pipe_screen *screen )
 {
@@ -115,6 +156,8 @@ lp_tile_cache_set_surface(struct llvmpipe_tile_cache *tc,
                                               ps->level, ps->zslice,
                                               PIPE_TRANSFER_READ_WRITE,
                                               0, 0, ps->width, ps->height);
+      if (tc->transfer)
+         llvmpipe_transfer(tc->transfer)->tile_cache = TRUE;
 
       for (y = 0; y < ps->height; y += TILE_SIZE) {
          for (x = 0; x < ps->width; x += TILE_SIZE) {
@@ -180,9 +223,59 @@ clear_tile(struct llvmpipe_cached_tile *tile,
 }
 
 
+/**
+ * Actually clear the tiles of the texture which were flagged as being in a
+ * clear state, so that the texture contents can be looked at directly.
+ */
+void
+lp_tile_cache_flush_clear(struct pipe_screen *screen,
+                          struct pipe_texture *texture)
+{
+   struct llvmpipe_texture *lpt = llvmpipe_texture(texture);
+   struct llvmpipe_tile_clear *clear = lpt->clear;
+   struct pipe_transfer *pt;
+   void *dst;
+   unsigned w, h, x, y;
+
+   if (!clear)
+      return;
+
+   /* detach it first, as mapping the transfer below gets back here */
+   lpt->clear = NULL;
+
+   w = texture->width[clear->level];
+   h = texture->height[clear->level];
+
+   pt = screen->get_tex_transfer(screen, texture, clear->face,
+                                 clear->level, clear->zslice,
+                                 PIPE_TRANSFER_WRITE, 0, 0, w, h);
+   if (pt) {
+      dst = screen->transfer_map(screen, pt);
+      assert(dst);
+      if (dst) {
+         for (y = 0; y < h; y += TILE_SIZE) {
+            for (x = 0; x < w; x += TILE_SIZE) {
+               if (clear->cleared[y/TILE_SIZE][x/TILE_SIZE])
+                  util_fill_rect(dst, &pt->block, pt->stride,
+                                 x, y,
+                                 MIN2(TILE_SIZE, w - x),
+                                 MIN2(TILE_SIZE, h - y),
+                                 clear->value);
+            }
+         }
+         screen->transfer_unmap(screen, pt);
+      }
+      screen->tex_transfer_destroy(pt);
+   }
+
+   FREE(clear);
+}
+
+
 /**
  * Flush the tile cache: write all dirty tiles back to the transfer.
- * any tiles "flagged" as cleared will be "really" cleared.
+ * Tiles "flagged" as cleared are left alone, unless the surface is going
+ * to be displayed.
  */
 void
 lp_flush_tile_cache(struct llvmpipe_tile_cache *tc)
@@ -193,47 +286,18 @@ lp_flush_tile_cache(struct llvmpipe_tile_cache *tc)
    if(!pt)
       return;
 
-   /* push the tile to all positions marked as clear */
    for (y = 0; y < pt->height; y += TILE_SIZE) {
       for (x = 0; x < pt->width; x += TILE_SIZE) {
          struct llvmpipe_cached_tile *tile = &tc->entries[y/TILE_SIZE][x/TILE_SIZE];
 
-         switch(tile->status) {
-         case LP_TILE_STATUS_UNDEFINED:
-            break;
-
-         case LP_TILE_STATUS_CLEAR: {
-            /**
-             * Actually clear the tiles which were flagged as being in a clear state.
-             */
-
-            struct pipe_screen *screen = pt->texture->screen;
-            unsigned tw = TILE_SIZE;
-            unsigned th = TILE_SIZE;
-            void *dst;
-
-            if (pipe_clip_tile(x, y, &tw, &th, pt))
-               continue;
-
-            dst = screen->transfer_map(screen, pt);
-            assert(dst);
-            if(!dst)
-               continue;
-
-            util_fill_rect(dst, &pt->block, pt->stride,
-                           x, y, tw,  th,
-                           tc->clear_val);
-
-            screen->transfer_unmap(screen, pt);
-            break;
-         }
-
-         case LP_TILE_STATUS_DEFINED:
+         if(tile->status == LP_TILE_STATUS_DEFINED)
             lp_put_tile_rgba_soa(pt, x, y, tile->color);
-            break;
-         }
       }
    }
+
+   /* The winsys reads display targets directly */
+   if (llvmpipe_texture(pt->texture)->dt)
+      lp_tile_cache_flush_clear(pt->texture->screen, pt->texture);
 }
 
 
@@ -247,17 +311,20 @@ lp_get_cached_tile(struct llvmpipe_tile_cache *tc,
 {
    struct llvmpipe_cached_tile *tile = &tc->entries[y/TILE_SIZE][x/TILE_SIZE];
    struct pipe_transfer *pt = tc->transfer;
+   struct llvmpipe_tile_clear *clear;
    
    switch(tile->status) {
-   case LP_TILE_STATUS_CLEAR:
-      /* don't get tile from framebuffer, just clear it */
-      clear_tile(tile, tc->clear_color);
-      tile->status = LP_TILE_STATUS_DEFINED;
-      break;
-
    case LP_TILE_STATUS_UNDEFINED:
-      /* get new tile data from transfer */
-      lp_get_tile_rgba_soa(pt, x, y, tile->color);
+      clear = get_tile_clear(tc);
+      if (clear && clear->cleared[y/TILE_SIZE][x/TILE_SIZE]) {
+         /* don't get tile from framebuffer, just clear it */
+         clear_tile(tile, clear->color);
+         clear->cleared[y/TILE_SIZE][x/TILE_SIZE] = FALSE;
+      }
+      else {
+         /* get new tile data from transfer */
+         lp_get_tile_rgba_soa(pt, x, y, tile->color);
+      }
       tile->status = LP_TILE_STATUS_DEFINED;
       break;
 
@@ -274,26 +341,61 @@ lp_get_cached_tile(struct llvmpipe_tile_cache *tc,
  * When a whole surface is being cleared to a value we can avoid
  * fetching tiles above.
  * Save the color and set a 'clearflag' for each tile of the screen.
+ * The flags are kept with the texture, so tiles which aren't drawn to
+ * never need to be written.
  */
 void
 lp_tile_cache_clear(struct llvmpipe_tile_cache *tc, const float *rgba,
                     uint clearValue)
 {
+   struct pipe_surface *ps = tc->surface;
    struct pipe_transfer *pt = tc->transfer;
+   struct llvmpipe_tile_clear *clear = get_tile_clear(tc);
    const unsigned w = pt->width;
    const unsigned h = pt->height;
    unsigned x, y, chan;
 
-   for(chan = 0; chan < 4; ++chan)
-      tc->clear_color[chan] = float_to_ubyte(rgba[chan]);
+   if (!clear) {
+      /* only one surface per texture can have a deferred clear */
+      lp_tile_cache_flush_clear(tc->screen, ps->texture);
 
-   tc->clear_val = clearValue;
+      clear = CALLOC_STRUCT(llvmpipe_tile_clear);
+      if (!clear) {
+         /* clear right away */
+         void *dst = tc->screen->transfer_map(tc->screen, pt);
+         if (dst) {
+            util_fill_rect(dst, &pt->block, pt->stride,
+                           0, 0, w, h, clearValue);
+            tc->screen->transfer_unmap(tc->screen, pt);
+         }
+      }
+      else {
+         clear->face = ps->face;
+         clear->level = ps->level;
+         clear->zslice = ps->zslice;
+         llvmpipe_texture(ps->texture)->clear = clear;
+      }
+   }
+
+   if (clear) {
+      for(chan = 0; chan < 4; ++chan)
+         clear->color[chan] = float_to_ubyte(rgba[chan]);
+
+      clear->value = clearValue;
+
+      /* make bound samplers resolve the clear before the next draw, as the
+       * generated code reads the texture memory directly */
+      llvmpipe_texture(ps->texture)->timestamp++;
+      llvmpipe_screen(tc->screen)->timestamp++;
+   }
 
-   /* push the tile to all positions marked as clear */
+   /* drop the cached contents, and mark all tiles as cleared */
    for (y = 0; y < h; y += TILE_SIZE) {
       for (x = 0; x < w; x += TILE_SIZE) {
          struct llvmpipe_cached_tile *tile = &tc->entries[y/TILE_SIZE][x/TILE_SIZE];
-         tile->status = LP_TILE_STATUS_CLEAR;
+         tile->status = LP_TILE_STATUS_UNDEFINED;
+         if (clear)
+            clear->cleared[y/TILE_SIZE][x/TILE_SIZE] = TRUE;
       }
    }
 }
@@ -36,8 +36,7 @@
 enum llvmpipe_tile_status
 {
    LP_TILE_STATUS_UNDEFINED = 0,
-   LP_TILE_STATUS_CLEAR = 1,
-   LP_TILE_STATUS_DEFINED = 2
+   LP_TILE_STATUS_DEFINED = 1
 };
 
 
@@ -64,9 +63,6 @@ struct llvmpipe_tile_cache
 
    struct llvmpipe_cached_tile entries[MAX_WIDTH/TILE_SIZE][MAX_HEIGHT/TILE_SIZE];
 
-   uint8_t clear_color[4];  /**< for color bufs */
-   uint clear_val;        /**< for z+stencil, or packed color clear value */
-
    struct llvmpipe_cached_tile *last_tile;  /**< most recently retrieved tile */
 };
 
@@ -97,6 +93,10 @@ extern void
 lp_tile_cache_clear(struct llvmpipe_tile_cache *tc, const float *rgba,
                     uint clearValue);
 
+extern void
+lp_tile_cache_flush_clear(struct pipe_screen *screen,
+                          struct pipe_texture *texture);
+
 extern void *
 lp_get_cached_tile(struct llvmpipe_tile_cache *tc,
                    unsigned x, unsigned y );
@@ -39,6 +39,7 @@
 #include "sp_flush.h"
 #include "sp_prim_setup.h"
 #include "sp_prim_vbuf.h"
+#include "sp_screen.h"
 #include "sp_state.h"
 #include "sp_surface.h"
 #include "sp_tile_cache.h"
@@ -289,6 +290,10 @@ softpipe_create( struct pipe_screen *screen )
    if (!softpipe->draw) 
       goto fail;
 
+   draw_set_guard_band(softpipe->draw,
+                       -SP_GUARD_BAND, -SP_GUARD_BAND,
+                       SP_GUARD_BAND, SP_GUARD_BAND);
+
    draw_texture_samplers(softpipe->draw,
                          PIPE_MAX_SAMPLERS,
                          (struct tgsi_sampler **)
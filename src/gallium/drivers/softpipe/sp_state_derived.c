@@ -181,6 +181,28 @@ compute_cliprect(struct softpipe_context *sp)
       sp->cliprect.maxx = surfWidth;
       sp->cliprect.maxy = surfHeight;
    }
+
+   sp->tri_cliprect = sp->cliprect;
+
+   if (!sp->rasterizer->bypass_vs_clip_and_viewport) {
+      /* Pixels whose centers fall inside the viewport */
+      const float *scale = sp->viewport.scale;
+      const float *trans = sp->viewport.translate;
+      int minx = (int) ceilf(trans[0] - fabsf(scale[0]) - 0.5f);
+      int maxx = (int) ceilf(trans[0] + fabsf(scale[0]) - 0.5f);
+      int miny = (int) ceilf(trans[1] - fabsf(scale[1]) - 0.5f);
+      int maxy = (int) ceilf(trans[1] + fabsf(scale[1]) - 0.5f);
+
+      minx = CLAMP(minx, (int) sp->cliprect.minx, (int) sp->cliprect.maxx);
+      maxx = CLAMP(maxx, minx, (int) sp->cliprect.maxx);
+      miny = CLAMP(miny, (int) sp->cliprect.miny, (int) sp->cliprect.maxy);
+      maxy = CLAMP(maxy, miny, (int) sp->cliprect.maxy);
+
+      sp->tri_cliprect.minx = minx;
+      sp->tri_cliprect.maxx = maxx;
+      sp->tri_cliprect.miny = miny;
+      sp->tri_cliprect.maxy = maxy;
+   }
 }
 
 
@@ -195,6 +217,8 @@ void softpipe_update_derived( struct softpipe_context *softpipe )
       invalidate_vertex_layout( softpipe );
 
    if (softpipe->dirty & (SP_NEW_SCISSOR |
+                          SP_NEW_VIEWPORT |
+                          SP_NEW_RASTERIZER |
                           SP_NEW_DEPTH_STENCIL_ALPHA |
                           SP_NEW_FRAMEBUFFER))
       compute_cliprect(softpipe);
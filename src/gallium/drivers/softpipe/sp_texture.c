@@ -38,6 +38,7 @@
 #include "sp_context.h"
 #include "sp_state.h"
 #include "sp_texture.h"
+#include "sp_tile_cache.h"
 #include "sp_screen.h"
 #include "sp_winsys.h"
 
@@ -180,6 +181,7 @@ softpipe_texture_destroy(struct pipe_texture *pt)
    struct softpipe_texture *spt = softpipe_texture(pt);
 
    pipe_buffer_reference(&spt->buffer, NULL);
+   FREE(spt->clear);
    FREE(spt);
 }
 
@@ -323,6 +325,10 @@ softpipe_transfer_map( struct pipe_screen *screen,
    assert(transfer->texture);
    spt = softpipe_texture(transfer->texture);
 
+   /* Anybody but the tile cache needs to see the deferred clears */
+   if (spt->clear && !softpipe_transfer(transfer)->tile_cache)
+      sp_tile_cache_flush_clear(screen, transfer->texture);
+
    if (transfer->usage != PIPE_TRANSFER_READ) {
       flags |= PIPE_BUFFER_USAGE_CPU_WRITE;
    }
@@ -398,6 +404,9 @@ softpipe_get_texture_buffer( struct pipe_texture *texture,
    if (!tex)
       return FALSE;
 
+   /* the caller will look at the buffer contents directly */
+   sp_tile_cache_flush_clear(texture->screen, texture);
+
    pipe_buffer_reference(buf, tex->buffer);
 
    if (stride)
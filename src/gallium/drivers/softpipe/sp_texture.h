@@ -35,6 +35,7 @@
 struct pipe_context;
 struct pipe_screen;
 struct softpipe_context;
+struct softpipe_tile_clear;
 
 
 struct softpipe_texture
@@ -49,6 +50,9 @@ struct softpipe_texture
    struct pipe_buffer *buffer;
 
    boolean modified;
+
+   /** Deferred clear of one of the surfaces, see sp_tile_cache.c */
+   struct softpipe_tile_clear *clear;
 };
 
 struct softpipe_transfer
@@ -56,6 +60,9 @@ struct softpipe_transfer
    struct pipe_transfer base;
 
    unsigned long offset;
+
+   /** Mapped by a tile cache, which knows about deferred clears */
+   boolean tile_cache;
 };
 
 
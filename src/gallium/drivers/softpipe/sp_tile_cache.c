@@ -33,7 +33,9 @@
  */
 
 #include "pipe/p_inlines.h"
+#include "util/u_math.h"
 #include "util/u_memory.h"
+#include "util/u_rect.h"
 #include "util/u_tile.h"
 #include "sp_context.h"
 #include "sp_surface.h"
@@ -48,6 +50,25 @@
 #define MAX_HEIGHT 2048
 
 
+/**
+ * Deferred clear of one surface of a texture.
+ *
+ * Tiles flagged here were cleared and haven't been drawn to since, so
+ * their contents in the texture are stale.  The tile cache fills them in
+ * as it fetches them, and sp_tile_cache_flush_clear() fills in the rest
+ * once somebody else needs to look at the texture.  This lives with the
+ * texture rather than the tile cache so that it survives flushes and
+ * framebuffer changes.
+ */
+struct softpipe_tile_clear
+{
+   unsigned face, level, zslice;  /**< which surface */
+   float color[4];  /**< for color bufs */
+   uint value;      /**< for z+stencil, or packed color clear value */
+   uint flags[(MAX_WIDTH / TILE_SIZE) * (MAX_HEIGHT / TILE_SIZE) / 32];
+};
+
+
 struct softpipe_tile_cache
 {
    struct pipe_screen *screen;
@@ -56,9 +77,6 @@ struct softpipe_tile_cache
    void *transfer_map;
    struct pipe_texture *texture;  /**< if caching a texture */
    struct softpipe_cached_tile entries[NUM_ENTRIES];
-   uint clear_flags[(MAX_WIDTH / TILE_SIZE) * (MAX_HEIGHT / TILE_SIZE) / 32];
-   float clear_color[4];  /**< for color bufs */
-   uint clear_val;        /**< for z+stencil, or packed color clear value */
    boolean depth_stencil; /**< Is the surface a depth/stencil format? */
 
    struct pipe_transfer *tex_trans;
@@ -109,6 +127,29 @@ clear_clear_flag(uint *bitvec, int x, int y)
    assert(pos / 32 < (MAX_WIDTH / TILE_SIZE) * (MAX_HEIGHT / TILE_SIZE) / 32);
    bitvec[pos / 32] &= ~(1 << (pos & 31));
 }
+
+
+/**
+ * Return the deferred clear of the surface being cached, if any.
+ */
+static INLINE struct softpipe_tile_clear *
+get_tile_clear(const struct softpipe_tile_cache *tc)
+{
+   const struct pipe_surface *ps = tc->surface;
+   struct softpipe_tile_clear *clear;
+
+   if (!ps)
+      return NULL;
+
+   clear = softpipe_texture(ps->texture)->clear;
+   if (clear &&
+       clear->face == ps->face &&
+       clear->level == ps->level &&
+       clear->zslice == ps->zslice)
+      return clear;
+
+   return NULL;
+}
    
 
 struct softpipe_tile_cache *
@@ -184,6 +225,8 @@ sp_tile_cache_set_surface(struct softpipe_tile_cache *tc,
                                               ps->level, ps->zslice,
                                               PIPE_TRANSFER_READ_WRITE,
                                               0, 0, ps->width, ps->height);
+      if (tc->transfer)
+         softpipe_transfer(tc->transfer)->tile_cache = TRUE;
 
       tc->depth_stencil = (ps->format == PIPE_FORMAT_S8Z24_UNORM ||
                            ps->format == PIPE_FORMAT_X8Z24_UNORM ||
@@ -341,45 +384,63 @@ clear_tile(struct softpipe_cached_tile *tile,
 
 
 /**
- * Actually clear the tiles which were flagged as being in a clear state.
+ * Actually clear the tiles of the texture which were flagged as being in a
+ * clear state, so that the texture contents can be looked at directly.
  */
-static void
-sp_tile_cache_flush_clear(struct pipe_context *pipe,
-                          struct softpipe_tile_cache *tc)
+void
+sp_tile_cache_flush_clear(struct pipe_screen *screen,
+                          struct pipe_texture *texture)
 {
-   struct pipe_transfer *pt = tc->transfer;
-   const uint w = tc->transfer->width;
-   const uint h = tc->transfer->height;
-   uint x, y;
+   struct softpipe_texture *spt = softpipe_texture(texture);
+   struct softpipe_tile_clear *clear = spt->clear;
+   struct pipe_transfer *pt;
+   ubyte *map;
+   uint w, h, x, y;
    uint numCleared = 0;
 
-   /* clear the scratch tile to the clear value */
-   clear_tile(&tc->tile, pt->format, tc->clear_val);
+   if (!clear)
+      return;
 
-   /* push the tile to all positions marked as clear */
-   for (y = 0; y < h; y += TILE_SIZE) {
-      for (x = 0; x < w; x += TILE_SIZE) {
-         if (is_clear_flag_set(tc->clear_flags, x, y)) {
-            pipe_put_tile_raw(pt,
-                              x, y, TILE_SIZE, TILE_SIZE,
-                              tc->tile.data.color32, 0/*STRIDE*/);
+   /* detach it first, as mapping the transfer below gets back here */
+   spt->clear = NULL;
 
-            /* do this? */
-            clear_clear_flag(tc->clear_flags, x, y);
+   w = texture->width[clear->level];
+   h = texture->height[clear->level];
 
-            numCleared++;
+   pt = screen->get_tex_transfer(screen, texture, clear->face,
+                                 clear->level, clear->zslice,
+                                 PIPE_TRANSFER_WRITE, 0, 0, w, h);
+   if (pt) {
+      map = screen->transfer_map(screen, pt);
+      if (map) {
+         /* fill all positions marked as clear */
+         for (y = 0; y < h; y += TILE_SIZE) {
+            for (x = 0; x < w; x += TILE_SIZE) {
+               if (is_clear_flag_set(clear->flags, x, y)) {
+                  util_fill_rect(map, &pt->block, pt->stride, x, y,
+                                 MIN2(TILE_SIZE, w - x),
+                                 MIN2(TILE_SIZE, h - y),
+                                 clear->value);
+                  numCleared++;
+               }
+            }
          }
+         screen->transfer_unmap(screen, pt);
       }
+      screen->tex_transfer_destroy(pt);
    }
 #if 0
    debug_printf("num cleared: %u\n", numCleared);
 #endif
+
+   FREE(clear);
 }
 
 
 /**
  * Flush the tile cache: write all dirty tiles back to the transfer.
- * any tiles "flagged" as cleared will be "really" cleared.
+ * Tiles "flagged" as cleared are left alone, unless the surface is going
+ * to be displayed.
  */
 void
 sp_flush_tile_cache(struct softpipe_context *softpipe,
@@ -409,7 +470,10 @@ sp_flush_tile_cache(struct softpipe_context *softpipe,
       }
 
 #if TILE_CLEAR_OPTIMIZATION
-      sp_tile_cache_flush_clear(&softpipe->pipe, tc);
+      /* The winsys reads display targets directly */
+      if (pt->texture->tex_usage & (PIPE_TEXTURE_USAGE_DISPLAY_TARGET |
+                                    PIPE_TEXTURE_USAGE_PRIMARY))
+         sp_tile_cache_flush_clear(softpipe->pipe.screen, pt->texture);
 #endif
    }
    else if (tc->texture) {
@@ -443,6 +507,7 @@ sp_get_cached_tile(struct softpipe_context *softpipe,
    /* cache pos/entry: */
    const int pos = CACHE_POS(x, y);
    struct softpipe_cached_tile *tile = tc->entries + pos;
+   struct softpipe_tile_clear *clear;
 
    if (tile_x != tile->x ||
        tile_y != tile->y) {
@@ -464,15 +529,16 @@ sp_get_cached_tile(struct softpipe_context *softpipe,
       tile->x = tile_x;
       tile->y = tile_y;
 
-      if (is_clear_flag_set(tc->clear_flags, x, y)) {
+      clear = get_tile_clear(tc);
+      if (clear && is_clear_flag_set(clear->flags, x, y)) {
          /* don't get tile from framebuffer, just clear it */
          if (tc->depth_stencil) {
-            clear_tile(tile, pt->format, tc->clear_val);
+            clear_tile(tile, pt->format, clear->value);
          }
          else {
-            clear_tile_rgba(tile, pt->format, tc->clear_color);
+            clear_tile_rgba(tile, pt->format, clear->color);
          }
-         clear_clear_flag(tc->clear_flags, x, y);
+         clear_clear_flag(clear->flags, x, y);
       }
       else {
          /* get new tile data from transfer */
@@ -528,6 +594,11 @@ sp_get_cached_tile_tex(struct softpipe_context *sp,
 
    if (tc->texture) {
       struct softpipe_texture *spt = softpipe_texture(tc->texture);
+
+      /* the texture may have been rendered to and cleared */
+      if (spt->clear)
+         sp_tile_cache_flush_clear(screen, tc->texture);
+
       if (spt->modified) {
          /* texture was modified, invalidate all cached tiles */
          uint p;
@@ -597,6 +668,8 @@ sp_get_cached_tile_tex(struct softpipe_context *sp,
  * When a whole surface is being cleared to a value we can avoid
  * fetching tiles above.
  * Save the color and set a 'clearflag' for each tile of the screen.
+ * The flags are kept with the texture, so tiles which aren't drawn to
+ * never need to be written.
  */
 void
 sp_tile_cache_clear(struct softpipe_tile_cache *tc, const float *rgba,
@@ -604,19 +677,43 @@ sp_tile_cache_clear(struct softpipe_tile_cache *tc, const float *rgba,
 {
    uint pos;
 
-   tc->clear_color[0] = rgba[0];
-   tc->clear_color[1] = rgba[1];
-   tc->clear_color[2] = rgba[2];
-   tc->clear_color[3] = rgba[3];
+#if TILE_CLEAR_OPTIMIZATION
+   struct pipe_surface *ps = tc->surface;
+   struct softpipe_tile_clear *clear = get_tile_clear(tc);
+
+   if (!clear) {
+      /* only one surface per texture can have a deferred clear */
+      sp_tile_cache_flush_clear(tc->screen, ps->texture);
+
+      clear = CALLOC_STRUCT(softpipe_tile_clear);
+      if (!clear) {
+         /* clear right away */
+         void *map = tc->screen->transfer_map(tc->screen, tc->transfer);
+         if (map) {
+            util_fill_rect(map, &tc->transfer->block, tc->transfer->stride,
+                           0, 0, ps->width, ps->height, clearValue);
+            tc->screen->transfer_unmap(tc->screen, tc->transfer);
+         }
+      }
+      else {
+         clear->face = ps->face;
+         clear->level = ps->level;
+         clear->zslice = ps->zslice;
+         softpipe_texture(ps->texture)->clear = clear;
+      }
+   }
 
-   tc->clear_val = clearValue;
+   if (clear) {
+      clear->color[0] = rgba[0];
+      clear->color[1] = rgba[1];
+      clear->color[2] = rgba[2];
+      clear->color[3] = rgba[3];
 
-#if TILE_CLEAR_OPTIMIZATION
-   /* set flags to indicate all the tiles are cleared */
-   memset(tc->clear_flags, 255, sizeof(tc->clear_flags));
-#else
-   /* disable the optimization */
-   memset(tc->clear_flags, 0, sizeof(tc->clear_flags));
+      clear->value = clearValue;
+
+      /* set flags to indicate all the tiles are cleared */
+      memset(clear->flags, 255, sizeof(clear->flags));
+   }
 #endif
 
    for (pos = 0; pos < NUM_ENTRIES; pos++) {
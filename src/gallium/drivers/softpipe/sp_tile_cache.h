@@ -92,6 +92,10 @@ extern void
 sp_tile_cache_clear(struct softpipe_tile_cache *tc, const float *rgba,
                     uint clearValue);
 
+extern void
+sp_tile_cache_flush_clear(struct pipe_screen *screen,
+                          struct pipe_texture *texture);
+
 extern struct softpipe_cached_tile *
 sp_get_cached_tile(struct softpipe_context *softpipe,
                    struct softpipe_tile_cache *tc, int x, int y);
@@ -30,10 +30,10 @@
  * @file
  * Trace dumping functions.
  *
- * For now we just use standard XML for dumping the trace calls, as this is
- * simple to write, parse, and visually inspect, but the actual representation
- * is abstracted out of this file, so that we can switch to a binary
- * representation if/when it becomes justified.
+ * By default we use standard XML for dumping the trace calls, as this is
+ * simple to write, parse, and visually inspect.  Setting GALLIUM_TRACE_BINARY
+ * selects the much more compact and faster binary representation in
+ * tr_dump_bin.c instead, which can be converted back to XML offline.
  *
  * @author Jose Fonseca <jrfonseca@tungstengraphics.com>
  */
@@ -52,6 +52,7 @@
 #include "util/u_stream.h"
 
 #include "tr_dump.h"
+#include "tr_dump_bin.h"
 #include "tr_screen.h"
 #include "tr_texture.h"
 #include "tr_buffer.h"
@@ -63,6 +64,7 @@ static pipe_mutex call_mutex;
 static long unsigned call_no = 0;
 static boolean dumping = FALSE;
 static boolean initialized = FALSE;
+static boolean binary = FALSE;
 
 
 static INLINE void
@@ -218,10 +220,16 @@ trace_dump_tag_end(const char *name)
 static void
 trace_dump_trace_close(void)
 {
-   if(stream) {
-      trace_dump_writes("</trace>\n");
-      util_stream_close(stream);
-      stream = NULL;
+   if(stream || binary) {
+      if(binary) {
+         trace_bin_end();
+         binary = FALSE;
+      }
+      else {
+         trace_dump_writes("</trace>\n");
+         util_stream_close(stream);
+         stream = NULL;
+      }
       refcount = 0;
       call_no = 0;
       pipe_mutex_destroy(call_mutex);
@@ -248,15 +256,22 @@ boolean trace_dump_trace_begin()
    if(!filename)
       return FALSE;
 
-   if(!stream) {
+   if(!stream && !binary) {
 
-      stream = util_stream_create(filename, 0);
-      if(!stream)
-         return FALSE;
+      if(debug_get_bool_option("GALLIUM_TRACE_BINARY", FALSE)) {
+         if(!trace_bin_begin(filename))
+            return FALSE;
+         binary = TRUE;
+      }
+      else {
+         stream = util_stream_create(filename, 0);
+         if(!stream)
+            return FALSE;
 
-      trace_dump_writes("<?xml version='1.0' encoding='UTF-8'?>\n");
-      trace_dump_writes("<?xml-stylesheet type='text/xsl' href='trace.xsl'?>\n");
-      trace_dump_writes("<trace version='0.1'>\n");
+         trace_dump_writes("<?xml version='1.0' encoding='UTF-8'?>\n");
+         trace_dump_writes("<?xml-stylesheet type='text/xsl' href='trace.xsl'?>\n");
+         trace_dump_writes("<trace version='0.1'>\n");
+      }
 
 #if defined(PIPE_OS_LINUX) || defined(PIPE_OS_BSD) || defined(PIPE_OS_SOLARIS)
       /* Linux applications rarely cleanup GL / Gallium resources so catch
@@ -272,12 +287,12 @@ boolean trace_dump_trace_begin()
 
 boolean trace_dump_trace_enabled(void)
 {
-   return stream ? TRUE : FALSE;
+   return (stream || binary) ? TRUE : FALSE;
 }
 
 void trace_dump_trace_end(void)
 {
-   if(stream)
+   if(stream || binary)
       if(!--refcount)
          trace_dump_trace_close();
 }
@@ -348,6 +363,11 @@ void trace_dump_call_begin_locked(const char *klass, const char *method)
       return;
 
    ++call_no;
+   if (binary) {
+      trace_bin_call_begin(call_no, klass, method);
+      return;
+   }
+
    trace_dump_indent(1);
    trace_dump_writes("<call no=\'");
    trace_dump_writef("%lu", call_no);
@@ -364,6 +384,11 @@ void trace_dump_call_end_locked(void)
    if (!dumping)
       return;
 
+   if (binary) {
+      trace_bin_op(TR_BIN_CALL_END);
+      return;
+   }
+
    trace_dump_indent(1);
    trace_dump_tag_end("call");
    trace_dump_newline();
@@ -387,6 +412,11 @@ void trace_dump_arg_begin(const char *name)
    if (!dumping)
       return;
 
+   if (binary) {
+      trace_bin_op_name(TR_BIN_ARG_BEGIN, name);
+      return;
+   }
+
    trace_dump_indent(2);
    trace_dump_tag_begin1("arg", "name", name);
 }
@@ -396,6 +426,11 @@ void trace_dump_arg_end(void)
    if (!dumping)
       return;
 
+   if (binary) {
+      trace_bin_op(TR_BIN_ARG_END);
+      return;
+   }
+
    trace_dump_tag_end("arg");
    trace_dump_newline();
 }
@@ -405,6 +440,11 @@ void trace_dump_ret_begin(void)
    if (!dumping)
       return;
 
+   if (binary) {
+      trace_bin_op(TR_BIN_RET_BEGIN);
+      return;
+   }
+
    trace_dump_indent(2);
    trace_dump_tag_begin("ret");
 }
@@ -414,6 +454,11 @@ void trace_dump_ret_end(void)
    if (!dumping)
       return;
 
+   if (binary) {
+      trace_bin_op(TR_BIN_RET_END);
+      return;
+   }
+
    trace_dump_tag_end("ret");
    trace_dump_newline();
 }
@@ -423,6 +468,11 @@ void trace_dump_bool(int value)
    if (!dumping)
       return;
 
+   if (binary) {
+      trace_bin_bool(value);
+      return;
+   }
+
    trace_dump_writef("<bool>%c</bool>", value ? '1' : '0');
 }
 
@@ -431,6 +481,11 @@ void trace_dump_int(long long int value)
    if (!dumping)
       return;
 
+   if (binary) {
+      trace_bin_int(value);
+      return;
+   }
+
    trace_dump_writef("<int>%lli</int>", value);
 }
 
@@ -439,6 +494,11 @@ void trace_dump_uint(long long unsigned value)
    if (!dumping)
       return;
 
+   if (binary) {
+      trace_bin_uint(value);
+      return;
+   }
+
    trace_dump_writef("<uint>%llu</uint>", value);
 }
 
@@ -447,6 +507,11 @@ void trace_dump_float(double value)
    if (!dumping)
       return;
 
+   if (binary) {
+      trace_bin_float(value);
+      return;
+   }
+
    trace_dump_writef("<float>%g</float>", value);
 }
 
@@ -460,6 +525,11 @@ void trace_dump_bytes(const void *data,
    if (!dumping)
       return;
 
+   if (binary) {
+      trace_bin_bytes(data, size);
+      return;
+   }
+
    trace_dump_writes("<bytes>");
    for(i = 0; i < size; ++i) {
       uint8_t byte = *p++;
@@ -476,6 +546,11 @@ void trace_dump_string(const char *str)
    if (!dumping)
       return;
 
+   if (binary) {
+      trace_bin_string(str);
+      return;
+   }
+
    trace_dump_writes("<string>");
    trace_dump_escape(str);
    trace_dump_writes("</string>");
@@ -486,6 +561,11 @@ void trace_dump_enum(const char *value)
    if (!dumping)
       return;
 
+   if (binary) {
+      trace_bin_op_name(TR_BIN_ENUM, value);
+      return;
+   }
+
    trace_dump_writes("<enum>");
    trace_dump_escape(value);
    trace_dump_writes("</enum>");
@@ -496,6 +576,11 @@ void trace_dump_array_begin(void)
    if (!dumping)
       return;
 
+   if (binary) {
+      trace_bin_op(TR_BIN_ARRAY_BEGIN);
+      return;
+   }
+
    trace_dump_writes("<array>");
 }
 
@@ -504,6 +589,11 @@ void trace_dump_array_end(void)
    if (!dumping)
       return;
 
+   if (binary) {
+      trace_bin_op(TR_BIN_ARRAY_END);
+      return;
+   }
+
    trace_dump_writes("</array>");
 }
 
@@ -512,6 +602,11 @@ void trace_dump_elem_begin(void)
    if (!dumping)
       return;
 
+   if (binary) {
+      trace_bin_op(TR_BIN_ELEM_BEGIN);
+      return;
+   }
+
    trace_dump_writes("<elem>");
 }
 
@@ -520,6 +615,11 @@ void trace_dump_elem_end(void)
    if (!dumping)
       return;
 
+   if (binary) {
+      trace_bin_op(TR_BIN_ELEM_END);
+      return;
+   }
+
    trace_dump_writes("</elem>");
 }
 
@@ -528,6 +628,11 @@ void trace_dump_struct_begin(const char *name)
    if (!dumping)
       return;
 
+   if (binary) {
+      trace_bin_op_name(TR_BIN_STRUCT_BEGIN, name);
+      return;
+   }
+
    trace_dump_writef("<struct name='%s'>", name);
 }
 
@@ -536,6 +641,11 @@ void trace_dump_struct_end(void)
    if (!dumping)
       return;
 
+   if (binary) {
+      trace_bin_op(TR_BIN_STRUCT_END);
+      return;
+   }
+
    trace_dump_writes("</struct>");
 }
 
@@ -544,6 +654,11 @@ void trace_dump_member_begin(const char *name)
    if (!dumping)
       return;
 
+   if (binary) {
+      trace_bin_op_name(TR_BIN_MEMBER_BEGIN, name);
+      return;
+   }
+
    trace_dump_writef("<member name='%s'>", name);
 }
 
@@ -552,6 +667,11 @@ void trace_dump_member_end(void)
    if (!dumping)
       return;
 
+   if (binary) {
+      trace_bin_op(TR_BIN_MEMBER_END);
+      return;
+   }
+
    trace_dump_writes("</member>");
 }
 
@@ -560,6 +680,11 @@ void trace_dump_null(void)
    if (!dumping)
       return;
 
+   if (binary) {
+      trace_bin_op(TR_BIN_NULL);
+      return;
+   }
+
    trace_dump_writes("<null/>");
 }
 
@@ -568,7 +693,9 @@ void trace_dump_ptr(const void *value)
    if (!dumping)
       return;
 
-   if(value)
+   if(value && binary)
+      trace_bin_ptr(value);
+   else if(value)
       trace_dump_writef("<ptr>0x%08lx</ptr>", (unsigned long)(uintptr_t)value);
    else
       trace_dump_null();
@@ -0,0 +1,559 @@
+/**************************************************************************
+ *
+ * Copyright 2009 VMware, Inc.
+ * All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sub license, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the
+ * next paragraph) shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT.
+ * IN NO EVENT SHALL VMWARE AND/OR ITS SUPPLIERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ **************************************************************************/
+
+/**
+ * @file
+ * Binary trace writer.
+ *
+ * All records are written while holding the trace call mutex, so they
+ * are simply appended to the current chunk.  Full chunks are queued for
+ * a writer thread, which keeps the file I/O off the traced application's
+ * threads.  Without thread support, or if the thread can't be started,
+ * the chunks are written directly.
+ *
+ * Running out of memory for a chunk ends the trace there: the stream is
+ * closed and everything else is dropped, rather than leaving a partial
+ * record in the middle of the file.
+ */
+
+#include "pipe/p_config.h"
+#include "pipe/p_compiler.h"
+#include "pipe/p_thread.h"
+#include "util/u_debug.h"
+#include "util/u_math.h"
+#include "util/u_memory.h"
+#include "util/u_string.h"
+#include "util/u_stream.h"
+
+#include "tr_dump_bin.h"
+
+
+#if defined(PIPE_OS_LINUX) || defined(PIPE_OS_BSD) || defined(PIPE_OS_SOLARIS)
+#define TR_BIN_THREAD 1
+#endif
+
+#define TR_BIN_CHUNK_SIZE (1024*1024)
+#define TR_BIN_MAX_QUEUED 16
+
+
+struct tr_bin_chunk
+{
+   size_t used;
+   uint8_t data[TR_BIN_CHUNK_SIZE];
+};
+
+
+/** Interned name, or hash of a blob's contents */
+struct tr_bin_entry
+{
+   uint64_t hash;
+   size_t size;
+   const char *str;
+   unsigned id;
+};
+
+
+struct tr_bin_table
+{
+   struct tr_bin_entry *entries;
+   unsigned size;               /**< power of two */
+   unsigned count;
+};
+
+
+static struct util_stream *stream = NULL;
+static struct tr_bin_chunk *chunk = NULL;
+
+static struct tr_bin_table names;
+static struct tr_bin_table blobs;
+
+#ifdef TR_BIN_THREAD
+static boolean threaded = FALSE;
+static pipe_thread writer;
+static pipe_mutex queue_mutex;
+static pipe_condvar queue_cond;
+static struct tr_bin_chunk *queue[TR_BIN_MAX_QUEUED];
+static unsigned queue_head = 0;
+static unsigned queue_count = 0;
+static boolean queue_quit = FALSE;
+#endif
+
+
+/*
+ * Chunk queue.
+ */
+
+#ifdef TR_BIN_THREAD
+
+static PIPE_THREAD_ROUTINE(trace_bin_writer, param)
+{
+   for (;;) {
+      struct tr_bin_chunk *c;
+
+      pipe_mutex_lock(queue_mutex);
+      while (!queue_count && !queue_quit)
+         pipe_condvar_wait(queue_cond, queue_mutex);
+      if (!queue_count) {
+         pipe_mutex_unlock(queue_mutex);
+         break;
+      }
+      c = queue[queue_head];
+      queue_head = (queue_head + 1) % TR_BIN_MAX_QUEUED;
+      --queue_count;
+      pipe_condvar_broadcast(queue_cond);
+      pipe_mutex_unlock(queue_mutex);
+
+      util_stream_write(stream, c->data, c->used);
+      FREE(c);
+   }
+
+   return NULL;
+}
+
+#endif
+
+
+static void
+trace_bin_submit(void)
+{
+   struct tr_bin_chunk *c = chunk;
+
+   chunk = NULL;
+   if (!c)
+      return;
+
+   if (!c->used) {
+      FREE(c);
+      return;
+   }
+
+#ifdef TR_BIN_THREAD
+   if (threaded) {
+      /* Block if the writer falls too far behind, rather than buffering
+       * an unbounded amount of the trace in memory.
+       */
+      pipe_mutex_lock(queue_mutex);
+      while (queue_count == TR_BIN_MAX_QUEUED)
+         pipe_condvar_wait(queue_cond, queue_mutex);
+      queue[(queue_head + queue_count) % TR_BIN_MAX_QUEUED] = c;
+      ++queue_count;
+      pipe_condvar_broadcast(queue_cond);
+      pipe_mutex_unlock(queue_mutex);
+      return;
+   }
+#endif
+
+   util_stream_write(stream, c->data, c->used);
+   FREE(c);
+}
+
+
+/**
+ * Wait for the queued chunks to be written and close the stream.
+ */
+static void
+trace_bin_close(void)
+{
+#ifdef TR_BIN_THREAD
+   if (threaded) {
+      pipe_mutex_lock(queue_mutex);
+      queue_quit = TRUE;
+      pipe_condvar_broadcast(queue_cond);
+      pipe_mutex_unlock(queue_mutex);
+      pipe_thread_wait(writer);
+      threaded = FALSE;
+   }
+   pipe_condvar_destroy(queue_cond);
+   pipe_mutex_destroy(queue_mutex);
+#endif
+
+   util_stream_close(stream);
+   stream = NULL;
+}
+
+
+static INLINE void
+trace_bin_write(const void *data, size_t size)
+{
+   const uint8_t *p = (const uint8_t *)data;
+
+   if (!stream)
+      return;
+
+   while (size) {
+      size_t n;
+
+      if (!chunk) {
+         chunk = MALLOC_STRUCT(tr_bin_chunk);
+         if (!chunk) {
+            /* Stop here for good; the record being written is incomplete,
+             * so nothing after it could be read back anyway.  With the
+             * stream gone every later write is dropped.
+             */
+            debug_printf("%s - out of memory, trace truncated\n",
+                         __FUNCTION__);
+            trace_bin_close();
+            return;
+         }
+         chunk->used = 0;
+      }
+
+      n = MIN2(size, TR_BIN_CHUNK_SIZE - chunk->used);
+      memcpy(chunk->data + chunk->used, p, n);
+      chunk->used += n;
+      p += n;
+      size -= n;
+
+      if (chunk->used == TR_BIN_CHUNK_SIZE)
+         trace_bin_submit();
+   }
+}
+
+
+static INLINE void
+trace_bin_write_byte(unsigned value)
+{
+   uint8_t b = (uint8_t)value;
+   trace_bin_write(&b, 1);
+}
+
+
+static void
+trace_bin_write_varint(uint64_t value)
+{
+   uint8_t buf[10];
+   unsigned n = 0;
+
+   while (value >= 0x80) {
+      buf[n++] = (uint8_t)(value | 0x80);
+      value >>= 7;
+   }
+   buf[n++] = (uint8_t)value;
+
+   trace_bin_write(buf, n);
+}
+
+
+/*
+ * Hash tables for interned names and blobs.
+ */
+
+static uint64_t
+trace_bin_hash(const void *data, size_t size)
+{
+   const uint8_t *p = (const uint8_t *)data;
+   uint64_t h = 0xcbf29ce484222325ULL ^ size;
+
+   /* FNV-1a style, but mixing in eight bytes at a time */
+   while (size >= 8) {
+      uint64_t w;
+      memcpy(&w, p, 8);
+      h = (h ^ w) * 0x100000001b3ULL;
+      h ^= h >> 29;
+      p += 8;
+      size -= 8;
+   }
+   while (size--) {
+      h = (h ^ *p++) * 0x100000001b3ULL;
+   }
+
+   return h ^ (h >> 32);
+}
+
+
+static boolean
+trace_bin_table_grow(struct tr_bin_table *table)
+{
+   unsigned size = table->size ? table->size * 2 : 256;
+   struct tr_bin_entry *entries = CALLOC(size, sizeof *entries);
+   unsigned i;
+
+   if (!entries)
+      return FALSE;
+
+   for (i = 0; i < table->size; ++i) {
+      struct tr_bin_entry *e = &table->entries[i];
+      if (e->id) {
+         unsigned j = (unsigned)e->hash & (size - 1);
+         while (entries[j].id)
+            j = (j + 1) & (size - 1);
+         entries[j] = *e;
+      }
+   }
+
+   FREE(table->entries);
+   table->entries = entries;
+   table->size = size;
+   return TRUE;
+}
+
+
+/**
+ * Find the entry for the given hash and size (and string, for names),
+ * or an empty slot for it.  Ids start at 1 so that 0 marks free slots.
+ */
+static struct tr_bin_entry *
+trace_bin_table_lookup(struct tr_bin_table *table,
+                       uint64_t hash, size_t size, const char *str)
+{
+   unsigned i;
+
+   if (table->count * 2 >= table->size)
+      if (!trace_bin_table_grow(table))
+         return NULL;
+
+   i = (unsigned)hash & (table->size - 1);
+   while (table->entries[i].id) {
+      struct tr_bin_entry *e = &table->entries[i];
+      if (e->hash == hash && e->size == size &&
+          (!str || memcmp(e->str, str, size) == 0))
+         return e;
+      i = (i + 1) & (table->size - 1);
+   }
+
+   return &table->entries[i];
+}
+
+
+static void
+trace_bin_table_destroy(struct tr_bin_table *table)
+{
+   unsigned i;
+
+   for (i = 0; i < table->size; ++i)
+      FREE((void *)table->entries[i].str);
+   FREE(table->entries);
+   memset(table, 0, sizeof *table);
+}
+
+
+/**
+ * Return the id for a name, defining it first if this is its first use.
+ */
+static unsigned
+trace_bin_name(const char *name)
+{
+   size_t len = strlen(name);
+   uint64_t hash = trace_bin_hash(name, len);
+   struct tr_bin_entry *e = trace_bin_table_lookup(&names, hash, len, name);
+   char *str;
+
+   if (!e)
+      return 0;
+   if (e->id)
+      return e->id;
+
+   str = MALLOC(len + 1);
+   if (!str)
+      return 0;
+   memcpy(str, name, len + 1);
+
+   e->hash = hash;
+   e->size = len;
+   e->str = str;
+   e->id = ++names.count;
+
+   trace_bin_write_byte(TR_BIN_STRING_DEF);
+   trace_bin_write_varint(e->id);
+   trace_bin_write_varint(len);
+   trace_bin_write(name, len);
+
+   return e->id;
+}
+
+
+/*
+ * Public functions.
+ */
+
+boolean
+trace_bin_begin(const char *filename)
+{
+   uint8_t version[4];
+
+   stream = util_stream_create(filename, 0);
+   if (!stream)
+      return FALSE;
+
+   version[0] = TR_BIN_VERSION & 0xff;
+   version[1] = (TR_BIN_VERSION >> 8) & 0xff;
+   version[2] = (TR_BIN_VERSION >> 16) & 0xff;
+   version[3] = (TR_BIN_VERSION >> 24) & 0xff;
+   util_stream_write(stream, TR_BIN_MAGIC, 4);
+   util_stream_write(stream, version, 4);
+
+#ifdef TR_BIN_THREAD
+   pipe_mutex_init(queue_mutex);
+   pipe_condvar_init(queue_cond);
+   queue_head = 0;
+   queue_count = 0;
+   queue_quit = FALSE;
+   writer = pipe_thread_create(trace_bin_writer, NULL);
+   threaded = writer ? TRUE : FALSE;
+   if (!threaded)
+      debug_printf("%s - no writer thread, writing synchronously\n",
+                   __FUNCTION__);
+#endif
+
+   return TRUE;
+}
+
+
+void
+trace_bin_end(void)
+{
+   if (stream) {
+      trace_bin_submit();
+      trace_bin_close();
+   }
+
+   trace_bin_table_destroy(&names);
+   trace_bin_table_destroy(&blobs);
+}
+
+
+void
+trace_bin_op(unsigned op)
+{
+   trace_bin_write_byte(op);
+}
+
+
+void
+trace_bin_op_name(unsigned op, const char *name)
+{
+   unsigned id = trace_bin_name(name);
+   trace_bin_write_byte(op);
+   trace_bin_write_varint(id);
+}
+
+
+void
+trace_bin_call_begin(unsigned long call_no,
+                     const char *klass, const char *method)
+{
+   unsigned klass_id = trace_bin_name(klass);
+   unsigned method_id = trace_bin_name(method);
+
+   trace_bin_write_byte(TR_BIN_CALL_BEGIN);
+   trace_bin_write_varint(call_no);
+   trace_bin_write_varint(klass_id);
+   trace_bin_write_varint(method_id);
+}
+
+
+void
+trace_bin_bool(int value)
+{
+   uint8_t buf[2];
+   buf[0] = TR_BIN_BOOL;
+   buf[1] = value ? 1 : 0;
+   trace_bin_write(buf, 2);
+}
+
+
+void
+trace_bin_int(long long int value)
+{
+   uint64_t v = (uint64_t)value;
+   trace_bin_write_byte(TR_BIN_INT);
+   trace_bin_write_varint((v << 1) ^ (value < 0 ? ~(uint64_t)0 : 0));
+}
+
+
+void
+trace_bin_uint(long long unsigned value)
+{
+   trace_bin_write_byte(TR_BIN_UINT);
+   trace_bin_write_varint(value);
+}
+
+
+void
+trace_bin_float(double value)
+{
+   uint8_t buf[9];
+   uint64_t bits;
+   unsigned i;
+
+   memcpy(&bits, &value, 8);
+   buf[0] = TR_BIN_FLOAT;
+   for (i = 0; i < 8; ++i)
+      buf[1 + i] = (uint8_t)(bits >> (i * 8));
+   trace_bin_write(buf, 9);
+}
+
+
+void
+trace_bin_bytes(const void *data, size_t size)
+{
+   uint64_t hash;
+   struct tr_bin_entry *e;
+
+   if (size >= TR_BIN_BLOB_MIN_SIZE) {
+      hash = trace_bin_hash(data, size);
+      e = trace_bin_table_lookup(&blobs, hash, size, NULL);
+      if (e) {
+         if (!e->id) {
+            e->hash = hash;
+            e->size = size;
+            e->id = ++blobs.count;
+
+            trace_bin_write_byte(TR_BIN_BLOB_DEF);
+            trace_bin_write_varint(e->id);
+            trace_bin_write_varint(size);
+            trace_bin_write(data, size);
+         }
+
+         trace_bin_write_byte(TR_BIN_BLOB);
+         trace_bin_write_varint(e->id);
+         return;
+      }
+   }
+
+   trace_bin_write_byte(TR_BIN_BYTES);
+   trace_bin_write_varint(size);
+   trace_bin_write(data, size);
+}
+
+
+void
+trace_bin_string(const char *str)
+{
+   size_t len = strlen(str);
+   trace_bin_write_byte(TR_BIN_STRING);
+   trace_bin_write_varint(len);
+   trace_bin_write(str, len);
+}
+
+
+void
+trace_bin_ptr(const void *value)
+{
+   trace_bin_write_byte(TR_BIN_PTR);
+   trace_bin_write_varint((uint64_t)(uintptr_t)value);
+}
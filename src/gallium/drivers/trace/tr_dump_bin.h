@@ -0,0 +1,114 @@
+/**************************************************************************
+ *
+ * Copyright 2009 VMware, Inc.
+ * All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sub license, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the
+ * next paragraph) shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT.
+ * IN NO EVENT SHALL VMWARE AND/OR ITS SUPPLIERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ **************************************************************************/
+
+/**
+ * @file
+ * Binary trace format.
+ *
+ * A binary trace starts with the four bytes "GTRB" and a little-endian
+ * 32 bit version number, followed by a stream of records.  Each record
+ * is an opcode byte and its operands.  The records mirror the elements
+ * of the XML format one to one, so a binary trace can be converted back
+ * to XML without loss (see progs/trace/bin2xml).
+ *
+ * Operands are unsigned LEB128 varints unless noted otherwise.  Names
+ * (classes, methods, args, structs, members and enums) are interned:
+ * the first use of a name is preceded by a TR_BIN_STRING_DEF record and
+ * all uses refer to it by id.  Byte arrays of TR_BIN_BLOB_MIN_SIZE or
+ * more are likewise defined once by TR_BIN_BLOB_DEF and referenced by
+ * id; repeated contents are found by a 64 bit hash.
+ */
+
+#ifndef TR_DUMP_BIN_H
+#define TR_DUMP_BIN_H
+
+
+#include "pipe/p_compiler.h"
+
+
+#define TR_BIN_MAGIC "GTRB"
+#define TR_BIN_VERSION 1
+
+#define TR_BIN_BLOB_MIN_SIZE 64
+
+
+enum tr_bin_opcode
+{
+   TR_BIN_STRING_DEF = 1,  /**< id, length, bytes */
+   TR_BIN_BLOB_DEF,        /**< id, size, bytes */
+   TR_BIN_CALL_BEGIN,      /**< call no, class name id, method name id */
+   TR_BIN_CALL_END,
+   TR_BIN_ARG_BEGIN,       /**< name id */
+   TR_BIN_ARG_END,
+   TR_BIN_RET_BEGIN,
+   TR_BIN_RET_END,
+   TR_BIN_BOOL,            /**< one byte */
+   TR_BIN_INT,             /**< zigzag encoded */
+   TR_BIN_UINT,
+   TR_BIN_FLOAT,           /**< little-endian IEEE double */
+   TR_BIN_BYTES,           /**< size, bytes */
+   TR_BIN_BLOB,            /**< blob id */
+   TR_BIN_STRING,          /**< length, bytes */
+   TR_BIN_ENUM,            /**< name id */
+   TR_BIN_ARRAY_BEGIN,
+   TR_BIN_ARRAY_END,
+   TR_BIN_ELEM_BEGIN,
+   TR_BIN_ELEM_END,
+   TR_BIN_STRUCT_BEGIN,    /**< name id */
+   TR_BIN_STRUCT_END,
+   TR_BIN_MEMBER_BEGIN,    /**< name id */
+   TR_BIN_MEMBER_END,
+   TR_BIN_NULL,
+   TR_BIN_PTR              /**< value */
+};
+
+
+/*
+ * Writer.
+ *
+ * Records are appended to an in-memory chunk, and full chunks are
+ * written out by a separate thread where threads are available.  The
+ * record functions are called under the trace call mutex.
+ */
+
+boolean trace_bin_begin(const char *filename);
+void trace_bin_end(void);
+
+void trace_bin_op(unsigned op);
+void trace_bin_op_name(unsigned op, const char *name);
+void trace_bin_call_begin(unsigned long call_no,
+                          const char *klass, const char *method);
+void trace_bin_bool(int value);
+void trace_bin_int(long long int value);
+void trace_bin_uint(long long unsigned value);
+void trace_bin_float(double value);
+void trace_bin_bytes(const void *data, size_t size);
+void trace_bin_string(const char *str);
+void trace_bin_ptr(const void *value);
+
+
+#endif /* TR_DUMP_BIN_H */
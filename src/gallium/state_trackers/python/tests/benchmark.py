@@ -0,0 +1,466 @@
+#!/usr/bin/env python
+##########################################################################
+# 
+# Copyright 2009 VMware, Inc.
+# All Rights Reserved.
+# 
+# Permission is hereby granted, free of charge, to any person obtaining a
+# copy of this software and associated documentation files (the
+# "Software"), to deal in the Software without restriction, including
+# without limitation the rights to use, copy, modify, merge, publish,
+# distribute, sub license, and/or sell copies of the Software, and to
+# permit persons to whom the Software is furnished to do so, subject to
+# the following conditions:
+# 
+# The above copyright notice and this permission notice (including the
+# next paragraph) shall be included in all copies or substantial portions
+# of the Software.
+# 
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+# OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT.
+# IN NO EVENT SHALL VMWARE AND/OR ITS SUPPLIERS BE LIABLE FOR
+# ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+# TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+# SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+# 
+##########################################################################
+
+
+"""Micro-benchmarks for Gallium pipe drivers.
+
+Runs a set of small, repeatable workloads (clears, fill-rate with a varying
+number of texture units, vertex throughput through each draw module middle
+end, ALU bound fragment shaders and blend modes) and reports the achieved
+Mpixels/s and Mverts/s, together with the time spent in each stage, into a
+tab separated file suitable for diffing between builds.
+
+By default softpipe is used. Pass --hardware to benchmark the pipe driver
+exposed by the OpenGL library instead (e.g., llvmpipe when running against
+the llvmpipe xlib libGL).
+"""
+
+
+import os
+import sys
+import time
+import array
+import optparse
+
+from gallium import *
+
+
+if sys.platform == 'win32':
+    timer = time.clock
+else:
+    timer = time.time
+
+
+# Environment variables which select the draw module middle end. They are
+# read by draw_pt_init, i.e., when the pipe context is created.
+middle_ends = {
+    'fetch_emit': {},
+    'fetch_shade_emit': {'DRAW_FSE': 'true'},
+    'general': {'DRAW_NO_FSE': 'true'},
+}
+
+
+blend_modes = {
+    'replace': (0, PIPE_BLENDFACTOR_ONE, PIPE_BLENDFACTOR_ZERO),
+    'alpha': (1, PIPE_BLENDFACTOR_SRC_ALPHA, PIPE_BLENDFACTOR_INV_SRC_ALPHA),
+    'additive': (1, PIPE_BLENDFACTOR_ONE, PIPE_BLENDFACTOR_ONE),
+    'modulate': (1, PIPE_BLENDFACTOR_DST_COLOR, PIPE_BLENDFACTOR_ZERO),
+}
+
+
+class Benchmark:
+    """Base class for benchmarks.
+
+    Subclasses set up the pipe state in setup() and issue one iteration of
+    the workload in draw(), returning the number of pixels and vertices it
+    processed.
+    """
+
+    tags = ()
+
+    width = 512
+    height = 512
+    iterations = 16
+
+    middle_end = 'general'
+
+    def __init__(self, dev, **kargs):
+        self.dev = dev
+        self.__dict__.update(kargs)
+
+    def name(self):
+        return self.__class__.__name__[:-len('Benchmark')].lower()
+
+    def description(self):
+        descriptions = [self.name()]
+        for tag in self.tags:
+            descriptions.append(tag + '=' + str(getattr(self, tag)))
+        return ' '.join(descriptions)
+
+    def context_create(self):
+        saved = {}
+        for name in ('DRAW_FSE', 'DRAW_NO_FSE'):
+            saved[name] = os.environ.pop(name, None)
+        os.environ.update(middle_ends[self.middle_end])
+        try:
+            return self.dev.context_create()
+        finally:
+            for name, value in saved.iteritems():
+                if value is None:
+                    os.environ.pop(name, None)
+                else:
+                    os.environ[name] = value
+
+    def setup(self):
+        ctx = self.ctx
+        width = self.width
+        height = self.height
+
+        blend = Blend()
+        blend.rgb_src_factor = PIPE_BLENDFACTOR_ONE
+        blend.alpha_src_factor = PIPE_BLENDFACTOR_ONE
+        blend.rgb_dst_factor = PIPE_BLENDFACTOR_ZERO
+        blend.alpha_dst_factor = PIPE_BLENDFACTOR_ZERO
+        blend.colormask = PIPE_MASK_RGBA
+        ctx.set_blend(blend)
+
+        depth_stencil_alpha = DepthStencilAlpha()
+        depth_stencil_alpha.depth.enabled = 0
+        ctx.set_depth_stencil_alpha(depth_stencil_alpha)
+
+        rasterizer = Rasterizer()
+        rasterizer.front_winding = PIPE_WINDING_CW
+        rasterizer.cull_mode = PIPE_WINDING_NONE
+        rasterizer.bypass_vs_clip_and_viewport = int(self.middle_end == 'fetch_emit')
+        ctx.set_rasterizer(rasterizer)
+
+        viewport = Viewport()
+        scale = FloatArray(4)
+        scale[0] = width / 2.0
+        scale[1] = height / 2.0
+        scale[2] = 0.5
+        scale[3] = 1.0
+        viewport.scale = scale
+        translate = FloatArray(4)
+        translate[0] = width / 2.0
+        translate[1] = height / 2.0
+        translate[2] = 0.5
+        translate[3] = 0.0
+        viewport.translate = translate
+        ctx.set_viewport(viewport)
+
+        clip = Clip()
+        clip.nr = 0
+        ctx.set_clip(clip)
+
+        self.cbuf = self.dev.texture_create(
+            PIPE_FORMAT_A8R8G8B8_UNORM,
+            width, height,
+            tex_usage = PIPE_TEXTURE_USAGE_RENDER_TARGET,
+        ).get_surface()
+        fb = Framebuffer()
+        fb.width = width
+        fb.height = height
+        fb.nr_cbufs = 1
+        fb.set_cbuf(0, self.cbuf)
+        ctx.set_framebuffer(fb)
+
+        self.clear_color = FloatArray(4)
+        for i in range(4):
+            self.clear_color[i] = 0.5
+        ctx.clear(PIPE_CLEAR_COLOR, self.clear_color, 0.0, 0)
+
+        ctx.set_vertex_shader(Shader('''
+            VERT1.1
+            DCL IN[0], POSITION, CONSTANT
+            DCL IN[1], GENERIC, CONSTANT
+            DCL OUT[0], POSITION, CONSTANT
+            DCL OUT[1], GENERIC, CONSTANT
+            0:MOV OUT[0], IN[0]
+            1:MOV OUT[1], IN[1]
+            2:END
+        '''))
+
+        ctx.set_fragment_shader(Shader('''
+            FRAG1.1
+            DCL IN[0], GENERIC[0], LINEAR
+            DCL OUT[0], COLOR, CONSTANT
+            0:MOV OUT[0], IN[0]
+            1:END
+        '''))
+
+    def set_vertices(self, verts):
+        """Upload a list of (x, y, s, t) window space vertices into a vertex
+        buffer, converting to clip space unless the vertex shader, clipping
+        and viewport transform are bypassed."""
+
+        data = array.array('f')
+        for x, y, s, t in verts:
+            if self.middle_end != 'fetch_emit':
+                x = 2.0*x/self.width - 1.0
+                y = 2.0*y/self.height - 1.0
+            data.extend((x, y, 0.0, 1.0, s, t, 0.0, 1.0))
+        data = data.tostring()
+
+        self.vbuf = self.dev.buffer_create(len(data), usage = PIPE_BUFFER_USAGE_VERTEX)
+        self.vbuf.write(data)
+
+        stride = 2*4*4
+        self.ctx.set_vertex_buffer(0, stride, len(verts) - 1, 0, self.vbuf)
+        for i in range(2):
+            ve = VertexElement()
+            ve.src_offset = i*4*4
+            ve.vertex_buffer_index = 0
+            ve.nr_components = 4
+            ve.src_format = PIPE_FORMAT_R32G32B32A32_FLOAT
+            self.ctx.set_vertex_element(i, ve)
+        self.ctx.set_vertex_elements(2)
+        return len(verts)
+
+    def draw(self):
+        raise NotImplementedError
+
+    def finish(self):
+        # Reading back a pixel ensures that no rendering is left pending in
+        # the driver, regardless of how it implements flush.
+        self.cbuf.get_tile_raw(0, 0, 1, 1)
+
+    def run(self):
+        self.ctx = self.context_create()
+
+        start = timer()
+        self.setup()
+        self.ctx.flush()
+        self.finish()
+        setup_time = timer() - start
+
+        # warm up any caches
+        self.draw()
+        self.ctx.flush()
+        self.finish()
+
+        pixels = 0
+        verts = 0
+        submit_time = 0.0
+        flush_time = 0.0
+        for i in range(self.iterations):
+            start = timer()
+            p, v = self.draw()
+            end = timer()
+            submit_time += end - start
+            self.ctx.flush()
+            self.finish()
+            flush_time += timer() - end
+            pixels += p
+            verts += v
+
+        del self.ctx
+
+        return {
+            'setup': setup_time,
+            'submit': submit_time,
+            'flush': flush_time,
+            'pixels': pixels,
+            'verts': verts,
+        }
+
+
+class ClearBenchmark(Benchmark):
+
+    iterations = 64
+
+    def draw(self):
+        self.ctx.clear(PIPE_CLEAR_COLOR, self.clear_color, 0.0, 0)
+        return self.width*self.height, 0
+
+
+class FillBenchmark(Benchmark):
+    """Full screen quads, optionally textured, ALU heavy and/or blended."""
+
+    tags = ('units', 'alu', 'blend')
+
+    units = 0
+    alu = 0
+    blend = 'replace'
+    overdraw = 4
+
+    def setup(self):
+        Benchmark.setup(self)
+        ctx = self.ctx
+
+        enabled, src_factor, dst_factor = blend_modes[self.blend]
+        blend = Blend()
+        blend.blend_enable = enabled
+        blend.rgb_func = PIPE_BLEND_ADD
+        blend.rgb_src_factor = src_factor
+        blend.rgb_dst_factor = dst_factor
+        blend.alpha_func = PIPE_BLEND_ADD
+        blend.alpha_src_factor = src_factor
+        blend.alpha_dst_factor = dst_factor
+        blend.colormask = PIPE_MASK_RGBA
+        ctx.set_blend(blend)
+
+        sampler = Sampler()
+        sampler.wrap_s = PIPE_TEX_WRAP_REPEAT
+        sampler.wrap_t = PIPE_TEX_WRAP_REPEAT
+        sampler.wrap_r = PIPE_TEX_WRAP_REPEAT
+        sampler.min_mip_filter = PIPE_TEX_MIPFILTER_NONE
+        sampler.min_img_filter = PIPE_TEX_FILTER_LINEAR
+        sampler.mag_img_filter = PIPE_TEX_FILTER_LINEAR
+        sampler.normalized_coords = 1
+        self.textures = []
+        for unit in range(self.units):
+            texture = self.dev.texture_create(
+                PIPE_FORMAT_A8R8G8B8_UNORM,
+                256, 256,
+                tex_usage = PIPE_TEXTURE_USAGE_SAMPLER,
+            )
+            self.textures.append(texture)
+            ctx.set_sampler(unit, sampler)
+            ctx.set_sampler_texture(unit, texture)
+
+        ctx.set_fragment_shader(Shader(self.fragment_shader()))
+
+        w = float(self.width)
+        h = float(self.height)
+        self.nverts = self.set_vertices([
+            (0.0, 0.0, 0.0, 0.0),
+            (w,   0.0, 4.0, 0.0),
+            (w,   h,   4.0, 4.0),
+            (0.0, h,   0.0, 4.0),
+        ])
+
+    def fragment_shader(self):
+        lines = [
+            'FRAG1.1',
+            'DCL IN[0], GENERIC[0], LINEAR',
+            'DCL OUT[0], COLOR, CONSTANT',
+            'DCL TEMP[0..1]',
+        ]
+        for unit in range(self.units):
+            lines.append('DCL SAMP[%u], CONSTANT' % unit)
+        lines.append('IMM FLT32 { 0.5, 0.25, 0.125, 1.0 }')
+        lines.append('MOV TEMP[0], IN[0]')
+        for unit in range(self.units):
+            lines.append('TEX TEMP[1], IN[0], SAMP[%u], 2D' % unit)
+            lines.append('ADD TEMP[0], TEMP[0], TEMP[1]')
+        for i in range(self.alu):
+            lines.append('MAD TEMP[0], TEMP[0], IMM[0], IMM[0].yyyy')
+        lines.append('MOV OUT[0], TEMP[0]')
+        lines.append('END')
+        return '\n'.join(lines) + '\n'
+
+    def draw(self):
+        for i in range(self.overdraw):
+            self.ctx.draw_arrays(PIPE_PRIM_TRIANGLE_FAN, 0, self.nverts)
+        return self.overdraw*self.width*self.height, self.overdraw*self.nverts
+
+
+class VertexBenchmark(Benchmark):
+    """Lots of tiny triangles, so that vertex processing dominates."""
+
+    tags = ('middle_end', 'prim')
+
+    prim = 'triangles'
+    size = 4
+
+    def setup(self):
+        Benchmark.setup(self)
+
+        size = self.size
+        verts = []
+        for y in range(0, self.height, size):
+            for x in range(0, self.width, size):
+                x0 = float(x)
+                y0 = float(y)
+                x1 = x0 + 1.0
+                y1 = y0 + 1.0
+                verts.append((x0, y0, 0.0, 0.0))
+                verts.append((x1, y0, 1.0, 0.0))
+                verts.append((x0, y1, 0.0, 1.0))
+        self.nverts = self.set_vertices(verts)
+
+    def draw(self):
+        self.ctx.draw_arrays(PIPE_PRIM_TRIANGLES, 0, self.nverts)
+        return 0, self.nverts
+
+
+def benchmarks(dev):
+    yield ClearBenchmark(dev)
+    for units in (0, 1, 2, 4, 8):
+        yield FillBenchmark(dev, units=units)
+    for alu in (4, 16, 64):
+        yield FillBenchmark(dev, alu=alu)
+    for blend in ('alpha', 'additive', 'modulate'):
+        yield FillBenchmark(dev, blend=blend)
+    for middle_end in ('fetch_emit', 'fetch_shade_emit', 'general'):
+        yield VertexBenchmark(dev, middle_end=middle_end)
+
+
+def main():
+    optparser = optparse.OptionParser(
+        usage="\n\t%prog [options] [pattern] ...")
+    optparser.add_option(
+        '--hardware',
+        action="store_true", dest="hardware", default=False,
+        help="use the pipe driver exposed by the OpenGL library instead of softpipe")
+    optparser.add_option(
+        '-n', '--iterations',
+        type="int", dest="iterations", default=None,
+        help="override the number of iterations of each benchmark")
+    optparser.add_option(
+        '-o', '--output',
+        type="string", dest="output", default=None,
+        help="output file [default: stdout]")
+    (options, args) = optparser.parse_args(sys.argv[1:])
+
+    dev = Device(hardware = options.hardware)
+
+    if options.output is None:
+        stream = sys.stdout
+    else:
+        stream = file(options.output, 'wt')
+
+    columns = ('benchmark', 'middle_end', 'units', 'alu', 'blend',
+               'iterations', 'setup_ms', 'submit_ms', 'flush_ms',
+               'mpixels_per_s', 'mverts_per_s')
+    stream.write('\t'.join(columns) + '\n')
+    stream.flush()
+
+    for benchmark in benchmarks(dev):
+        description = benchmark.description()
+        if args and not [arg for arg in args if arg in description]:
+            continue
+        if options.iterations is not None:
+            benchmark.iterations = options.iterations
+
+        sys.stderr.write('Running %s...\n' % description)
+        result = benchmark.run()
+
+        total = result['submit'] + result['flush']
+        if total <= 0.0:
+            total = 1e-9
+        row = (
+            benchmark.name(),
+            benchmark.middle_end,
+            str(getattr(benchmark, 'units', '')),
+            str(getattr(benchmark, 'alu', '')),
+            str(getattr(benchmark, 'blend', '')),
+            str(benchmark.iterations),
+            '%.3f' % (result['setup']*1e3),
+            '%.3f' % (result['submit']*1e3),
+            '%.3f' % (result['flush']*1e3),
+            '%.3f' % (result['pixels']/total*1e-6),
+            '%.3f' % (result['verts']/total*1e-6),
+        )
+        stream.write('\t'.join(row) + '\n')
+        stream.flush()
+
+
+if __name__ == '__main__':
+    main()
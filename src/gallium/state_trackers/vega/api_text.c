@@ -27,18 +27,101 @@
 #include "VG/openvg.h"
 
 #include "vg_context.h"
+#include "path.h"
+#include "image.h"
+#include "shader.h"
+#include "paint.h"
+#include "matrix.h"
+
+#include "cso_cache/cso_hash.h"
 
 #include "util/u_memory.h"
 
+#include <math.h>
+
 #ifdef OPENVG_VERSION_1_1
 
+/* most runs of text are shorter than this and are drawn without
+ * allocating */
+#define GLYPH_RUN_SIZE 64
+
+struct vg_glyph {
+   /* private copies, so that the glyph outlives the path or image it was
+    * set from and keeps its cached fill polygons between draws */
+   struct path *path;
+   struct vg_image *image;
+
+   VGboolean is_hinted;
+   VGfloat origin[2];
+   VGfloat escapement[2];
+};
+
 struct vg_font {
    struct vg_object base;
 
-   VGint glyph_indices[200];
+   struct cso_hash *glyphs;
    VGint num_glyphs;
 };
 
+static void glyph_destroy(struct vg_glyph *glyph)
+{
+   if (glyph->path)
+      path_destroy(glyph->path);
+   if (glyph->image)
+      image_destroy(glyph->image);
+   FREE(glyph);
+}
+
+static struct vg_glyph *font_get_glyph(struct vg_font *font,
+                                       VGuint glyph_index)
+{
+   struct cso_hash_iter iter = cso_hash_find(font->glyphs, glyph_index);
+
+   if (cso_hash_iter_is_null(iter))
+      return NULL;
+   return (struct vg_glyph *)cso_hash_iter_data(iter);
+}
+
+static INLINE VGboolean font_contains_glyph(struct vg_font *font,
+                                            VGuint glyph_index)
+{
+   return font_get_glyph(font, glyph_index) != NULL;
+}
+
+static void font_clear_glyph(struct vg_font *font, VGuint glyph_index)
+{
+   struct vg_glyph *glyph = cso_hash_take(font->glyphs, glyph_index);
+
+   if (glyph) {
+      glyph_destroy(glyph);
+      --font->num_glyphs;
+   }
+}
+
+static void font_set_glyph(struct vg_font *font, VGuint glyph_index,
+                           struct vg_glyph *glyph)
+{
+   font_clear_glyph(font, glyph_index);
+   cso_hash_insert(font->glyphs, glyph_index, glyph);
+   ++font->num_glyphs;
+}
+
+static struct vg_glyph *glyph_create(VGboolean is_hinted,
+                                     const VGfloat origin[2],
+                                     const VGfloat escapement[2])
+{
+   struct vg_glyph *glyph = CALLOC_STRUCT(vg_glyph);
+
+   if (glyph) {
+      glyph->is_hinted = is_hinted;
+      glyph->origin[0] = origin[0];
+      glyph->origin[1] = origin[1];
+      glyph->escapement[0] = escapement[0];
+      glyph->escapement[1] = escapement[1];
+   }
+   return glyph;
+}
+
 VGFont vgCreateFont(VGint glyphCapacityHint)
 {
    struct vg_font *font = 0;
@@ -51,6 +134,7 @@ VGFont vgCreateFont(VGint glyphCapacityHint)
 
    font = CALLOC_STRUCT(vg_font);
    vg_init_object(&font->base, ctx, VG_OBJECT_FONT);
+   font->glyphs = cso_hash_create();
    vg_context_add_object(ctx, VG_OBJECT_FONT, font);
    return (VGFont)font;
 }
@@ -59,6 +143,7 @@ void vgDestroyFont(VGFont f)
 {
    struct vg_font *font = (struct vg_font *)f;
    struct vg_context *ctx = vg_current_context();
+   struct cso_hash_iter iter;
 
    if (f == VG_INVALID_HANDLE) {
       vg_set_error(ctx, VG_BAD_HANDLE_ERROR);
@@ -66,7 +151,14 @@ void vgDestroyFont(VGFont f)
    }
 
    vg_context_remove_object(ctx, VG_OBJECT_FONT, font);
-   /*free(font);*/
+
+   iter = cso_hash_first_node(font->glyphs);
+   while (!cso_hash_iter_is_null(iter)) {
+      glyph_destroy((struct vg_glyph *)cso_hash_iter_data(iter));
+      iter = cso_hash_erase(font->glyphs, iter);
+   }
+   cso_hash_delete(font->glyphs);
+   FREE(font);
 }
 
 void vgSetGlyphToPath(VGFont font,
@@ -79,6 +171,7 @@ void vgSetGlyphToPath(VGFont font,
    struct vg_context *ctx = vg_current_context();
    struct vg_object *pathObj;
    struct vg_font *f;
+   struct vg_glyph *glyph;
 
    if (font == VG_INVALID_HANDLE ||
        !vg_context_is_object_valid(ctx, VG_OBJECT_FONT, (void *)font)) {
@@ -101,9 +194,19 @@ void vgSetGlyphToPath(VGFont font,
       return;
    }
 
+   glyph = glyph_create(isHinted, glyphOrigin, escapement);
+   if (!glyph) {
+      vg_set_error(ctx, VG_OUT_OF_MEMORY_ERROR);
+      return;
+   }
+   if (pathObj) {
+      glyph->path = path_create(VG_PATH_DATATYPE_F, 1.0f, 0.0f, 0, 0,
+                                VG_PATH_CAPABILITY_ALL);
+      path_append_path(glyph->path, (struct path *)pathObj);
+   }
+
    f = (struct vg_font*)font;
-   f->glyph_indices[f->num_glyphs] = glyphIndex;
-   ++f->num_glyphs;
+   font_set_glyph(f, glyphIndex, glyph);
 }
 
 void vgSetGlyphToImage(VGFont font,
@@ -115,6 +218,7 @@ void vgSetGlyphToImage(VGFont font,
    struct vg_context *ctx = vg_current_context();
    struct vg_object *img_obj;
    struct vg_font *f;
+   struct vg_glyph *glyph;
 
    if (font == VG_INVALID_HANDLE ||
        !vg_context_is_object_valid(ctx, VG_OBJECT_FONT, (void *)font)) {
@@ -136,21 +240,21 @@ void vgSetGlyphToImage(VGFont font,
       vg_set_error(ctx, VG_BAD_HANDLE_ERROR);
       return;
    }
-   f = (struct vg_font*)font;
-   f->glyph_indices[f->num_glyphs] = glyphIndex;
-   ++f->num_glyphs;
-}
 
-static INLINE VGboolean font_contains_glyph(struct vg_font *font,
-                                            VGuint glyph_index)
-{
-   VGint i;
-   for (i = 0; i < font->num_glyphs; ++i) {
-      if (font->glyph_indices[i] == glyph_index) {
-         return VG_TRUE;
-      }
+   glyph = glyph_create(VG_FALSE, glyphOrigin, escapement);
+   if (!glyph) {
+      vg_set_error(ctx, VG_OUT_OF_MEMORY_ERROR);
+      return;
+   }
+   if (img_obj) {
+      struct vg_image *src = (struct vg_image *)img_obj;
+      glyph->image = image_create(src->format, src->width, src->height);
+      image_copy(glyph->image, 0, 0, src, 0, 0,
+                 src->width, src->height, VG_FALSE);
    }
-   return VG_FALSE;
+
+   f = (struct vg_font*)font;
+   font_set_glyph(f, glyphIndex, glyph);
 }
 
 void vgClearGlyph(VGFont font,
@@ -158,7 +262,6 @@ void vgClearGlyph(VGFont font,
 {
    struct vg_context *ctx = vg_current_context();
    struct vg_font *f;
-   VGint i;
 
    if (font == VG_INVALID_HANDLE) {
       vg_set_error(ctx, VG_BAD_HANDLE_ERROR);
@@ -174,14 +277,167 @@ void vgClearGlyph(VGFont font,
       return;
    }
 
-   for (i = 0; i < f->num_glyphs; ++i) {
-      if (f->glyph_indices[i] == glyphIndex) {
-         /*FIXME*/
-         f->glyph_indices[f->num_glyphs] = 0;
-         --f->num_glyphs;
-         return;
+   font_clear_glyph(f, glyphIndex);
+}
+
+static void draw_glyph(struct vg_context *ctx, struct vg_glyph *glyph,
+                       VGfloat x, VGfloat y, VGbitfield paintModes)
+{
+   struct matrix saved;
+
+   if (glyph->path && !path_is_empty(glyph->path)) {
+      saved = ctx->state.vg.path_user_to_surface_matrix;
+      ctx->state.vg.path_user_to_surface_matrix =
+         ctx->state.vg.glyph_user_to_surface_matrix;
+      matrix_translate(&ctx->state.vg.path_user_to_surface_matrix,
+                       x - glyph->origin[0], y - glyph->origin[1]);
+      path_render(glyph->path, paintModes);
+      ctx->state.vg.path_user_to_surface_matrix = saved;
+   }
+   else if (glyph->image) {
+      saved = ctx->state.vg.image_user_to_surface_matrix;
+      ctx->state.vg.image_user_to_surface_matrix =
+         ctx->state.vg.glyph_user_to_surface_matrix;
+      matrix_translate(&ctx->state.vg.image_user_to_surface_matrix,
+                       x - glyph->origin[0], y - glyph->origin[1]);
+      vg_validate_state(ctx);
+      image_draw(glyph->image);
+      ctx->state.vg.image_user_to_surface_matrix = saved;
+   }
+}
+
+/**
+ * Fill the batched glyph paths of a run with a single stencil and cover
+ * pass, see path_fill_run().
+ */
+static void fill_glyph_batch(struct vg_context *ctx, struct path **paths,
+                             const VGfloat *offsets, VGint count)
+{
+   struct matrix saved = ctx->state.vg.path_user_to_surface_matrix;
+
+   ctx->state.vg.path_user_to_surface_matrix =
+      ctx->state.vg.glyph_user_to_surface_matrix;
+   vg_validate_state(ctx);
+   shader_set_drawing_image(ctx->shader, VG_FALSE);
+   shader_set_image(ctx->shader, 0);
+   shader_set_paint(ctx->shader, ctx->state.vg.fill_paint);
+   shader_bind(ctx->shader);
+   path_fill_run(paths, offsets, count,
+                 &ctx->state.vg.glyph_user_to_surface_matrix);
+   ctx->state.vg.path_user_to_surface_matrix = saved;
+}
+
+/**
+ * Draw the glyphs of a run starting at the current glyph origin and
+ * advance it.  Path glyphs that are only filled with the non-zero rule
+ * are gathered into batches that are stenciled and covered at once,
+ * reusing the fill polygons cached with each glyph.  A batch is drawn
+ * before a glyph whose bounds overlap it, or which has to be drawn on
+ * its own, so the result is the same as drawing glyph by glyph.
+ */
+static void draw_glyph_run(struct vg_context *ctx, struct vg_font *font,
+                           VGint count, const VGuint *indices,
+                           const VGfloat *adjustments_x,
+                           const VGfloat *adjustments_y,
+                           VGbitfield paintModes)
+{
+   struct path *run_paths[GLYPH_RUN_SIZE];
+   VGfloat run_offsets[2 * GLYPH_RUN_SIZE];
+   struct path **paths = run_paths;
+   VGfloat *offsets = run_offsets;
+   VGfloat batch_bounds[4];
+   VGint num_paths = 0;
+   VGfloat x = ctx->state.vg.glyph_origin[0].f;
+   VGfloat y = ctx->state.vg.glyph_origin[1].f;
+   /* patterns are placed relative to each glyph's own origin */
+   VGboolean batch = (paintModes == VG_FILL_PATH &&
+                      ctx->state.vg.fill_rule == VG_NON_ZERO &&
+                      paint_type(ctx->state.vg.fill_paint) !=
+                      VG_PAINT_TYPE_PATTERN &&
+                      matrix_is_affine(&ctx->state.vg.glyph_user_to_surface_matrix));
+   VGint i;
+
+   if (batch && count > GLYPH_RUN_SIZE) {
+      paths = MALLOC(count * sizeof(*paths));
+      offsets = MALLOC(2 * count * sizeof(*offsets));
+      if (!paths || !offsets) {
+         FREE(paths);
+         FREE(offsets);
+         paths = run_paths;
+         offsets = run_offsets;
+         batch = VG_FALSE;
+      }
+   }
+
+   for (i = 0; i < count; ++i) {
+      struct vg_glyph *glyph = font_get_glyph(font, indices[i]);
+
+      if (paintModes) {
+         VGfloat bounds[4];
+
+         if (batch && glyph->path && !path_is_empty(glyph->path)) {
+            if (path_fill_bounds(glyph->path,
+                                 &ctx->state.vg.glyph_user_to_surface_matrix,
+                                 bounds)) {
+               VGfloat dx = x - glyph->origin[0];
+               VGfloat dy = y - glyph->origin[1];
+
+               bounds[0] += dx;
+               bounds[1] += dy;
+               bounds[2] += dx;
+               bounds[3] += dy;
+
+               if (num_paths &&
+                   bounds[0] < batch_bounds[2] && batch_bounds[0] < bounds[2] &&
+                   bounds[1] < batch_bounds[3] && batch_bounds[1] < bounds[3]) {
+                  fill_glyph_batch(ctx, paths, offsets, num_paths);
+                  num_paths = 0;
+               }
+
+               if (num_paths) {
+                  batch_bounds[0] = MIN2(batch_bounds[0], bounds[0]);
+                  batch_bounds[1] = MIN2(batch_bounds[1], bounds[1]);
+                  batch_bounds[2] = MAX2(batch_bounds[2], bounds[2]);
+                  batch_bounds[3] = MAX2(batch_bounds[3], bounds[3]);
+               }
+               else
+                  memcpy(batch_bounds, bounds, sizeof(batch_bounds));
+
+               paths[num_paths] = glyph->path;
+               offsets[2*num_paths] = dx;
+               offsets[2*num_paths + 1] = dy;
+               ++num_paths;
+            }
+         }
+         else {
+            if (num_paths) {
+               fill_glyph_batch(ctx, paths, offsets, num_paths);
+               num_paths = 0;
+            }
+            draw_glyph(ctx, glyph, x, y, paintModes);
+         }
       }
+
+      x += glyph->escapement[0];
+      y += glyph->escapement[1];
+      if (adjustments_x)
+         x += adjustments_x[i];
+      if (adjustments_y)
+         y += adjustments_y[i];
+   }
+
+   if (num_paths)
+      fill_glyph_batch(ctx, paths, offsets, num_paths);
+
+   if (paths != run_paths) {
+      FREE(paths);
+      FREE(offsets);
    }
+
+   ctx->state.vg.glyph_origin[0].f = x;
+   ctx->state.vg.glyph_origin[1].f = y;
+   ctx->state.vg.glyph_origin[0].i = (VGint)floor(x);
+   ctx->state.vg.glyph_origin[1].i = (VGint)floor(y);
 }
 
 void vgDrawGlyph(VGFont font,
@@ -209,6 +465,8 @@ void vgDrawGlyph(VGFont font,
       vg_set_error(ctx, VG_ILLEGAL_ARGUMENT_ERROR);
       return;
    }
+
+   draw_glyph_run(ctx, f, 1, &glyphIndex, NULL, NULL, paintModes);
 }
 
 void vgDrawGlyphs(VGFont font,
@@ -235,8 +493,9 @@ void vgDrawGlyphs(VGFont font,
       vg_set_error(ctx, VG_ILLEGAL_ARGUMENT_ERROR);
       return;
    }
-   if (!adjustments_x || !is_aligned(adjustments_x) ||
-       !adjustments_y || !is_aligned(adjustments_y)) {
+   /* the adjustments are optional */
+   if ((adjustments_x && !is_aligned(adjustments_x)) ||
+       (adjustments_y && !is_aligned(adjustments_y))) {
       vg_set_error(ctx, VG_ILLEGAL_ARGUMENT_ERROR);
       return;
    }
@@ -253,6 +512,9 @@ void vgDrawGlyphs(VGFont font,
          return;
       }
    }
+
+   draw_glyph_run(ctx, f, glyphCount, glyphIndices,
+                  adjustments_x, adjustments_y, paintModes);
 }
 
 #endif
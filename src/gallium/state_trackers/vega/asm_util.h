@@ -104,6 +104,21 @@ static const char vs_plain_asm[] =
    "2: MOV OUT[0], TEMP[0]\n"
    "3: END\n";
 
+/* vs_plain_asm with the path-to-surface transformation in CONST[2..3] */
+static const char vs_path_asm[] =
+   "VERT1.1\n"
+   "DCL IN[0]\n"
+   "DCL OUT[0], POSITION\n"
+   "DCL TEMP[0]\n"
+   "DCL CONST[0..3]\n"
+   "0: MOV TEMP[0], IN[0]\n"
+   "1: DP4 TEMP[0].x, IN[0], CONST[2]\n"
+   "2: DP4 TEMP[0].y, IN[0], CONST[3]\n"
+   "3: MUL TEMP[0], TEMP[0], CONST[0]\n"
+   "4: ADD TEMP[0], TEMP[0], CONST[1]\n"
+   "5: MOV OUT[0], TEMP[0]\n"
+   "6: END\n";
+
 static const char vs_clear_asm[] =
    "VERT1.1\n"
    "DCL IN[0]\n"
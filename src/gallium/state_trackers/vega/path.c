@@ -40,6 +40,8 @@
 #include "util/u_memory.h"
 
 #include <assert.h>
+#include <math.h>
+#include <float.h>
 
 #define DEBUG_PATH 0
 
@@ -61,6 +63,8 @@ struct path {
 
    struct {
       struct polygon_array polygon_array;
+      /* the polygons are in the space of this matrix, which for affine
+       * path transformations is a uniform scale (see flatten_matrix) */
       struct matrix matrix;
    } fill_polys;
 
@@ -213,7 +217,7 @@ void path_destroy(struct path *p)
 
    array_destroy(p->segments);
    array_destroy(p->control_points);
-   array_destroy(p->fill_polys.polygon_array.array);
+   polygon_array_cleanup(&p->fill_polys.polygon_array);
 
    if (p->stroked.path)
       path_destroy(p->stroked.path);
@@ -334,7 +338,43 @@ static void polygon_array_calculate_bounds( struct polygon_array *polyarray )
 }
 
 
-static struct polygon_array * path_get_fill_polygons(struct path *p, struct matrix *matrix)
+/**
+ * Matrix to flatten a path with when it will be drawn with the given
+ * path-to-surface matrix.  For affine matrices the path is flattened in
+ * path space, scaled by the largest stretch of the matrix rounded up to
+ * a power of two, so that the flatness tolerance still holds on the
+ * surface and the polygons can be reused for any translation, rotation
+ * or shear and for scales within the same octave.  The rest of the
+ * transformation is done by the vertex shader.  Projective matrices are
+ * flattened directly to surface space.
+ */
+static void flatten_matrix(struct matrix *matrix, struct matrix *flatten)
+{
+   VGfloat a = matrix->m[0], b = matrix->m[1];
+   VGfloat c = matrix->m[3], d = matrix->m[4];
+   VGfloat sum, det, stretch;
+   int exponent;
+
+   if (!matrix_is_affine(matrix)) {
+      *flatten = *matrix;
+      return;
+   }
+
+   /* largest singular value of the 2x2 part */
+   sum = a*a + b*b + c*c + d*d;
+   det = a*d - b*c;
+   stretch = sqrt(0.5f * (sum + sqrt(MAX2(sum*sum - 4.f*det*det, 0.f))));
+
+   matrix_load_identity(flatten);
+   if (stretch > 0.f && stretch < 1e30f) {
+      VGfloat scale;
+      frexp(stretch, &exponent);
+      scale = (VGfloat)ldexp(1.0, exponent);
+      matrix_scale(flatten, scale, scale);
+   }
+}
+
+static struct polygon_array * path_get_fill_polygons(struct path *p, struct matrix *path_matrix)
 {
    VGint i;
    struct polygon *current = 0;
@@ -343,6 +383,10 @@ static struct polygon_array * path_get_fill_polygons(struct path *p, struct matr
    VGfloat data[8];
    void *coords = (VGfloat *)p->control_points->data;
    struct array *array;
+   struct matrix flatten;
+   struct matrix *matrix = &flatten;
+
+   flatten_matrix(path_matrix, &flatten);
 
    if (p->fill_polys.polygon_array.array)
    {
@@ -353,8 +397,7 @@ static struct polygon_array * path_get_fill_polygons(struct path *p, struct matr
          return &p->fill_polys.polygon_array;
       }
       else {
-         array_destroy( p->fill_polys.polygon_array.array );
-         p->fill_polys.polygon_array.array = NULL;
+         polygon_array_cleanup( &p->fill_polys.polygon_array );
       }
    }
 
@@ -1562,8 +1605,115 @@ void path_fill(struct path *p, struct matrix *mat)
       if (!polygon_array || !polys || !polys->num_elements) {
          return;
       }
-      polygon_array_fill(polygon_array, ctx);
+      if (matrix_is_affine(mat)) {
+         /* undo the flattening scale, see flatten_matrix */
+         struct matrix draw_matrix = *mat;
+         VGfloat inv_scale = 1.f / p->fill_polys.matrix.m[0];
+         matrix_scale(&draw_matrix, inv_scale, inv_scale);
+         polygon_array_fill(polygon_array, ctx, &draw_matrix);
+      } else
+         polygon_array_fill(polygon_array, ctx, NULL);
+   }
+}
+
+/**
+ * Bounds in user space of the fill of p, as flattened for the affine
+ * matrix mat.  Returns VG_FALSE if the path fills nothing.
+ */
+VGboolean path_fill_bounds(struct path *p, struct matrix *mat,
+                           VGfloat *bounds)
+{
+   struct polygon_array *polygon_array = path_get_fill_polygons(p, mat);
+   VGfloat inv_scale;
+
+   if (!polygon_array || !polygon_array->array ||
+       !polygon_array->array->num_elements)
+      return VG_FALSE;
+
+   /* undo the flattening scale, see flatten_matrix */
+   inv_scale = 1.f / p->fill_polys.matrix.m[0];
+   bounds[0] = polygon_array->min_x * inv_scale;
+   bounds[1] = polygon_array->min_y * inv_scale;
+   bounds[2] = polygon_array->max_x * inv_scale;
+   bounds[3] = polygon_array->max_y * inv_scale;
+   return VG_TRUE;
+}
+
+/**
+ * Fill count paths, path i translated by (offsets[2*i], offsets[2*i+1])
+ * in user space, with a single stencil and cover pass.  The paths are
+ * filled as if they were subpaths of one path with the non-zero rule,
+ * and the paint is blended once per pixel, so this is only equivalent
+ * to filling them one by one when they don't overlap.
+ */
+void path_fill_run(struct path **paths, const VGfloat *offsets,
+                   VGint count, struct matrix *mat)
+{
+   struct vg_context *ctx = vg_current_context();
+   struct polygon_array run;
+   struct matrix draw_matrix;
+   VGfloat scale = 1.f;
+   VGint total = 0;
+   VGfloat *dst;
+   VGint i, j;
+
+   if (!matrix_is_affine(mat)) {
+      for (i = 0; i < count; ++i) {
+         struct matrix glyph_matrix = *mat;
+         matrix_translate(&glyph_matrix, offsets[2*i], offsets[2*i + 1]);
+         path_fill(paths[i], &glyph_matrix);
+      }
+      return;
+   }
+
+   /* all the paths are flattened with the same matrix, which only
+    * depends on the upper 2x2 part of mat */
+   for (i = 0; i < count; ++i) {
+      struct polygon_array *polygon_array = path_get_fill_polygons(paths[i], mat);
+      VGint num_verts;
+      polygon_array_triangles(polygon_array, &num_verts);
+      total += num_verts;
+      scale = paths[i]->fill_polys.matrix.m[0];
    }
+   if (!total)
+      return;
+
+   memset(&run, 0, sizeof(run));
+   run.vertices = malloc(total * 2 * sizeof(VGfloat));
+   if (!run.vertices)
+      return;
+   run.num_verts = total;
+   run.min_x = run.min_y = FLT_MAX;
+   run.max_x = run.max_y = -FLT_MAX;
+
+   dst = run.vertices;
+   for (i = 0; i < count; ++i) {
+      struct polygon_array *polygon_array = &paths[i]->fill_polys.polygon_array;
+      VGfloat dx = offsets[2*i] * scale;
+      VGfloat dy = offsets[2*i + 1] * scale;
+      VGint num_verts;
+      const VGfloat *src = polygon_array_triangles(polygon_array, &num_verts);
+
+      if (!num_verts)
+         continue;
+
+      for (j = 0; j < num_verts; ++j) {
+         dst[0] = src[0] + dx;
+         dst[1] = src[1] + dy;
+         dst += 2;
+         src += 2;
+      }
+      run.min_x = MIN2(run.min_x, polygon_array->min_x + dx);
+      run.min_y = MIN2(run.min_y, polygon_array->min_y + dy);
+      run.max_x = MAX2(run.max_x, polygon_array->max_x + dx);
+      run.max_y = MAX2(run.max_y, polygon_array->max_y + dy);
+   }
+
+   draw_matrix = *mat;
+   matrix_scale(&draw_matrix, 1.f / scale, 1.f / scale);
+   polygon_array_fill(&run, ctx, &draw_matrix);
+
+   polygon_array_cleanup(&run);
 }
 
 void path_stroke(struct path *p)
@@ -107,6 +107,10 @@ void path_clear(struct path *p, VGbitfield capabilities);
 void path_render(struct path *p, VGbitfield paintModes);
 void path_fill(struct path *p, struct matrix *mat);
 void path_stroke(struct path *p);
+VGboolean path_fill_bounds(struct path *p, struct matrix *mat,
+                           VGfloat *bounds);
+void path_fill_run(struct path **paths, const VGfloat *offsets,
+                   VGint count, struct matrix *mat);
 
 void path_move_to(struct path *p, float x, float y);
 void path_line_to(struct path *p, float x, float y);
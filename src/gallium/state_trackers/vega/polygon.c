@@ -420,17 +420,129 @@ void polygon_fill(struct polygon *poly, struct vg_context *ctx)
    cso_restore_depth_stencil_alpha(ctx->cso_context);
 }
 
-void polygon_array_fill(struct polygon_array *polyarray, struct vg_context *ctx)
+/**
+ * Destroy the polygons of the array and its batched vertex buffer.
+ */
+void polygon_array_cleanup(struct polygon_array *polyarray)
+{
+   if (polyarray->array) {
+      struct polygon **polys = (struct polygon **)polyarray->array->data;
+      VGint i;
+      for (i = 0; i < polyarray->array->num_elements; ++i)
+         polygon_destroy(polys[i]);
+      array_destroy(polyarray->array);
+      polyarray->array = NULL;
+   }
+
+   if (polyarray->vbuf)
+      pipe_buffer_reference(&polyarray->vbuf, NULL);
+   free(polyarray->vertices);
+   polyarray->vertices = NULL;
+   polyarray->num_verts = 0;
+}
+
+/**
+ * Split the triangle fans of all the polygons into one triangle list,
+ * so that the whole array is stenciled with a single draw.  Triangles
+ * of a fan are drawn in the same winding as the fan itself, which keeps
+ * the stencil counts the same.
+ */
+static void build_polygon_array_vertices(struct polygon_array *polyarray)
+{
+   struct polygon **polys = (struct polygon **)polyarray->array->data;
+   VGint num_polys = polyarray->array->num_elements;
+   VGint num_verts = 0;
+   VGfloat *dst;
+   VGint i, j;
+
+   for (i = 0; i < num_polys; ++i) {
+      if (polys[i]->num_verts >= 3)
+         num_verts += 3 * (polys[i]->num_verts - 2);
+   }
+
+   polyarray->num_verts = num_verts;
+   if (!num_verts)
+      return;
+
+   polyarray->vertices = malloc(num_verts * COMPONENTS * sizeof(VGfloat));
+   if (!polyarray->vertices) {
+      polyarray->num_verts = 0;
+      return;
+   }
+
+   dst = polyarray->vertices;
+   for (i = 0; i < num_polys; ++i) {
+      struct polygon *poly = polys[i];
+      const VGfloat *v0 = ptr_to_vertex(poly->data, 0);
+
+      for (j = 1; j + 1 < poly->num_verts; ++j) {
+         memcpy(dst, v0, COMPONENTS * sizeof(VGfloat));
+         memcpy(dst + COMPONENTS, ptr_to_vertex(poly->data, j),
+                2 * COMPONENTS * sizeof(VGfloat));
+         dst += 3 * COMPONENTS;
+      }
+   }
+}
+
+const VGfloat *polygon_array_triangles(struct polygon_array *polyarray,
+                                       VGint *num_verts)
+{
+   if (!polyarray->vertices && polyarray->array)
+      build_polygon_array_vertices(polyarray);
+
+   *num_verts = polyarray->num_verts;
+   return polyarray->vertices;
+}
+
+static void draw_polygon_array(struct vg_context *ctx,
+                               struct polygon_array *polyarray)
+{
+   struct pipe_context *pipe = ctx->pipe;
+   struct pipe_vertex_buffer vbuffer;
+   struct pipe_vertex_element velement;
+
+   if (!polyarray->vbuf) {
+      VGint num_verts;
+      if (!polygon_array_triangles(polyarray, &num_verts) || !num_verts)
+         return;
+
+      polyarray->vbuf = pipe_user_buffer_create(pipe->screen,
+                                                polyarray->vertices,
+                                                polyarray->num_verts *
+                                                COMPONENTS * sizeof(float));
+      if (!polyarray->vbuf)
+         return;
+   }
+
+   /* tell pipe about the vertex buffer */
+   memset(&vbuffer, 0, sizeof(vbuffer));
+   vbuffer.buffer = polyarray->vbuf;
+   vbuffer.stride = COMPONENTS * sizeof(float);  /* vertex size */
+   vbuffer.buffer_offset = 0;
+   vbuffer.max_index = polyarray->num_verts - 1;
+   pipe->set_vertex_buffers(pipe, 1, &vbuffer);
+
+   /* tell pipe about the vertex attributes */
+   velement.src_offset = 0;
+   velement.vertex_buffer_index = 0;
+   velement.src_format = PIPE_FORMAT_R32G32_FLOAT;
+   velement.nr_components = COMPONENTS;
+   pipe->set_vertex_elements(pipe, 1, &velement);
+
+   /* draw */
+   pipe->draw_arrays(pipe, PIPE_PRIM_TRIANGLES,
+                     0, polyarray->num_verts);
+}
+
+void polygon_array_fill(struct polygon_array *polyarray, struct vg_context *ctx,
+                        struct matrix *matrix)
 {
-   struct array *polys = polyarray->array;
    struct pipe_depth_stencil_alpha_state dsa;
    struct pipe_blend_state blend;
    VGfloat min_x = polyarray->min_x;
    VGfloat min_y = polyarray->min_y;
    VGfloat max_x = polyarray->max_x;
    VGfloat max_y = polyarray->max_y;
-   VGint i;
-
 
 #if DEBUG_POLYGON
    debug_printf("%s: Poly bounds are [%f, %f], [%f, %f]\n",
@@ -438,6 +550,23 @@ void polygon_array_fill(struct polygon_array *polyarray, struct vg_context *ctx)
                 min_x, min_y, max_x, max_y);
 #endif
 
+   if (matrix) {
+      /* bounds of the transformed polygons for the cover quad */
+      VGfloat x[4], y[4];
+      matrix_map_point(matrix, polyarray->min_x, polyarray->min_y, &x[0], &y[0]);
+      matrix_map_point(matrix, polyarray->max_x, polyarray->min_y, &x[1], &y[1]);
+      matrix_map_point(matrix, polyarray->max_x, polyarray->max_y, &x[2], &y[2]);
+      matrix_map_point(matrix, polyarray->min_x, polyarray->max_y, &x[3], &y[3]);
+      min_x = MIN2(MIN2(x[0], x[1]), MIN2(x[2], x[3]));
+      min_y = MIN2(MIN2(y[0], y[1]), MIN2(y[2], y[3]));
+      max_x = MAX2(MAX2(x[0], x[1]), MAX2(x[2], x[3]));
+      max_y = MAX2(MAX2(y[0], y[1]), MAX2(y[2], y[3]));
+
+      cso_save_vertex_shader(ctx->cso_context);
+      vg_set_path_matrix(ctx, matrix);
+      cso_set_vertex_shader_handle(ctx->cso_context, vg_path_vs(ctx));
+   }
+
    set_blend_for_fill(&blend);
 
    memset(&dsa, 0, sizeof(struct pipe_depth_stencil_alpha_state));
@@ -457,10 +586,7 @@ void polygon_array_fill(struct polygon_array *polyarray, struct vg_context *ctx)
 
       cso_set_blend(ctx->cso_context, &blend);
       cso_set_depth_stencil_alpha(ctx->cso_context, &dsa);
-      for (i = 0; i < polys->num_elements; ++i) {
-         struct polygon *poly = (((struct polygon**)polys->data)[i]);
-         draw_polygon(ctx, poly);
-      }
+      draw_polygon_array(ctx, polyarray);
    } else if (ctx->state.vg.fill_rule == VG_NON_ZERO) {
       struct pipe_screen *screen = ctx->pipe->screen;
 
@@ -486,10 +612,7 @@ void polygon_array_fill(struct polygon_array *polyarray, struct vg_context *ctx)
 
          cso_set_blend(ctx->cso_context, &blend);
          cso_set_depth_stencil_alpha(ctx->cso_context, &dsa);
-         for (i = 0; i < polys->num_elements; ++i) {
-            struct polygon *poly = (((struct polygon**)polys->data)[i]);
-            draw_polygon(ctx, poly);
-         }
+         draw_polygon_array(ctx, polyarray);
       } else {
          struct pipe_rasterizer_state raster;
 
@@ -508,10 +631,7 @@ void polygon_array_fill(struct polygon_array *polyarray, struct vg_context *ctx)
          cso_set_blend(ctx->cso_context, &blend);
          cso_set_depth_stencil_alpha(ctx->cso_context, &dsa);
          cso_set_rasterizer(ctx->cso_context, &raster);
-         for (i = 0; i < polys->num_elements; ++i) {
-            struct polygon *poly = (((struct polygon**)polys->data)[i]);
-            draw_polygon(ctx, poly);
-         }
+         draw_polygon_array(ctx, polyarray);
 
          raster.cull_mode = raster.front_winding;
          dsa.stencil[0].fail_op = PIPE_STENCIL_OP_KEEP;
@@ -519,15 +639,15 @@ void polygon_array_fill(struct polygon_array *polyarray, struct vg_context *ctx)
          dsa.stencil[0].zpass_op = PIPE_STENCIL_OP_DECR_WRAP;
          cso_set_depth_stencil_alpha(ctx->cso_context, &dsa);
          cso_set_rasterizer(ctx->cso_context, &raster);
-         for (i = 0; i < polys->num_elements; ++i) {
-            struct polygon *poly = (((struct polygon**)polys->data)[i]);
-            draw_polygon(ctx, poly);
-         }
+         draw_polygon_array(ctx, polyarray);
 
          cso_restore_rasterizer(ctx->cso_context);
       }
    }
 
+   if (matrix)
+      cso_restore_vertex_shader(ctx->cso_context);
+
    /* restore color writes */
    cso_restore_blend(ctx->cso_context);
    /* setup stencil ops */
@@ -33,6 +33,8 @@ struct polygon;
 struct vg_context;
 struct vg_paint;
 struct array;
+struct matrix;
+struct pipe_buffer;
 
 struct polygon *polygon_create(int size);
 struct polygon *polygon_create_from_data(float *data, int size);
@@ -68,8 +70,21 @@ struct polygon_array {
    struct array *array;
    VGfloat min_x, max_x;
    VGfloat min_y, max_y;
+
+   /* all the polygons as a single triangle list, built on the first fill */
+   VGfloat *vertices;
+   VGint num_verts;
+   struct pipe_buffer *vbuf;
 };
 
-void polygon_array_fill(struct polygon_array *polyarray, struct vg_context *ctx);
+void polygon_array_cleanup(struct polygon_array *polyarray);
+/* the polygons as a triangle list of x, y pairs */
+const VGfloat *polygon_array_triangles(struct polygon_array *polyarray,
+                                       VGint *num_verts);
+
+/* matrix, if not NULL, is the affine transformation from the polygon
+ * coordinates to surface space and is applied in the vertex shader */
+void polygon_array_fill(struct polygon_array *polyarray, struct vg_context *ctx,
+                        struct matrix *matrix);
 
 #endif
@@ -79,6 +79,8 @@ struct vg_context * vg_create_context(struct pipe_context *pipe,
 
    vg_init_state(&ctx->state.vg);
    ctx->state.dirty = ALL_DIRTY;
+   ctx->vs_consts[8] = 1.f;  /* identity path matrix */
+   ctx->vs_consts[13] = 1.f;
 
    ctx->cso_context = cso_create_context(pipe);
 
@@ -154,6 +156,10 @@ void vg_destroy_context(struct vg_context *ctx)
       vg_shader_destroy(ctx, ctx->texture_vs);
       ctx->texture_vs = NULL;
    }
+   if (ctx->path_vs) {
+      vg_shader_destroy(ctx, ctx->path_vs);
+      ctx->path_vs = NULL;
+   }
 
    if (ctx->pass_through_depth_fs)
       vg_shader_destroy(ctx, ctx->pass_through_depth_fs);
@@ -294,6 +300,23 @@ static void update_clip_state(struct vg_context *ctx)
    }
 }
 
+static void update_vs_constants(struct vg_context *ctx)
+{
+   const VGint param_bytes = sizeof(ctx->vs_consts);
+   struct pipe_constant_buffer *cbuf = &ctx->vs_const_buffer;
+
+   pipe_buffer_reference(&cbuf->buffer, NULL);
+   cbuf->buffer = pipe_buffer_create(ctx->pipe->screen, 16,
+                                     PIPE_BUFFER_USAGE_CONSTANT,
+                                     param_bytes);
+
+   if (cbuf->buffer) {
+      st_no_flush_pipe_buffer_write(ctx, cbuf->buffer,
+                                    0, param_bytes, ctx->vs_consts);
+   }
+   ctx->pipe->set_constant_buffer(ctx->pipe, PIPE_SHADER_VERTEX, 0, cbuf);
+}
+
 void vg_validate_state(struct vg_context *ctx)
 {
    if ((ctx->state.dirty & BLEND_DIRTY)) {
@@ -364,25 +387,18 @@ void vg_validate_state(struct vg_context *ctx)
    }
    if ((ctx->state.dirty & VIEWPORT_DIRTY)) {
       struct pipe_framebuffer_state *fb = &ctx->state.g3d.fb;
-      const VGint param_bytes = 8 * sizeof(VGfloat);
-      VGfloat vs_consts[8] = {
-         2.f/fb->width, 2.f/fb->height, 1, 1,
-         -1, -1, 0, 0
-      };
-      struct pipe_constant_buffer *cbuf = &ctx->vs_const_buffer;
 
       vg_set_viewport(ctx, VEGA_Y0_BOTTOM);
 
-      pipe_buffer_reference(&cbuf->buffer, NULL);
-      cbuf->buffer = pipe_buffer_create(ctx->pipe->screen, 16,
-                                        PIPE_BUFFER_USAGE_CONSTANT,
-                                        param_bytes);
-
-      if (cbuf->buffer) {
-         st_no_flush_pipe_buffer_write(ctx, cbuf->buffer,
-                                       0, param_bytes, vs_consts);
-      }
-      ctx->pipe->set_constant_buffer(ctx->pipe, PIPE_SHADER_VERTEX, 0, cbuf);
+      ctx->vs_consts[0] = 2.f/fb->width;
+      ctx->vs_consts[1] = 2.f/fb->height;
+      ctx->vs_consts[2] = 1;
+      ctx->vs_consts[3] = 1;
+      ctx->vs_consts[4] = -1;
+      ctx->vs_consts[5] = -1;
+      ctx->vs_consts[6] = 0;
+      ctx->vs_consts[7] = 0;
+      update_vs_constants(ctx);
    }
    if ((ctx->state.dirty & VS_DIRTY)) {
       cso_set_vertex_shader_handle(ctx->cso_context,
@@ -524,6 +540,37 @@ void * vg_texture_vs(struct vg_context *ctx)
    return ctx->texture_vs->driver;
 }
 
+void * vg_path_vs(struct vg_context *ctx)
+{
+   if (!ctx->path_vs) {
+      ctx->path_vs = shader_create_from_text(ctx->pipe,
+                                             vs_path_asm,
+                                             200,
+                                             PIPE_SHADER_VERTEX);
+   }
+
+   return ctx->path_vs->driver;
+}
+
+/**
+ * Load the affine matrix applied by vg_path_vs().
+ */
+void vg_set_path_matrix(struct vg_context *ctx, struct matrix *matrix)
+{
+   const VGfloat rows[8] = {
+      matrix->m[0], matrix->m[3], 0.f, matrix->m[6],
+      matrix->m[1], matrix->m[4], 0.f, matrix->m[7]
+   };
+
+   assert(matrix_is_affine(matrix));
+
+   if (memcmp(&ctx->vs_consts[8], rows, sizeof(rows)) != 0 ||
+       !ctx->vs_const_buffer.buffer) {
+      memcpy(&ctx->vs_consts[8], rows, sizeof(rows));
+      update_vs_constants(ctx);
+   }
+}
+
 void vg_set_viewport(struct vg_context *ctx, VegaOrientation orientation)
 {
    struct pipe_viewport_state viewport;
@@ -145,7 +145,10 @@ struct vg_context
    struct vg_shader *plain_vs;
    struct vg_shader *clear_vs;
    struct vg_shader *texture_vs;
+   struct vg_shader *path_vs;
    struct pipe_constant_buffer vs_const_buffer;
+   /** viewport scale and bias, then the two rows of the path matrix */
+   VGfloat vs_consts[16];
 };
 
 struct vg_object {
@@ -283,6 +286,8 @@ static INLINE void vg_bound_rect(VGfloat coords[4],
 void *vg_plain_vs(struct vg_context *ctx);
 void *vg_clear_vs(struct vg_context *ctx);
 void *vg_texture_vs(struct vg_context *ctx);
+void *vg_path_vs(struct vg_context *ctx);
+void vg_set_path_matrix(struct vg_context *ctx, struct matrix *matrix);
 typedef enum {
    VEGA_Y0_TOP,
    VEGA_Y0_BOTTOM
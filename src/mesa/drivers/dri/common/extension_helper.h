@@ -709,6 +709,13 @@ static const char FogCoorddEXT_names[] =
     "";
 #endif
 
+#if defined(need_GL_NV_conditional_render)
+static const char BeginConditionalRenderNV_names[] =
+    "ii\0" /* Parameter signature */
+    "glBeginConditionalRenderNV\0"
+    "";
+#endif
+
 #if defined(need_GL_SUN_vertex)
 static const char Color4ubVertex3fSUN_names[] =
     "iiiifff\0" /* Parameter signature */
@@ -3789,6 +3796,13 @@ static const char GetMapParameterfvNV_names[] =
     "";
 #endif
 
+#if defined(need_GL_NV_conditional_render)
+static const char EndConditionalRenderNV_names[] =
+    "\0" /* Parameter signature */
+    "glEndConditionalRenderNV\0"
+    "";
+#endif
+
 #if defined(need_GL_ATI_fragment_shader)
 static const char PassTexCoordATI_names[] =
     "iii\0" /* Parameter signature */
@@ -5943,6 +5957,14 @@ static const struct dri_extension_function GL_MESA_window_pos_functions[] = {
 };
 #endif
 
+#if defined(need_GL_NV_conditional_render)
+static const struct dri_extension_function GL_NV_conditional_render_functions[] = {
+    { BeginConditionalRenderNV_names, BeginConditionalRenderNV_remap_index, -1 },
+    { EndConditionalRenderNV_names, EndConditionalRenderNV_remap_index, -1 },
+    { NULL, 0, 0 }
+};
+#endif
+
 #if defined(need_GL_NV_evaluators)
 static const struct dri_extension_function GL_NV_evaluators_functions[] = {
     { GetMapAttribParameterivNV_names, GetMapAttribParameterivNV_remap_index, -1 },
@@ -6933,6 +6955,10 @@ static const struct dri_extension_function GL_VERSION_2_1_functions[] = {
 #define GL_MESA_window_pos_functions NULL
 #endif
 
+#if defined(need_GL_NV_conditional_render)
+#define GL_NV_conditional_render_functions NULL
+#endif
+
 #if defined(need_GL_NV_evaluators)
 #define GL_NV_evaluators_functions NULL
 #endif
@@ -1197,6 +1197,125 @@ static void put_row_rgb_GRAYSCALE_pixmap( RGB_SPAN_ARGS )
    }
 }
 
+/*
+ * Row kernels for the XImage span functions below.  The pack_row_*()
+ * functions convert a whole row of GLubyte RGBA pixels, read as 32-bit
+ * words, with shifts and masks.  The caller checks that the source is
+ * 4-byte aligned.
+ */
+
+#define ALIGNED4(P)  ((((uintptr_t) (P)) & 3) == 0)
+
+static void
+pack_row_8A8B8G8R(GLuint *dst, const GLuint *src, GLuint n)
+{
+   if (_mesa_little_endian()) {
+      /* same byte layout as the RGBA source */
+      _mesa_memcpy(dst, src, n * 4);
+   }
+   else {
+      GLuint i;
+      for (i = 0; i < n; i++) {
+         const GLuint p = src[i];
+         dst[i] = (p >> 24) | ((p >> 8) & 0xff00) |
+                  ((p << 8) & 0xff0000) | (p << 24);
+      }
+   }
+}
+
+static void
+pack_row_8A8R8G8B(GLuint *dst, const GLuint *src, GLuint n)
+{
+   GLuint i;
+   if (_mesa_little_endian()) {
+      for (i = 0; i < n; i++) {
+         const GLuint p = src[i];
+         dst[i] = (p & 0xff00ff00) | ((p & 0xff) << 16) | ((p >> 16) & 0xff);
+      }
+   }
+   else {
+      for (i = 0; i < n; i++) {
+         const GLuint p = src[i];
+         dst[i] = (p >> 8) | (p << 24);
+      }
+   }
+}
+
+static void
+pack_row_8R8G8B(GLuint *dst, const GLuint *src, GLuint n)
+{
+   GLuint i;
+   if (_mesa_little_endian()) {
+      for (i = 0; i < n; i++) {
+         const GLuint p = src[i];
+         dst[i] = ((p & 0xff) << 16) | (p & 0xff00) | ((p >> 16) & 0xff);
+      }
+   }
+   else {
+      for (i = 0; i < n; i++) {
+         dst[i] = src[i] >> 8;
+      }
+   }
+}
+
+static void
+pack_row_5R6G5B(GLushort *dst, const GLuint *src, GLuint n)
+{
+   GLuint i;
+   if (_mesa_little_endian()) {
+      for (i = 0; i < n; i++) {
+         const GLuint p = src[i];
+         dst[i] = ((p & 0xf8) << 8) | ((p >> 5) & 0x7e0) | ((p >> 19) & 0x1f);
+      }
+   }
+   else {
+      for (i = 0; i < n; i++) {
+         const GLuint p = src[i];
+         dst[i] = ((p >> 16) & 0xf800) | ((p >> 13) & 0x7e0) | ((p >> 11) & 0x1f);
+      }
+   }
+}
+
+
+/*
+ * Store a row of pixel values into a 16 or 32 bpp XImage at (x, y),
+ * where y is already flipped.  Bytes are swapped if the display's byte
+ * order differs from ours.  This does what XPutPixel would, without a
+ * function call per pixel.
+ */
+static void
+put_ximage_row(const XMesaContext xmesa, XMesaImage *img, GLint x, GLint y,
+               GLuint n, const GLuint pixel[], const GLubyte mask[])
+{
+   char *row = img->data + y * img->bytes_per_line;
+   GLuint i;
+   if (img->bits_per_pixel == 32) {
+      GLuint *dst = (GLuint *) row + x;
+      for (i = 0; i < n; i++) {
+         if (!mask || mask[i]) {
+            GLuint p = pixel[i];
+            if (xmesa->swapbytes)
+               p = (p >> 24) | ((p >> 8) & 0xff00) |
+                   ((p << 8) & 0xff0000) | (p << 24);
+            dst[i] = p;
+         }
+      }
+   }
+   else {
+      GLushort *dst = (GLushort *) row + x;
+      ASSERT(img->bits_per_pixel == 16);
+      for (i = 0; i < n; i++) {
+         if (!mask || mask[i]) {
+            GLuint p = pixel[i];
+            if (xmesa->swapbytes)
+               p = ((p >> 8) & 0xff) | ((p & 0xff) << 8);
+            dst[i] = (GLushort) p;
+         }
+      }
+   }
+}
+
+
 /*
  * Write a span of PF_TRUECOLOR pixels to an XImage.
  */
@@ -1208,7 +1327,14 @@ static void put_row_TRUECOLOR_ximage( PUT_ROW_ARGS )
    XMesaImage *img = xrb->ximage;
    register GLuint i;
    y = YFLIP(xrb, y);
-   if (mask) {
+   if (img->bits_per_pixel == 16 || img->bits_per_pixel == 32) {
+      GLuint pixel[MAX_WIDTH];
+      for (i=0;i<n;i++) {
+         PACK_TRUECOLOR( pixel[i], rgba[i][RCOMP], rgba[i][GCOMP], rgba[i][BCOMP] );
+      }
+      put_ximage_row( xmesa, img, x, y, n, pixel, mask );
+   }
+   else if (mask) {
       for (i=0;i<n;i++,x++) {
          if (mask[i]) {
             unsigned long p;
@@ -1270,7 +1396,14 @@ static void put_row_TRUEDITHER_ximage( PUT_ROW_ARGS )
    XMesaImage *img = xrb->ximage;
    register GLuint i;
    y = YFLIP(xrb, y);
-   if (mask) {
+   if (img->bits_per_pixel == 16 || img->bits_per_pixel == 32) {
+      GLuint pixel[MAX_WIDTH];
+      for (i=0;i<n;i++) {
+         PACK_TRUEDITHER( pixel[i], x+i, y, rgba[i][RCOMP], rgba[i][GCOMP], rgba[i][BCOMP] );
+      }
+      put_ximage_row( xmesa, img, x, y, n, pixel, mask );
+   }
+   else if (mask) {
       for (i=0;i<n;i++,x++) {
          if (mask[i]) {
             unsigned long p;
@@ -1338,6 +1471,10 @@ static void put_row_8A8B8G8R_ximage( PUT_ROW_ARGS )
          }
       }
    }
+   else if (ALIGNED4(rgba)) {
+      /* draw all pixels */
+      pack_row_8A8B8G8R( ptr, (const GLuint *) rgba, n );
+   }
    else {
       /* draw all pixels */
       for (i=0;i<n;i++) {
@@ -1387,6 +1524,10 @@ static void put_row_8A8R8G8B_ximage( PUT_ROW_ARGS )
          }
       }
    }
+   else if (ALIGNED4(rgba)) {
+      /* draw all pixels */
+      pack_row_8A8R8G8B( ptr, (const GLuint *) rgba, n );
+   }
    else {
       /* draw all pixels */
       for (i=0;i<n;i++) {
@@ -1437,6 +1578,9 @@ static void put_row_8R8G8B_ximage( PUT_ROW_ARGS )
          }
       }
    }
+   else if (ALIGNED4(rgba)) {
+      pack_row_8R8G8B( ptr, (const GLuint *) rgba, n );
+   }
    else {
       for (i=0;i<n;i++) {
          ptr[i] = PACK_8R8G8B(rgba[i][RCOMP], rgba[i][GCOMP], rgba[i][BCOMP]);
@@ -1669,6 +1813,10 @@ static void put_row_5R6G5B_ximage( PUT_ROW_ARGS )
          }
       }
    }
+   else if (ALIGNED4(rgba)) {
+      /* draw all pixels */
+      pack_row_5R6G5B( ptr, (const GLuint *) rgba, n );
+   }
    else {
       /* draw all pixels */
 #if defined(__i386__) /* word stores don't have to be on 4-byte boundaries */
@@ -289,6 +289,39 @@ typedef unsigned _glthread_Mutex;
 
 
 
+/*
+ * Atomic integer operations, used for reference counting objects which
+ * are shared between contexts.  When these are available
+ * _glthread_HAVE_ATOMICS is defined and callers can update counts without
+ * taking the object's mutex.  Without THREADS plain arithmetic is enough.
+ */
+#if defined(THREADS) && defined(__GNUC__) && \
+    (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 1))
+
+#define _glthread_HAVE_ATOMICS 1
+
+#define _glthread_ATOMIC_INC(x)  __sync_add_and_fetch(&(x), 1)
+
+#define _glthread_ATOMIC_DEC(x)  __sync_sub_and_fetch(&(x), 1)
+
+#define _glthread_ATOMIC_CMPXCHG(x, oldval, newval) \
+   __sync_bool_compare_and_swap(&(x), oldval, newval)
+
+#elif !defined(THREADS)
+
+#define _glthread_HAVE_ATOMICS 1
+
+#define _glthread_ATOMIC_INC(x)  (++(x))
+
+#define _glthread_ATOMIC_DEC(x)  (--(x))
+
+#define _glthread_ATOMIC_CMPXCHG(x, oldval, newval) \
+   ((x) == (oldval) ? ((x) = (newval), 1) : 0)
+
+#endif
+
+
+
 /*
  * Platform independent thread specific data API.
  */
@@ -27,6 +27,7 @@
 #include "context.h"
 #include "imports.h"
 #include "macros.h"
+#include "queryobj.h"
 #include "state.h"
 #include "mtypes.h"
 #include "glapi/dispatch.h"
@@ -97,7 +98,7 @@ _mesa_Accum( GLenum op, GLfloat value )
       return;
    }
 
-   if (ctx->RenderMode == GL_RENDER) {
+   if (ctx->RenderMode == GL_RENDER && _mesa_check_conditional_render(ctx)) {
       ctx->Driver.Accum(ctx, op, value);
    }
 }
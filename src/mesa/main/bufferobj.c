@@ -231,15 +231,19 @@ _mesa_reference_buffer_object(GLcontext *ctx,
       GLboolean deleteFlag = GL_FALSE;
       struct gl_buffer_object *oldObj = *ptr;
 
-      /*_glthread_LOCK_MUTEX(oldObj->Mutex);*/
       ASSERT(oldObj->RefCount > 0);
+#ifdef _glthread_HAVE_ATOMICS
+      deleteFlag = (_glthread_ATOMIC_DEC(oldObj->RefCount) == 0);
+#else
+      /*_glthread_LOCK_MUTEX(oldObj->Mutex);*/
       oldObj->RefCount--;
+      deleteFlag = (oldObj->RefCount == 0);
+      /*_glthread_UNLOCK_MUTEX(oldObj->Mutex);*/
+#endif
 #if 0
       printf("BufferObj %p %d DECR to %d\n",
              (void *) oldObj, oldObj->Name, oldObj->RefCount);
 #endif
-      deleteFlag = (oldObj->RefCount == 0);
-      /*_glthread_UNLOCK_MUTEX(oldObj->Mutex);*/
 
       if (deleteFlag) {
 
@@ -261,22 +265,32 @@ _mesa_reference_buffer_object(GLcontext *ctx,
 
    if (bufObj) {
       /* reference new buffer */
+      GLint count;
+#ifdef _glthread_HAVE_ATOMICS
+      /* increment unless another thread just dropped it to zero */
+      do {
+         count = bufObj->RefCount;
+      } while (count != 0 &&
+               !_glthread_ATOMIC_CMPXCHG(bufObj->RefCount, count, count + 1));
+#else
       /*_glthread_LOCK_MUTEX(tex->Mutex);*/
-      if (bufObj->RefCount == 0) {
+      count = bufObj->RefCount;
+      if (count != 0)
+         bufObj->RefCount++;
+#endif
+      if (count == 0) {
          /* this buffer's being deleted (look just above) */
          /* Not sure this can every really happen.  Warn if it does. */
          _mesa_problem(NULL, "referencing deleted buffer object");
          *ptr = NULL;
       }
       else {
-         bufObj->RefCount++;
 #if 0
          printf("BufferObj %p %d INCR to %d\n",
                 (void *) bufObj, bufObj->Name, bufObj->RefCount);
 #endif
          *ptr = bufObj;
       }
-      /*_glthread_UNLOCK_MUTEX(tex->Mutex);*/
    }
 }
 
@@ -824,6 +838,8 @@ _mesa_map_pbo_dest(GLcontext *ctx,
       if (!buf)
          return NULL;
 
+      _mesa_bufferobj_written(pack->BufferObj);
+
       buf = ADD_POINTERS(buf, dest);
    }
    else {
@@ -1160,7 +1176,7 @@ _mesa_BufferDataARB(GLenum target, GLsizeiptrARB size,
 
    FLUSH_VERTICES(ctx, _NEW_BUFFER_OBJECT);
 
-   bufObj->Written = GL_TRUE;
+   _mesa_bufferobj_written(bufObj);
 
 #ifdef VBO_DEBUG
    _mesa_printf("glBufferDataARB(%u, sz %ld, from %p, usage 0x%x)\n",
@@ -1193,7 +1209,7 @@ _mesa_BufferSubDataARB(GLenum target, GLintptrARB offset,
       return;
    }
 
-   bufObj->Written = GL_TRUE;
+   _mesa_bufferobj_written(bufObj);
 
    ASSERT(ctx->Driver.BufferSubData);
    ctx->Driver.BufferSubData( ctx, target, offset, size, data, bufObj );
@@ -1277,7 +1293,7 @@ _mesa_MapBufferARB(GLenum target, GLenum access)
    }
 
    if (access == GL_WRITE_ONLY_ARB || access == GL_READ_WRITE_ARB)
-      bufObj->Written = GL_TRUE;
+      _mesa_bufferobj_written(bufObj);
 
 #ifdef VBO_DEBUG
    _mesa_printf("glMapBufferARB(%u, sz %ld, access 0x%x)\n",
@@ -1512,6 +1528,8 @@ _mesa_CopyBufferSubData(GLenum readTarget, GLenum writeTarget,
       }
    }
 
+   _mesa_bufferobj_written(dst);
+
    ctx->Driver.CopyBufferSubData(ctx, src, dst, readOffset, writeOffset, size);
 }
 
@@ -1604,6 +1622,8 @@ _mesa_MapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length,
       ASSERT(bufObj->Length == length);
       ASSERT(bufObj->Offset == offset);
       ASSERT(bufObj->AccessFlags == access);
+      if (access & GL_MAP_WRITE_BIT)
+         _mesa_bufferobj_written(bufObj);
    }
 
    return map;
@@ -55,6 +55,17 @@ _mesa_is_bufferobj(const struct gl_buffer_object *obj)
    return obj->Name != 0;
 }
 
+/**
+ * Note that the contents of the given buffer object may have changed,
+ * which makes anything cached from them (like index bounds) stale.
+ */
+static INLINE void
+_mesa_bufferobj_written(struct gl_buffer_object *obj)
+{
+   obj->Written = GL_TRUE;
+   obj->WriteStamp++;
+}
+
 
 extern void
 _mesa_init_buffer_objects( GLcontext *ctx );
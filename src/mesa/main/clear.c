@@ -34,6 +34,7 @@
 #include "clear.h"
 #include "context.h"
 #include "colormac.h"
+#include "queryobj.h"
 #include "state.h"
 
 
@@ -143,6 +144,9 @@ _mesa_Clear( GLbitfield mask )
        ctx->DrawBuffer->_Ymin >= ctx->DrawBuffer->_Ymax)
       return;
 
+   if (!_mesa_check_conditional_render(ctx))
+      return; /* don't clear */
+
    if (ctx->RenderMode == GL_RENDER) {
       GLbitfield bufferMask;
 
@@ -318,6 +318,9 @@ typedef enum
    /* GL_ARB_occlusion_query */
    OPCODE_BEGIN_QUERY_ARB,
    OPCODE_END_QUERY_ARB,
+   /* GL_NV_conditional_render */
+   OPCODE_BEGIN_CONDITIONAL_RENDER_NV,
+   OPCODE_END_CONDITIONAL_RENDER_NV,
    /* GL_ARB_draw_buffers */
    OPCODE_DRAW_BUFFERS_ARB,
    /* GL_ATI_fragment_shader */
@@ -4843,6 +4846,35 @@ save_EndQueryARB(GLenum target)
    }
 }
 
+
+static void GLAPIENTRY
+save_BeginConditionalRenderNV(GLuint query, GLenum mode)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   Node *n;
+   ASSERT_OUTSIDE_SAVE_BEGIN_END_AND_FLUSH(ctx);
+   n = ALLOC_INSTRUCTION(ctx, OPCODE_BEGIN_CONDITIONAL_RENDER_NV, 2);
+   if (n) {
+      n[1].ui = query;
+      n[2].e = mode;
+   }
+   if (ctx->ExecuteFlag) {
+      CALL_BeginConditionalRenderNV(ctx->Exec, (query, mode));
+   }
+}
+
+
+static void GLAPIENTRY
+save_EndConditionalRenderNV(void)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   ASSERT_OUTSIDE_SAVE_BEGIN_END_AND_FLUSH(ctx);
+   (void) ALLOC_INSTRUCTION(ctx, OPCODE_END_CONDITIONAL_RENDER_NV, 0);
+   if (ctx->ExecuteFlag) {
+      CALL_EndConditionalRenderNV(ctx->Exec, ());
+   }
+}
+
 #endif /* FEATURE_queryobj */
 
 
@@ -6628,6 +6660,12 @@ execute_list(GLcontext *ctx, GLuint list)
          case OPCODE_END_QUERY_ARB:
             CALL_EndQueryARB(ctx->Exec, (n[1].e));
             break;
+         case OPCODE_BEGIN_CONDITIONAL_RENDER_NV:
+            CALL_BeginConditionalRenderNV(ctx->Exec, (n[1].ui, n[2].e));
+            break;
+         case OPCODE_END_CONDITIONAL_RENDER_NV:
+            CALL_EndConditionalRenderNV(ctx->Exec, ());
+            break;
 #endif
          case OPCODE_DRAW_BUFFERS_ARB:
             {
@@ -8307,6 +8345,10 @@ _mesa_init_save_table(struct _glapi_table *table)
    SET_GetQueryivARB(table, _mesa_GetQueryivARB);
    SET_GetQueryObjectivARB(table, _mesa_GetQueryObjectivARB);
    SET_GetQueryObjectuivARB(table, _mesa_GetQueryObjectuivARB);
+
+   /* GL_NV_conditional_render */
+   SET_BeginConditionalRenderNV(table, save_BeginConditionalRenderNV);
+   SET_EndConditionalRenderNV(table, save_EndConditionalRenderNV);
 #endif
    SET_DrawBuffersARB(table, save_DrawBuffersARB);
 
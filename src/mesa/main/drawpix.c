@@ -31,6 +31,7 @@
 #include "feedback.h"
 #include "framebuffer.h"
 #include "image.h"
+#include "queryobj.h"
 #include "readpix.h"
 #include "state.h"
 #include "glapi/dispatch.h"
@@ -96,7 +97,7 @@ _mesa_DrawPixels( GLsizei width, GLsizei height,
    }
 
    if (ctx->RenderMode == GL_RENDER) {
-      if (width > 0 && height > 0) {
+      if (width > 0 && height > 0 && _mesa_check_conditional_render(ctx)) {
          /* Round, to satisfy conformance tests (matches SGI's OpenGL) */
          GLint x = IROUND(ctx->Current.RasterPos[0]);
          GLint y = IROUND(ctx->Current.RasterPos[1]);
@@ -201,7 +202,7 @@ _mesa_CopyPixels( GLint srcx, GLint srcy, GLsizei width, GLsizei height,
 
    if (ctx->RenderMode == GL_RENDER) {
       /* Round to satisfy conformance tests (matches SGI's OpenGL) */
-      if (width > 0 && height > 0) {
+      if (width > 0 && height > 0 && _mesa_check_conditional_render(ctx)) {
          GLint destx = IROUND(ctx->Current.RasterPos[0]);
          GLint desty = IROUND(ctx->Current.RasterPos[1]);
          ctx->Driver.CopyPixels( ctx, srcx, srcy, width, height, destx, desty,
@@ -262,7 +263,7 @@ _mesa_Bitmap( GLsizei width, GLsizei height,
 
    if (ctx->RenderMode == GL_RENDER) {
       /* Truncate, to satisfy conformance tests (matches SGI's OpenGL). */
-      if (width > 0 && height > 0) {
+      if (width > 0 && height > 0 && _mesa_check_conditional_render(ctx)) {
          const GLfloat epsilon = 0.0001F;
          GLint x = IFLOOR(ctx->Current.RasterPos[0] + epsilon - xorig);
          GLint y = IFLOOR(ctx->Current.RasterPos[1] + epsilon - yorig);
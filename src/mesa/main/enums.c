@@ -1312,12 +1312,16 @@ LONGSTRING static const char enum_string_table[] =
    "GL_QUADS_FOLLOW_PROVOKING_VERTEX_CONVENTION_EXT\0"
    "GL_QUAD_MESH_SUN\0"
    "GL_QUAD_STRIP\0"
+   "GL_QUERY_BY_REGION_NO_WAIT_NV\0"
+   "GL_QUERY_BY_REGION_WAIT_NV\0"
    "GL_QUERY_COUNTER_BITS\0"
    "GL_QUERY_COUNTER_BITS_ARB\0"
+   "GL_QUERY_NO_WAIT_NV\0"
    "GL_QUERY_RESULT\0"
    "GL_QUERY_RESULT_ARB\0"
    "GL_QUERY_RESULT_AVAILABLE\0"
    "GL_QUERY_RESULT_AVAILABLE_ARB\0"
+   "GL_QUERY_WAIT_NV\0"
    "GL_R\0"
    "GL_R3_G3_B2\0"
    "GL_RASTER_POSITION_UNCLIPPED_IBM\0"
@@ -1896,7 +1900,7 @@ LONGSTRING static const char enum_string_table[] =
    "GL_ZOOM_Y\0"
    ;
 
-static const enum_elt all_enums[1858] =
+static const enum_elt all_enums[1862] =
 {
    {     0, 0x00000600 }, /* GL_2D */
    {     6, 0x00001407 }, /* GL_2_BYTES */
@@ -3174,599 +3178,603 @@ static const enum_elt all_enums[1858] =
    { 28019, 0x00008E4C }, /* GL_QUADS_FOLLOW_PROVOKING_VERTEX_CONVENTION_EXT */
    { 28067, 0x00008614 }, /* GL_QUAD_MESH_SUN */
    { 28084, 0x00000008 }, /* GL_QUAD_STRIP */
-   { 28098, 0x00008864 }, /* GL_QUERY_COUNTER_BITS */
-   { 28120, 0x00008864 }, /* GL_QUERY_COUNTER_BITS_ARB */
-   { 28146, 0x00008866 }, /* GL_QUERY_RESULT */
-   { 28162, 0x00008866 }, /* GL_QUERY_RESULT_ARB */
-   { 28182, 0x00008867 }, /* GL_QUERY_RESULT_AVAILABLE */
-   { 28208, 0x00008867 }, /* GL_QUERY_RESULT_AVAILABLE_ARB */
-   { 28238, 0x00002002 }, /* GL_R */
-   { 28243, 0x00002A10 }, /* GL_R3_G3_B2 */
-   { 28255, 0x00019262 }, /* GL_RASTER_POSITION_UNCLIPPED_IBM */
-   { 28288, 0x00000C02 }, /* GL_READ_BUFFER */
-   { 28303, 0x00008CA8 }, /* GL_READ_FRAMEBUFFER */
-   { 28323, 0x00008CAA }, /* GL_READ_FRAMEBUFFER_BINDING_EXT */
-   { 28355, 0x00008CA8 }, /* GL_READ_FRAMEBUFFER_EXT */
-   { 28379, 0x000088B8 }, /* GL_READ_ONLY */
-   { 28392, 0x000088B8 }, /* GL_READ_ONLY_ARB */
-   { 28409, 0x000088BA }, /* GL_READ_WRITE */
-   { 28423, 0x000088BA }, /* GL_READ_WRITE_ARB */
-   { 28441, 0x00001903 }, /* GL_RED */
-   { 28448, 0x00008016 }, /* GL_REDUCE */
-   { 28458, 0x00008016 }, /* GL_REDUCE_EXT */
-   { 28472, 0x00000D15 }, /* GL_RED_BIAS */
-   { 28484, 0x00000D52 }, /* GL_RED_BITS */
-   { 28496, 0x00000D14 }, /* GL_RED_SCALE */
-   { 28509, 0x00008512 }, /* GL_REFLECTION_MAP */
-   { 28527, 0x00008512 }, /* GL_REFLECTION_MAP_ARB */
-   { 28549, 0x00008512 }, /* GL_REFLECTION_MAP_NV */
-   { 28570, 0x00001C00 }, /* GL_RENDER */
-   { 28580, 0x00008D41 }, /* GL_RENDERBUFFER */
-   { 28596, 0x00008D53 }, /* GL_RENDERBUFFER_ALPHA_SIZE */
-   { 28623, 0x00008CA7 }, /* GL_RENDERBUFFER_BINDING_EXT */
-   { 28651, 0x00008D52 }, /* GL_RENDERBUFFER_BLUE_SIZE */
-   { 28677, 0x00008D54 }, /* GL_RENDERBUFFER_DEPTH_SIZE */
-   { 28704, 0x00008D41 }, /* GL_RENDERBUFFER_EXT */
-   { 28724, 0x00008D51 }, /* GL_RENDERBUFFER_GREEN_SIZE */
-   { 28751, 0x00008D43 }, /* GL_RENDERBUFFER_HEIGHT */
-   { 28774, 0x00008D43 }, /* GL_RENDERBUFFER_HEIGHT_EXT */
-   { 28801, 0x00008D44 }, /* GL_RENDERBUFFER_INTERNAL_FORMAT */
-   { 28833, 0x00008D44 }, /* GL_RENDERBUFFER_INTERNAL_FORMAT_EXT */
-   { 28869, 0x00008D50 }, /* GL_RENDERBUFFER_RED_SIZE */
-   { 28894, 0x00008CAB }, /* GL_RENDERBUFFER_SAMPLES */
-   { 28918, 0x00008D55 }, /* GL_RENDERBUFFER_STENCIL_SIZE */
-   { 28947, 0x00008D42 }, /* GL_RENDERBUFFER_WIDTH */
-   { 28969, 0x00008D42 }, /* GL_RENDERBUFFER_WIDTH_EXT */
-   { 28995, 0x00001F01 }, /* GL_RENDERER */
-   { 29007, 0x00000C40 }, /* GL_RENDER_MODE */
-   { 29022, 0x00002901 }, /* GL_REPEAT */
-   { 29032, 0x00001E01 }, /* GL_REPLACE */
-   { 29043, 0x00008062 }, /* GL_REPLACE_EXT */
-   { 29058, 0x00008153 }, /* GL_REPLICATE_BORDER_HP */
-   { 29081, 0x0000803A }, /* GL_RESCALE_NORMAL */
-   { 29099, 0x0000803A }, /* GL_RESCALE_NORMAL_EXT */
-   { 29121, 0x00000102 }, /* GL_RETURN */
-   { 29131, 0x00001907 }, /* GL_RGB */
-   { 29138, 0x00008052 }, /* GL_RGB10 */
-   { 29147, 0x00008059 }, /* GL_RGB10_A2 */
-   { 29159, 0x00008059 }, /* GL_RGB10_A2_EXT */
-   { 29175, 0x00008052 }, /* GL_RGB10_EXT */
-   { 29188, 0x00008053 }, /* GL_RGB12 */
-   { 29197, 0x00008053 }, /* GL_RGB12_EXT */
-   { 29210, 0x00008054 }, /* GL_RGB16 */
-   { 29219, 0x00008054 }, /* GL_RGB16_EXT */
-   { 29232, 0x0000804E }, /* GL_RGB2_EXT */
-   { 29244, 0x0000804F }, /* GL_RGB4 */
-   { 29252, 0x0000804F }, /* GL_RGB4_EXT */
-   { 29264, 0x000083A1 }, /* GL_RGB4_S3TC */
-   { 29277, 0x00008050 }, /* GL_RGB5 */
-   { 29285, 0x00008057 }, /* GL_RGB5_A1 */
-   { 29296, 0x00008057 }, /* GL_RGB5_A1_EXT */
-   { 29311, 0x00008050 }, /* GL_RGB5_EXT */
-   { 29323, 0x00008051 }, /* GL_RGB8 */
-   { 29331, 0x00008051 }, /* GL_RGB8_EXT */
-   { 29343, 0x00001908 }, /* GL_RGBA */
-   { 29351, 0x0000805A }, /* GL_RGBA12 */
-   { 29361, 0x0000805A }, /* GL_RGBA12_EXT */
-   { 29375, 0x0000805B }, /* GL_RGBA16 */
-   { 29385, 0x0000805B }, /* GL_RGBA16_EXT */
-   { 29399, 0x00008055 }, /* GL_RGBA2 */
-   { 29408, 0x00008055 }, /* GL_RGBA2_EXT */
-   { 29421, 0x00008056 }, /* GL_RGBA4 */
-   { 29430, 0x000083A5 }, /* GL_RGBA4_DXT5_S3TC */
-   { 29449, 0x00008056 }, /* GL_RGBA4_EXT */
-   { 29462, 0x000083A3 }, /* GL_RGBA4_S3TC */
-   { 29476, 0x00008058 }, /* GL_RGBA8 */
-   { 29485, 0x00008058 }, /* GL_RGBA8_EXT */
-   { 29498, 0x00008F97 }, /* GL_RGBA8_SNORM */
-   { 29513, 0x000083A4 }, /* GL_RGBA_DXT5_S3TC */
-   { 29531, 0x00000C31 }, /* GL_RGBA_MODE */
-   { 29544, 0x000083A2 }, /* GL_RGBA_S3TC */
-   { 29557, 0x00008F93 }, /* GL_RGBA_SNORM */
-   { 29571, 0x000083A0 }, /* GL_RGB_S3TC */
-   { 29583, 0x00008573 }, /* GL_RGB_SCALE */
-   { 29596, 0x00008573 }, /* GL_RGB_SCALE_ARB */
-   { 29613, 0x00008573 }, /* GL_RGB_SCALE_EXT */
-   { 29630, 0x00000407 }, /* GL_RIGHT */
-   { 29639, 0x00002000 }, /* GL_S */
-   { 29644, 0x00008B5D }, /* GL_SAMPLER_1D */
-   { 29658, 0x00008B61 }, /* GL_SAMPLER_1D_SHADOW */
-   { 29679, 0x00008B5E }, /* GL_SAMPLER_2D */
-   { 29693, 0x00008B62 }, /* GL_SAMPLER_2D_SHADOW */
-   { 29714, 0x00008B5F }, /* GL_SAMPLER_3D */
-   { 29728, 0x00008B60 }, /* GL_SAMPLER_CUBE */
-   { 29744, 0x000080A9 }, /* GL_SAMPLES */
-   { 29755, 0x000086B4 }, /* GL_SAMPLES_3DFX */
-   { 29771, 0x000080A9 }, /* GL_SAMPLES_ARB */
-   { 29786, 0x00008914 }, /* GL_SAMPLES_PASSED */
-   { 29804, 0x00008914 }, /* GL_SAMPLES_PASSED_ARB */
-   { 29826, 0x0000809E }, /* GL_SAMPLE_ALPHA_TO_COVERAGE */
-   { 29854, 0x0000809E }, /* GL_SAMPLE_ALPHA_TO_COVERAGE_ARB */
-   { 29886, 0x0000809F }, /* GL_SAMPLE_ALPHA_TO_ONE */
-   { 29909, 0x0000809F }, /* GL_SAMPLE_ALPHA_TO_ONE_ARB */
-   { 29936, 0x000080A8 }, /* GL_SAMPLE_BUFFERS */
-   { 29954, 0x000086B3 }, /* GL_SAMPLE_BUFFERS_3DFX */
-   { 29977, 0x000080A8 }, /* GL_SAMPLE_BUFFERS_ARB */
-   { 29999, 0x000080A0 }, /* GL_SAMPLE_COVERAGE */
-   { 30018, 0x000080A0 }, /* GL_SAMPLE_COVERAGE_ARB */
-   { 30041, 0x000080AB }, /* GL_SAMPLE_COVERAGE_INVERT */
-   { 30067, 0x000080AB }, /* GL_SAMPLE_COVERAGE_INVERT_ARB */
-   { 30097, 0x000080AA }, /* GL_SAMPLE_COVERAGE_VALUE */
-   { 30122, 0x000080AA }, /* GL_SAMPLE_COVERAGE_VALUE_ARB */
-   { 30151, 0x00080000 }, /* GL_SCISSOR_BIT */
-   { 30166, 0x00000C10 }, /* GL_SCISSOR_BOX */
-   { 30181, 0x00000C11 }, /* GL_SCISSOR_TEST */
-   { 30197, 0x0000845E }, /* GL_SECONDARY_COLOR_ARRAY */
-   { 30222, 0x0000889C }, /* GL_SECONDARY_COLOR_ARRAY_BUFFER_BINDING */
-   { 30262, 0x0000889C }, /* GL_SECONDARY_COLOR_ARRAY_BUFFER_BINDING_ARB */
-   { 30306, 0x0000845D }, /* GL_SECONDARY_COLOR_ARRAY_POINTER */
-   { 30339, 0x0000845A }, /* GL_SECONDARY_COLOR_ARRAY_SIZE */
-   { 30369, 0x0000845C }, /* GL_SECONDARY_COLOR_ARRAY_STRIDE */
-   { 30401, 0x0000845B }, /* GL_SECONDARY_COLOR_ARRAY_TYPE */
-   { 30431, 0x00001C02 }, /* GL_SELECT */
-   { 30441, 0x00000DF3 }, /* GL_SELECTION_BUFFER_POINTER */
-   { 30469, 0x00000DF4 }, /* GL_SELECTION_BUFFER_SIZE */
-   { 30494, 0x00008012 }, /* GL_SEPARABLE_2D */
-   { 30510, 0x000081FA }, /* GL_SEPARATE_SPECULAR_COLOR */
-   { 30537, 0x000081FA }, /* GL_SEPARATE_SPECULAR_COLOR_EXT */
-   { 30568, 0x0000150F }, /* GL_SET */
-   { 30575, 0x00008B48 }, /* GL_SHADER_OBJECT_ARB */
-   { 30596, 0x00008B88 }, /* GL_SHADER_SOURCE_LENGTH */
-   { 30620, 0x00008B4F }, /* GL_SHADER_TYPE */
-   { 30635, 0x00000B54 }, /* GL_SHADE_MODEL */
-   { 30650, 0x00008B8C }, /* GL_SHADING_LANGUAGE_VERSION */
-   { 30678, 0x000080BF }, /* GL_SHADOW_AMBIENT_SGIX */
-   { 30701, 0x000081FB }, /* GL_SHARED_TEXTURE_PALETTE_EXT */
-   { 30731, 0x00001601 }, /* GL_SHININESS */
-   { 30744, 0x00001402 }, /* GL_SHORT */
-   { 30753, 0x00009119 }, /* GL_SIGNALED */
-   { 30765, 0x00008F9C }, /* GL_SIGNED_NORMALIZED */
-   { 30786, 0x000081F9 }, /* GL_SINGLE_COLOR */
-   { 30802, 0x000081F9 }, /* GL_SINGLE_COLOR_EXT */
-   { 30822, 0x000085CC }, /* GL_SLICE_ACCUM_SUN */
-   { 30841, 0x00008C46 }, /* GL_SLUMINANCE */
-   { 30855, 0x00008C47 }, /* GL_SLUMINANCE8 */
-   { 30870, 0x00008C45 }, /* GL_SLUMINANCE8_ALPHA8 */
-   { 30892, 0x00008C44 }, /* GL_SLUMINANCE_ALPHA */
-   { 30912, 0x00001D01 }, /* GL_SMOOTH */
-   { 30922, 0x00000B23 }, /* GL_SMOOTH_LINE_WIDTH_GRANULARITY */
-   { 30955, 0x00000B22 }, /* GL_SMOOTH_LINE_WIDTH_RANGE */
-   { 30982, 0x00000B13 }, /* GL_SMOOTH_POINT_SIZE_GRANULARITY */
-   { 31015, 0x00000B12 }, /* GL_SMOOTH_POINT_SIZE_RANGE */
-   { 31042, 0x00008588 }, /* GL_SOURCE0_ALPHA */
-   { 31059, 0x00008588 }, /* GL_SOURCE0_ALPHA_ARB */
-   { 31080, 0x00008588 }, /* GL_SOURCE0_ALPHA_EXT */
-   { 31101, 0x00008580 }, /* GL_SOURCE0_RGB */
-   { 31116, 0x00008580 }, /* GL_SOURCE0_RGB_ARB */
-   { 31135, 0x00008580 }, /* GL_SOURCE0_RGB_EXT */
-   { 31154, 0x00008589 }, /* GL_SOURCE1_ALPHA */
-   { 31171, 0x00008589 }, /* GL_SOURCE1_ALPHA_ARB */
-   { 31192, 0x00008589 }, /* GL_SOURCE1_ALPHA_EXT */
-   { 31213, 0x00008581 }, /* GL_SOURCE1_RGB */
-   { 31228, 0x00008581 }, /* GL_SOURCE1_RGB_ARB */
-   { 31247, 0x00008581 }, /* GL_SOURCE1_RGB_EXT */
-   { 31266, 0x0000858A }, /* GL_SOURCE2_ALPHA */
-   { 31283, 0x0000858A }, /* GL_SOURCE2_ALPHA_ARB */
-   { 31304, 0x0000858A }, /* GL_SOURCE2_ALPHA_EXT */
-   { 31325, 0x00008582 }, /* GL_SOURCE2_RGB */
-   { 31340, 0x00008582 }, /* GL_SOURCE2_RGB_ARB */
-   { 31359, 0x00008582 }, /* GL_SOURCE2_RGB_EXT */
-   { 31378, 0x0000858B }, /* GL_SOURCE3_ALPHA_NV */
-   { 31398, 0x00008583 }, /* GL_SOURCE3_RGB_NV */
-   { 31416, 0x00001202 }, /* GL_SPECULAR */
-   { 31428, 0x00002402 }, /* GL_SPHERE_MAP */
-   { 31442, 0x00001206 }, /* GL_SPOT_CUTOFF */
-   { 31457, 0x00001204 }, /* GL_SPOT_DIRECTION */
-   { 31475, 0x00001205 }, /* GL_SPOT_EXPONENT */
-   { 31492, 0x00008588 }, /* GL_SRC0_ALPHA */
-   { 31506, 0x00008580 }, /* GL_SRC0_RGB */
-   { 31518, 0x00008589 }, /* GL_SRC1_ALPHA */
-   { 31532, 0x00008581 }, /* GL_SRC1_RGB */
-   { 31544, 0x0000858A }, /* GL_SRC2_ALPHA */
-   { 31558, 0x00008582 }, /* GL_SRC2_RGB */
-   { 31570, 0x00000302 }, /* GL_SRC_ALPHA */
-   { 31583, 0x00000308 }, /* GL_SRC_ALPHA_SATURATE */
-   { 31605, 0x00000300 }, /* GL_SRC_COLOR */
-   { 31618, 0x00008C40 }, /* GL_SRGB */
-   { 31626, 0x00008C41 }, /* GL_SRGB8 */
-   { 31635, 0x00008C43 }, /* GL_SRGB8_ALPHA8 */
-   { 31651, 0x00008C42 }, /* GL_SRGB_ALPHA */
-   { 31665, 0x00000503 }, /* GL_STACK_OVERFLOW */
-   { 31683, 0x00000504 }, /* GL_STACK_UNDERFLOW */
-   { 31702, 0x000088E6 }, /* GL_STATIC_COPY */
-   { 31717, 0x000088E6 }, /* GL_STATIC_COPY_ARB */
-   { 31736, 0x000088E4 }, /* GL_STATIC_DRAW */
-   { 31751, 0x000088E4 }, /* GL_STATIC_DRAW_ARB */
-   { 31770, 0x000088E5 }, /* GL_STATIC_READ */
-   { 31785, 0x000088E5 }, /* GL_STATIC_READ_ARB */
-   { 31804, 0x00001802 }, /* GL_STENCIL */
-   { 31815, 0x00008D20 }, /* GL_STENCIL_ATTACHMENT */
-   { 31837, 0x00008D20 }, /* GL_STENCIL_ATTACHMENT_EXT */
-   { 31863, 0x00008801 }, /* GL_STENCIL_BACK_FAIL */
-   { 31884, 0x00008801 }, /* GL_STENCIL_BACK_FAIL_ATI */
-   { 31909, 0x00008800 }, /* GL_STENCIL_BACK_FUNC */
-   { 31930, 0x00008800 }, /* GL_STENCIL_BACK_FUNC_ATI */
-   { 31955, 0x00008802 }, /* GL_STENCIL_BACK_PASS_DEPTH_FAIL */
-   { 31987, 0x00008802 }, /* GL_STENCIL_BACK_PASS_DEPTH_FAIL_ATI */
-   { 32023, 0x00008803 }, /* GL_STENCIL_BACK_PASS_DEPTH_PASS */
-   { 32055, 0x00008803 }, /* GL_STENCIL_BACK_PASS_DEPTH_PASS_ATI */
-   { 32091, 0x00008CA3 }, /* GL_STENCIL_BACK_REF */
-   { 32111, 0x00008CA4 }, /* GL_STENCIL_BACK_VALUE_MASK */
-   { 32138, 0x00008CA5 }, /* GL_STENCIL_BACK_WRITEMASK */
-   { 32164, 0x00000D57 }, /* GL_STENCIL_BITS */
-   { 32180, 0x00000400 }, /* GL_STENCIL_BUFFER_BIT */
-   { 32202, 0x00000B91 }, /* GL_STENCIL_CLEAR_VALUE */
-   { 32225, 0x00000B94 }, /* GL_STENCIL_FAIL */
-   { 32241, 0x00000B92 }, /* GL_STENCIL_FUNC */
-   { 32257, 0x00001901 }, /* GL_STENCIL_INDEX */
-   { 32274, 0x00008D49 }, /* GL_STENCIL_INDEX16_EXT */
-   { 32297, 0x00008D46 }, /* GL_STENCIL_INDEX1_EXT */
-   { 32319, 0x00008D47 }, /* GL_STENCIL_INDEX4_EXT */
-   { 32341, 0x00008D48 }, /* GL_STENCIL_INDEX8_EXT */
-   { 32363, 0x00008D45 }, /* GL_STENCIL_INDEX_EXT */
-   { 32384, 0x00000B95 }, /* GL_STENCIL_PASS_DEPTH_FAIL */
-   { 32411, 0x00000B96 }, /* GL_STENCIL_PASS_DEPTH_PASS */
-   { 32438, 0x00000B97 }, /* GL_STENCIL_REF */
-   { 32453, 0x00000B90 }, /* GL_STENCIL_TEST */
-   { 32469, 0x00008910 }, /* GL_STENCIL_TEST_TWO_SIDE_EXT */
-   { 32498, 0x00000B93 }, /* GL_STENCIL_VALUE_MASK */
-   { 32520, 0x00000B98 }, /* GL_STENCIL_WRITEMASK */
-   { 32541, 0x00000C33 }, /* GL_STEREO */
-   { 32551, 0x000085BE }, /* GL_STORAGE_CACHED_APPLE */
-   { 32575, 0x000085BD }, /* GL_STORAGE_PRIVATE_APPLE */
-   { 32600, 0x000085BF }, /* GL_STORAGE_SHARED_APPLE */
-   { 32624, 0x000088E2 }, /* GL_STREAM_COPY */
-   { 32639, 0x000088E2 }, /* GL_STREAM_COPY_ARB */
-   { 32658, 0x000088E0 }, /* GL_STREAM_DRAW */
-   { 32673, 0x000088E0 }, /* GL_STREAM_DRAW_ARB */
-   { 32692, 0x000088E1 }, /* GL_STREAM_READ */
-   { 32707, 0x000088E1 }, /* GL_STREAM_READ_ARB */
-   { 32726, 0x00000D50 }, /* GL_SUBPIXEL_BITS */
-   { 32743, 0x000084E7 }, /* GL_SUBTRACT */
-   { 32755, 0x000084E7 }, /* GL_SUBTRACT_ARB */
-   { 32771, 0x00009113 }, /* GL_SYNC_CONDITION */
-   { 32789, 0x00009116 }, /* GL_SYNC_FENCE */
-   { 32803, 0x00009115 }, /* GL_SYNC_FLAGS */
-   { 32817, 0x00000001 }, /* GL_SYNC_FLUSH_COMMANDS_BIT */
-   { 32844, 0x00009117 }, /* GL_SYNC_GPU_COMMANDS_COMPLETE */
-   { 32874, 0x00009114 }, /* GL_SYNC_STATUS */
-   { 32889, 0x00002001 }, /* GL_T */
-   { 32894, 0x00002A2A }, /* GL_T2F_C3F_V3F */
-   { 32909, 0x00002A2C }, /* GL_T2F_C4F_N3F_V3F */
-   { 32928, 0x00002A29 }, /* GL_T2F_C4UB_V3F */
-   { 32944, 0x00002A2B }, /* GL_T2F_N3F_V3F */
-   { 32959, 0x00002A27 }, /* GL_T2F_V3F */
-   { 32970, 0x00002A2D }, /* GL_T4F_C4F_N3F_V4F */
-   { 32989, 0x00002A28 }, /* GL_T4F_V4F */
-   { 33000, 0x00008031 }, /* GL_TABLE_TOO_LARGE_EXT */
-   { 33023, 0x00001702 }, /* GL_TEXTURE */
-   { 33034, 0x000084C0 }, /* GL_TEXTURE0 */
-   { 33046, 0x000084C0 }, /* GL_TEXTURE0_ARB */
-   { 33062, 0x000084C1 }, /* GL_TEXTURE1 */
-   { 33074, 0x000084CA }, /* GL_TEXTURE10 */
-   { 33087, 0x000084CA }, /* GL_TEXTURE10_ARB */
-   { 33104, 0x000084CB }, /* GL_TEXTURE11 */
-   { 33117, 0x000084CB }, /* GL_TEXTURE11_ARB */
-   { 33134, 0x000084CC }, /* GL_TEXTURE12 */
-   { 33147, 0x000084CC }, /* GL_TEXTURE12_ARB */
-   { 33164, 0x000084CD }, /* GL_TEXTURE13 */
-   { 33177, 0x000084CD }, /* GL_TEXTURE13_ARB */
-   { 33194, 0x000084CE }, /* GL_TEXTURE14 */
-   { 33207, 0x000084CE }, /* GL_TEXTURE14_ARB */
-   { 33224, 0x000084CF }, /* GL_TEXTURE15 */
-   { 33237, 0x000084CF }, /* GL_TEXTURE15_ARB */
-   { 33254, 0x000084D0 }, /* GL_TEXTURE16 */
-   { 33267, 0x000084D0 }, /* GL_TEXTURE16_ARB */
-   { 33284, 0x000084D1 }, /* GL_TEXTURE17 */
-   { 33297, 0x000084D1 }, /* GL_TEXTURE17_ARB */
-   { 33314, 0x000084D2 }, /* GL_TEXTURE18 */
-   { 33327, 0x000084D2 }, /* GL_TEXTURE18_ARB */
-   { 33344, 0x000084D3 }, /* GL_TEXTURE19 */
-   { 33357, 0x000084D3 }, /* GL_TEXTURE19_ARB */
-   { 33374, 0x000084C1 }, /* GL_TEXTURE1_ARB */
-   { 33390, 0x000084C2 }, /* GL_TEXTURE2 */
-   { 33402, 0x000084D4 }, /* GL_TEXTURE20 */
-   { 33415, 0x000084D4 }, /* GL_TEXTURE20_ARB */
-   { 33432, 0x000084D5 }, /* GL_TEXTURE21 */
-   { 33445, 0x000084D5 }, /* GL_TEXTURE21_ARB */
-   { 33462, 0x000084D6 }, /* GL_TEXTURE22 */
-   { 33475, 0x000084D6 }, /* GL_TEXTURE22_ARB */
-   { 33492, 0x000084D7 }, /* GL_TEXTURE23 */
-   { 33505, 0x000084D7 }, /* GL_TEXTURE23_ARB */
-   { 33522, 0x000084D8 }, /* GL_TEXTURE24 */
-   { 33535, 0x000084D8 }, /* GL_TEXTURE24_ARB */
-   { 33552, 0x000084D9 }, /* GL_TEXTURE25 */
-   { 33565, 0x000084D9 }, /* GL_TEXTURE25_ARB */
-   { 33582, 0x000084DA }, /* GL_TEXTURE26 */
-   { 33595, 0x000084DA }, /* GL_TEXTURE26_ARB */
-   { 33612, 0x000084DB }, /* GL_TEXTURE27 */
-   { 33625, 0x000084DB }, /* GL_TEXTURE27_ARB */
-   { 33642, 0x000084DC }, /* GL_TEXTURE28 */
-   { 33655, 0x000084DC }, /* GL_TEXTURE28_ARB */
-   { 33672, 0x000084DD }, /* GL_TEXTURE29 */
-   { 33685, 0x000084DD }, /* GL_TEXTURE29_ARB */
-   { 33702, 0x000084C2 }, /* GL_TEXTURE2_ARB */
-   { 33718, 0x000084C3 }, /* GL_TEXTURE3 */
-   { 33730, 0x000084DE }, /* GL_TEXTURE30 */
-   { 33743, 0x000084DE }, /* GL_TEXTURE30_ARB */
-   { 33760, 0x000084DF }, /* GL_TEXTURE31 */
-   { 33773, 0x000084DF }, /* GL_TEXTURE31_ARB */
-   { 33790, 0x000084C3 }, /* GL_TEXTURE3_ARB */
-   { 33806, 0x000084C4 }, /* GL_TEXTURE4 */
-   { 33818, 0x000084C4 }, /* GL_TEXTURE4_ARB */
-   { 33834, 0x000084C5 }, /* GL_TEXTURE5 */
-   { 33846, 0x000084C5 }, /* GL_TEXTURE5_ARB */
-   { 33862, 0x000084C6 }, /* GL_TEXTURE6 */
-   { 33874, 0x000084C6 }, /* GL_TEXTURE6_ARB */
-   { 33890, 0x000084C7 }, /* GL_TEXTURE7 */
-   { 33902, 0x000084C7 }, /* GL_TEXTURE7_ARB */
-   { 33918, 0x000084C8 }, /* GL_TEXTURE8 */
-   { 33930, 0x000084C8 }, /* GL_TEXTURE8_ARB */
-   { 33946, 0x000084C9 }, /* GL_TEXTURE9 */
-   { 33958, 0x000084C9 }, /* GL_TEXTURE9_ARB */
-   { 33974, 0x00000DE0 }, /* GL_TEXTURE_1D */
-   { 33988, 0x00008C18 }, /* GL_TEXTURE_1D_ARRAY_EXT */
-   { 34012, 0x00000DE1 }, /* GL_TEXTURE_2D */
-   { 34026, 0x00008C1A }, /* GL_TEXTURE_2D_ARRAY_EXT */
-   { 34050, 0x0000806F }, /* GL_TEXTURE_3D */
-   { 34064, 0x0000805F }, /* GL_TEXTURE_ALPHA_SIZE */
-   { 34086, 0x0000805F }, /* GL_TEXTURE_ALPHA_SIZE_EXT */
-   { 34112, 0x0000813C }, /* GL_TEXTURE_BASE_LEVEL */
-   { 34134, 0x00008068 }, /* GL_TEXTURE_BINDING_1D */
-   { 34156, 0x00008C1C }, /* GL_TEXTURE_BINDING_1D_ARRAY_EXT */
-   { 34188, 0x00008069 }, /* GL_TEXTURE_BINDING_2D */
-   { 34210, 0x00008C1D }, /* GL_TEXTURE_BINDING_2D_ARRAY_EXT */
-   { 34242, 0x0000806A }, /* GL_TEXTURE_BINDING_3D */
-   { 34264, 0x00008514 }, /* GL_TEXTURE_BINDING_CUBE_MAP */
-   { 34292, 0x00008514 }, /* GL_TEXTURE_BINDING_CUBE_MAP_ARB */
-   { 34324, 0x000084F6 }, /* GL_TEXTURE_BINDING_RECTANGLE_ARB */
-   { 34357, 0x000084F6 }, /* GL_TEXTURE_BINDING_RECTANGLE_NV */
-   { 34389, 0x00040000 }, /* GL_TEXTURE_BIT */
-   { 34404, 0x0000805E }, /* GL_TEXTURE_BLUE_SIZE */
-   { 34425, 0x0000805E }, /* GL_TEXTURE_BLUE_SIZE_EXT */
-   { 34450, 0x00001005 }, /* GL_TEXTURE_BORDER */
-   { 34468, 0x00001004 }, /* GL_TEXTURE_BORDER_COLOR */
-   { 34492, 0x00008171 }, /* GL_TEXTURE_CLIPMAP_CENTER_SGIX */
-   { 34523, 0x00008176 }, /* GL_TEXTURE_CLIPMAP_DEPTH_SGIX */
-   { 34553, 0x00008172 }, /* GL_TEXTURE_CLIPMAP_FRAME_SGIX */
-   { 34583, 0x00008175 }, /* GL_TEXTURE_CLIPMAP_LOD_OFFSET_SGIX */
-   { 34618, 0x00008173 }, /* GL_TEXTURE_CLIPMAP_OFFSET_SGIX */
-   { 34649, 0x00008174 }, /* GL_TEXTURE_CLIPMAP_VIRTUAL_DEPTH_SGIX */
-   { 34687, 0x000080BC }, /* GL_TEXTURE_COLOR_TABLE_SGI */
-   { 34714, 0x000081EF }, /* GL_TEXTURE_COLOR_WRITEMASK_SGIS */
-   { 34746, 0x000080BF }, /* GL_TEXTURE_COMPARE_FAIL_VALUE_ARB */
-   { 34780, 0x0000884D }, /* GL_TEXTURE_COMPARE_FUNC */
-   { 34804, 0x0000884D }, /* GL_TEXTURE_COMPARE_FUNC_ARB */
-   { 34832, 0x0000884C }, /* GL_TEXTURE_COMPARE_MODE */
-   { 34856, 0x0000884C }, /* GL_TEXTURE_COMPARE_MODE_ARB */
-   { 34884, 0x0000819B }, /* GL_TEXTURE_COMPARE_OPERATOR_SGIX */
-   { 34917, 0x0000819A }, /* GL_TEXTURE_COMPARE_SGIX */
-   { 34941, 0x00001003 }, /* GL_TEXTURE_COMPONENTS */
-   { 34963, 0x000086A1 }, /* GL_TEXTURE_COMPRESSED */
-   { 34985, 0x000086A1 }, /* GL_TEXTURE_COMPRESSED_ARB */
-   { 35011, 0x000086A3 }, /* GL_TEXTURE_COMPRESSED_FORMATS_ARB */
-   { 35045, 0x000086A0 }, /* GL_TEXTURE_COMPRESSED_IMAGE_SIZE */
-   { 35078, 0x000086A0 }, /* GL_TEXTURE_COMPRESSED_IMAGE_SIZE_ARB */
-   { 35115, 0x000084EF }, /* GL_TEXTURE_COMPRESSION_HINT */
-   { 35143, 0x000084EF }, /* GL_TEXTURE_COMPRESSION_HINT_ARB */
-   { 35175, 0x00008078 }, /* GL_TEXTURE_COORD_ARRAY */
-   { 35198, 0x0000889A }, /* GL_TEXTURE_COORD_ARRAY_BUFFER_BINDING */
-   { 35236, 0x0000889A }, /* GL_TEXTURE_COORD_ARRAY_BUFFER_BINDING_ARB */
-   { 35278, 0x00008092 }, /* GL_TEXTURE_COORD_ARRAY_POINTER */
-   { 35309, 0x00008088 }, /* GL_TEXTURE_COORD_ARRAY_SIZE */
-   { 35337, 0x0000808A }, /* GL_TEXTURE_COORD_ARRAY_STRIDE */
-   { 35367, 0x00008089 }, /* GL_TEXTURE_COORD_ARRAY_TYPE */
-   { 35395, 0x00008513 }, /* GL_TEXTURE_CUBE_MAP */
-   { 35415, 0x00008513 }, /* GL_TEXTURE_CUBE_MAP_ARB */
-   { 35439, 0x00008516 }, /* GL_TEXTURE_CUBE_MAP_NEGATIVE_X */
-   { 35470, 0x00008516 }, /* GL_TEXTURE_CUBE_MAP_NEGATIVE_X_ARB */
-   { 35505, 0x00008518 }, /* GL_TEXTURE_CUBE_MAP_NEGATIVE_Y */
-   { 35536, 0x00008518 }, /* GL_TEXTURE_CUBE_MAP_NEGATIVE_Y_ARB */
-   { 35571, 0x0000851A }, /* GL_TEXTURE_CUBE_MAP_NEGATIVE_Z */
-   { 35602, 0x0000851A }, /* GL_TEXTURE_CUBE_MAP_NEGATIVE_Z_ARB */
-   { 35637, 0x00008515 }, /* GL_TEXTURE_CUBE_MAP_POSITIVE_X */
-   { 35668, 0x00008515 }, /* GL_TEXTURE_CUBE_MAP_POSITIVE_X_ARB */
-   { 35703, 0x00008517 }, /* GL_TEXTURE_CUBE_MAP_POSITIVE_Y */
-   { 35734, 0x00008517 }, /* GL_TEXTURE_CUBE_MAP_POSITIVE_Y_ARB */
-   { 35769, 0x00008519 }, /* GL_TEXTURE_CUBE_MAP_POSITIVE_Z */
-   { 35800, 0x00008519 }, /* GL_TEXTURE_CUBE_MAP_POSITIVE_Z_ARB */
-   { 35835, 0x000088F4 }, /* GL_TEXTURE_CUBE_MAP_SEAMLESS */
-   { 35864, 0x00008071 }, /* GL_TEXTURE_DEPTH */
-   { 35881, 0x0000884A }, /* GL_TEXTURE_DEPTH_SIZE */
-   { 35903, 0x0000884A }, /* GL_TEXTURE_DEPTH_SIZE_ARB */
-   { 35929, 0x00002300 }, /* GL_TEXTURE_ENV */
-   { 35944, 0x00002201 }, /* GL_TEXTURE_ENV_COLOR */
-   { 35965, 0x00002200 }, /* GL_TEXTURE_ENV_MODE */
-   { 35985, 0x00008500 }, /* GL_TEXTURE_FILTER_CONTROL */
-   { 36011, 0x00002500 }, /* GL_TEXTURE_GEN_MODE */
-   { 36031, 0x00000C63 }, /* GL_TEXTURE_GEN_Q */
-   { 36048, 0x00000C62 }, /* GL_TEXTURE_GEN_R */
-   { 36065, 0x00000C60 }, /* GL_TEXTURE_GEN_S */
-   { 36082, 0x00000C61 }, /* GL_TEXTURE_GEN_T */
-   { 36099, 0x0000819D }, /* GL_TEXTURE_GEQUAL_R_SGIX */
-   { 36124, 0x0000805D }, /* GL_TEXTURE_GREEN_SIZE */
-   { 36146, 0x0000805D }, /* GL_TEXTURE_GREEN_SIZE_EXT */
-   { 36172, 0x00001001 }, /* GL_TEXTURE_HEIGHT */
-   { 36190, 0x000080ED }, /* GL_TEXTURE_INDEX_SIZE_EXT */
-   { 36216, 0x00008061 }, /* GL_TEXTURE_INTENSITY_SIZE */
-   { 36242, 0x00008061 }, /* GL_TEXTURE_INTENSITY_SIZE_EXT */
-   { 36272, 0x00001003 }, /* GL_TEXTURE_INTERNAL_FORMAT */
-   { 36299, 0x0000819C }, /* GL_TEXTURE_LEQUAL_R_SGIX */
-   { 36324, 0x00008501 }, /* GL_TEXTURE_LOD_BIAS */
-   { 36344, 0x00008501 }, /* GL_TEXTURE_LOD_BIAS_EXT */
-   { 36368, 0x00008190 }, /* GL_TEXTURE_LOD_BIAS_R_SGIX */
-   { 36395, 0x0000818E }, /* GL_TEXTURE_LOD_BIAS_S_SGIX */
-   { 36422, 0x0000818F }, /* GL_TEXTURE_LOD_BIAS_T_SGIX */
-   { 36449, 0x00008060 }, /* GL_TEXTURE_LUMINANCE_SIZE */
-   { 36475, 0x00008060 }, /* GL_TEXTURE_LUMINANCE_SIZE_EXT */
-   { 36505, 0x00002800 }, /* GL_TEXTURE_MAG_FILTER */
-   { 36527, 0x00000BA8 }, /* GL_TEXTURE_MATRIX */
-   { 36545, 0x000084FE }, /* GL_TEXTURE_MAX_ANISOTROPY_EXT */
-   { 36575, 0x0000836B }, /* GL_TEXTURE_MAX_CLAMP_R_SGIX */
-   { 36603, 0x00008369 }, /* GL_TEXTURE_MAX_CLAMP_S_SGIX */
-   { 36631, 0x0000836A }, /* GL_TEXTURE_MAX_CLAMP_T_SGIX */
-   { 36659, 0x0000813D }, /* GL_TEXTURE_MAX_LEVEL */
-   { 36680, 0x0000813B }, /* GL_TEXTURE_MAX_LOD */
-   { 36699, 0x00002801 }, /* GL_TEXTURE_MIN_FILTER */
-   { 36721, 0x0000813A }, /* GL_TEXTURE_MIN_LOD */
-   { 36740, 0x00008066 }, /* GL_TEXTURE_PRIORITY */
-   { 36760, 0x000085B7 }, /* GL_TEXTURE_RANGE_LENGTH_APPLE */
-   { 36790, 0x000085B8 }, /* GL_TEXTURE_RANGE_POINTER_APPLE */
-   { 36821, 0x000084F5 }, /* GL_TEXTURE_RECTANGLE_ARB */
-   { 36846, 0x000084F5 }, /* GL_TEXTURE_RECTANGLE_NV */
-   { 36870, 0x0000805C }, /* GL_TEXTURE_RED_SIZE */
-   { 36890, 0x0000805C }, /* GL_TEXTURE_RED_SIZE_EXT */
-   { 36914, 0x00008067 }, /* GL_TEXTURE_RESIDENT */
-   { 36934, 0x00000BA5 }, /* GL_TEXTURE_STACK_DEPTH */
-   { 36957, 0x000088F1 }, /* GL_TEXTURE_STENCIL_SIZE */
-   { 36981, 0x000085BC }, /* GL_TEXTURE_STORAGE_HINT_APPLE */
-   { 37011, 0x00008065 }, /* GL_TEXTURE_TOO_LARGE_EXT */
-   { 37036, 0x0000888F }, /* GL_TEXTURE_UNSIGNED_REMAP_MODE_NV */
-   { 37070, 0x00001000 }, /* GL_TEXTURE_WIDTH */
-   { 37087, 0x00008072 }, /* GL_TEXTURE_WRAP_R */
-   { 37105, 0x00002802 }, /* GL_TEXTURE_WRAP_S */
-   { 37123, 0x00002803 }, /* GL_TEXTURE_WRAP_T */
-   { 37141, 0x0000911B }, /* GL_TIMEOUT_EXPIRED */
-   { 37160, 0xFFFFFFFFFFFFFFFF }, /* GL_TIMEOUT_IGNORED */
-   { 37179, 0x000088BF }, /* GL_TIME_ELAPSED_EXT */
-   { 37199, 0x00008648 }, /* GL_TRACK_MATRIX_NV */
-   { 37218, 0x00008649 }, /* GL_TRACK_MATRIX_TRANSFORM_NV */
-   { 37247, 0x00001000 }, /* GL_TRANSFORM_BIT */
-   { 37264, 0x000084E6 }, /* GL_TRANSPOSE_COLOR_MATRIX */
-   { 37290, 0x000084E6 }, /* GL_TRANSPOSE_COLOR_MATRIX_ARB */
-   { 37320, 0x000088B7 }, /* GL_TRANSPOSE_CURRENT_MATRIX_ARB */
-   { 37352, 0x000084E3 }, /* GL_TRANSPOSE_MODELVIEW_MATRIX */
-   { 37382, 0x000084E3 }, /* GL_TRANSPOSE_MODELVIEW_MATRIX_ARB */
-   { 37416, 0x0000862C }, /* GL_TRANSPOSE_NV */
-   { 37432, 0x000084E4 }, /* GL_TRANSPOSE_PROJECTION_MATRIX */
-   { 37463, 0x000084E4 }, /* GL_TRANSPOSE_PROJECTION_MATRIX_ARB */
-   { 37498, 0x000084E5 }, /* GL_TRANSPOSE_TEXTURE_MATRIX */
-   { 37526, 0x000084E5 }, /* GL_TRANSPOSE_TEXTURE_MATRIX_ARB */
-   { 37558, 0x00000004 }, /* GL_TRIANGLES */
-   { 37571, 0x00000006 }, /* GL_TRIANGLE_FAN */
-   { 37587, 0x00008615 }, /* GL_TRIANGLE_MESH_SUN */
-   { 37608, 0x00000005 }, /* GL_TRIANGLE_STRIP */
-   { 37626, 0x00000001 }, /* GL_TRUE */
-   { 37634, 0x00000CF5 }, /* GL_UNPACK_ALIGNMENT */
-   { 37654, 0x0000806E }, /* GL_UNPACK_IMAGE_HEIGHT */
-   { 37677, 0x00000CF1 }, /* GL_UNPACK_LSB_FIRST */
-   { 37697, 0x00000CF2 }, /* GL_UNPACK_ROW_LENGTH */
-   { 37718, 0x0000806D }, /* GL_UNPACK_SKIP_IMAGES */
-   { 37740, 0x00000CF4 }, /* GL_UNPACK_SKIP_PIXELS */
-   { 37762, 0x00000CF3 }, /* GL_UNPACK_SKIP_ROWS */
-   { 37782, 0x00000CF0 }, /* GL_UNPACK_SWAP_BYTES */
-   { 37803, 0x00009118 }, /* GL_UNSIGNALED */
-   { 37817, 0x00001401 }, /* GL_UNSIGNED_BYTE */
-   { 37834, 0x00008362 }, /* GL_UNSIGNED_BYTE_2_3_3_REV */
-   { 37861, 0x00008032 }, /* GL_UNSIGNED_BYTE_3_3_2 */
-   { 37884, 0x00001405 }, /* GL_UNSIGNED_INT */
-   { 37900, 0x00008036 }, /* GL_UNSIGNED_INT_10_10_10_2 */
-   { 37927, 0x000084FA }, /* GL_UNSIGNED_INT_24_8 */
-   { 37948, 0x000084FA }, /* GL_UNSIGNED_INT_24_8_NV */
-   { 37972, 0x00008368 }, /* GL_UNSIGNED_INT_2_10_10_10_REV */
-   { 38003, 0x00008035 }, /* GL_UNSIGNED_INT_8_8_8_8 */
-   { 38027, 0x00008367 }, /* GL_UNSIGNED_INT_8_8_8_8_REV */
-   { 38055, 0x00008C17 }, /* GL_UNSIGNED_NORMALIZED */
-   { 38078, 0x00001403 }, /* GL_UNSIGNED_SHORT */
-   { 38096, 0x00008366 }, /* GL_UNSIGNED_SHORT_1_5_5_5_REV */
-   { 38126, 0x00008033 }, /* GL_UNSIGNED_SHORT_4_4_4_4 */
-   { 38152, 0x00008365 }, /* GL_UNSIGNED_SHORT_4_4_4_4_REV */
-   { 38182, 0x00008034 }, /* GL_UNSIGNED_SHORT_5_5_5_1 */
-   { 38208, 0x00008363 }, /* GL_UNSIGNED_SHORT_5_6_5 */
-   { 38232, 0x00008364 }, /* GL_UNSIGNED_SHORT_5_6_5_REV */
-   { 38260, 0x000085BA }, /* GL_UNSIGNED_SHORT_8_8_APPLE */
-   { 38288, 0x000085BA }, /* GL_UNSIGNED_SHORT_8_8_MESA */
-   { 38315, 0x000085BB }, /* GL_UNSIGNED_SHORT_8_8_REV_APPLE */
-   { 38347, 0x000085BB }, /* GL_UNSIGNED_SHORT_8_8_REV_MESA */
-   { 38378, 0x00008CA2 }, /* GL_UPPER_LEFT */
-   { 38392, 0x00002A20 }, /* GL_V2F */
-   { 38399, 0x00002A21 }, /* GL_V3F */
-   { 38406, 0x00008B83 }, /* GL_VALIDATE_STATUS */
-   { 38425, 0x00001F00 }, /* GL_VENDOR */
-   { 38435, 0x00001F02 }, /* GL_VERSION */
-   { 38446, 0x00008074 }, /* GL_VERTEX_ARRAY */
-   { 38462, 0x000085B5 }, /* GL_VERTEX_ARRAY_BINDING */
-   { 38486, 0x000085B5 }, /* GL_VERTEX_ARRAY_BINDING_APPLE */
-   { 38516, 0x00008896 }, /* GL_VERTEX_ARRAY_BUFFER_BINDING */
-   { 38547, 0x00008896 }, /* GL_VERTEX_ARRAY_BUFFER_BINDING_ARB */
-   { 38582, 0x0000808E }, /* GL_VERTEX_ARRAY_POINTER */
-   { 38606, 0x0000807A }, /* GL_VERTEX_ARRAY_SIZE */
-   { 38627, 0x0000807C }, /* GL_VERTEX_ARRAY_STRIDE */
-   { 38650, 0x0000807B }, /* GL_VERTEX_ARRAY_TYPE */
-   { 38671, 0x00008650 }, /* GL_VERTEX_ATTRIB_ARRAY0_NV */
-   { 38698, 0x0000865A }, /* GL_VERTEX_ATTRIB_ARRAY10_NV */
-   { 38726, 0x0000865B }, /* GL_VERTEX_ATTRIB_ARRAY11_NV */
-   { 38754, 0x0000865C }, /* GL_VERTEX_ATTRIB_ARRAY12_NV */
-   { 38782, 0x0000865D }, /* GL_VERTEX_ATTRIB_ARRAY13_NV */
-   { 38810, 0x0000865E }, /* GL_VERTEX_ATTRIB_ARRAY14_NV */
-   { 38838, 0x0000865F }, /* GL_VERTEX_ATTRIB_ARRAY15_NV */
-   { 38866, 0x00008651 }, /* GL_VERTEX_ATTRIB_ARRAY1_NV */
-   { 38893, 0x00008652 }, /* GL_VERTEX_ATTRIB_ARRAY2_NV */
-   { 38920, 0x00008653 }, /* GL_VERTEX_ATTRIB_ARRAY3_NV */
-   { 38947, 0x00008654 }, /* GL_VERTEX_ATTRIB_ARRAY4_NV */
-   { 38974, 0x00008655 }, /* GL_VERTEX_ATTRIB_ARRAY5_NV */
-   { 39001, 0x00008656 }, /* GL_VERTEX_ATTRIB_ARRAY6_NV */
-   { 39028, 0x00008657 }, /* GL_VERTEX_ATTRIB_ARRAY7_NV */
-   { 39055, 0x00008658 }, /* GL_VERTEX_ATTRIB_ARRAY8_NV */
-   { 39082, 0x00008659 }, /* GL_VERTEX_ATTRIB_ARRAY9_NV */
-   { 39109, 0x0000889F }, /* GL_VERTEX_ATTRIB_ARRAY_BUFFER_BINDING */
-   { 39147, 0x0000889F }, /* GL_VERTEX_ATTRIB_ARRAY_BUFFER_BINDING_ARB */
-   { 39189, 0x00008622 }, /* GL_VERTEX_ATTRIB_ARRAY_ENABLED */
-   { 39220, 0x00008622 }, /* GL_VERTEX_ATTRIB_ARRAY_ENABLED_ARB */
-   { 39255, 0x0000886A }, /* GL_VERTEX_ATTRIB_ARRAY_NORMALIZED */
-   { 39289, 0x0000886A }, /* GL_VERTEX_ATTRIB_ARRAY_NORMALIZED_ARB */
-   { 39327, 0x00008645 }, /* GL_VERTEX_ATTRIB_ARRAY_POINTER */
-   { 39358, 0x00008645 }, /* GL_VERTEX_ATTRIB_ARRAY_POINTER_ARB */
-   { 39393, 0x00008623 }, /* GL_VERTEX_ATTRIB_ARRAY_SIZE */
-   { 39421, 0x00008623 }, /* GL_VERTEX_ATTRIB_ARRAY_SIZE_ARB */
-   { 39453, 0x00008624 }, /* GL_VERTEX_ATTRIB_ARRAY_STRIDE */
-   { 39483, 0x00008624 }, /* GL_VERTEX_ATTRIB_ARRAY_STRIDE_ARB */
-   { 39517, 0x00008625 }, /* GL_VERTEX_ATTRIB_ARRAY_TYPE */
-   { 39545, 0x00008625 }, /* GL_VERTEX_ATTRIB_ARRAY_TYPE_ARB */
-   { 39577, 0x000086A7 }, /* GL_VERTEX_BLEND_ARB */
-   { 39597, 0x00008620 }, /* GL_VERTEX_PROGRAM_ARB */
-   { 39619, 0x0000864A }, /* GL_VERTEX_PROGRAM_BINDING_NV */
-   { 39648, 0x00008620 }, /* GL_VERTEX_PROGRAM_NV */
-   { 39669, 0x00008642 }, /* GL_VERTEX_PROGRAM_POINT_SIZE */
-   { 39698, 0x00008642 }, /* GL_VERTEX_PROGRAM_POINT_SIZE_ARB */
-   { 39731, 0x00008642 }, /* GL_VERTEX_PROGRAM_POINT_SIZE_NV */
-   { 39763, 0x00008643 }, /* GL_VERTEX_PROGRAM_TWO_SIDE */
-   { 39790, 0x00008643 }, /* GL_VERTEX_PROGRAM_TWO_SIDE_ARB */
-   { 39821, 0x00008643 }, /* GL_VERTEX_PROGRAM_TWO_SIDE_NV */
-   { 39851, 0x00008B31 }, /* GL_VERTEX_SHADER */
-   { 39868, 0x00008B31 }, /* GL_VERTEX_SHADER_ARB */
-   { 39889, 0x00008621 }, /* GL_VERTEX_STATE_PROGRAM_NV */
-   { 39916, 0x00000BA2 }, /* GL_VIEWPORT */
-   { 39928, 0x00000800 }, /* GL_VIEWPORT_BIT */
-   { 39944, 0x0000911D }, /* GL_WAIT_FAILED */
-   { 39959, 0x000086AD }, /* GL_WEIGHT_ARRAY_ARB */
-   { 39979, 0x0000889E }, /* GL_WEIGHT_ARRAY_BUFFER_BINDING */
-   { 40010, 0x0000889E }, /* GL_WEIGHT_ARRAY_BUFFER_BINDING_ARB */
-   { 40045, 0x000086AC }, /* GL_WEIGHT_ARRAY_POINTER_ARB */
-   { 40073, 0x000086AB }, /* GL_WEIGHT_ARRAY_SIZE_ARB */
-   { 40098, 0x000086AA }, /* GL_WEIGHT_ARRAY_STRIDE_ARB */
-   { 40125, 0x000086A9 }, /* GL_WEIGHT_ARRAY_TYPE_ARB */
-   { 40150, 0x000086A6 }, /* GL_WEIGHT_SUM_UNITY_ARB */
-   { 40174, 0x000081D4 }, /* GL_WRAP_BORDER_SUN */
-   { 40193, 0x000088B9 }, /* GL_WRITE_ONLY */
-   { 40207, 0x000088B9 }, /* GL_WRITE_ONLY_ARB */
-   { 40225, 0x00001506 }, /* GL_XOR */
-   { 40232, 0x000085B9 }, /* GL_YCBCR_422_APPLE */
-   { 40251, 0x00008757 }, /* GL_YCBCR_MESA */
-   { 40265, 0x00000000 }, /* GL_ZERO */
-   { 40273, 0x00000D16 }, /* GL_ZOOM_X */
-   { 40283, 0x00000D17 }, /* GL_ZOOM_Y */
+   { 28098, 0x00008E16 }, /* GL_QUERY_BY_REGION_NO_WAIT_NV */
+   { 28128, 0x00008E15 }, /* GL_QUERY_BY_REGION_WAIT_NV */
+   { 28155, 0x00008864 }, /* GL_QUERY_COUNTER_BITS */
+   { 28177, 0x00008864 }, /* GL_QUERY_COUNTER_BITS_ARB */
+   { 28203, 0x00008E14 }, /* GL_QUERY_NO_WAIT_NV */
+   { 28223, 0x00008866 }, /* GL_QUERY_RESULT */
+   { 28239, 0x00008866 }, /* GL_QUERY_RESULT_ARB */
+   { 28259, 0x00008867 }, /* GL_QUERY_RESULT_AVAILABLE */
+   { 28285, 0x00008867 }, /* GL_QUERY_RESULT_AVAILABLE_ARB */
+   { 28315, 0x00008E13 }, /* GL_QUERY_WAIT_NV */
+   { 28332, 0x00002002 }, /* GL_R */
+   { 28337, 0x00002A10 }, /* GL_R3_G3_B2 */
+   { 28349, 0x00019262 }, /* GL_RASTER_POSITION_UNCLIPPED_IBM */
+   { 28382, 0x00000C02 }, /* GL_READ_BUFFER */
+   { 28397, 0x00008CA8 }, /* GL_READ_FRAMEBUFFER */
+   { 28417, 0x00008CAA }, /* GL_READ_FRAMEBUFFER_BINDING_EXT */
+   { 28449, 0x00008CA8 }, /* GL_READ_FRAMEBUFFER_EXT */
+   { 28473, 0x000088B8 }, /* GL_READ_ONLY */
+   { 28486, 0x000088B8 }, /* GL_READ_ONLY_ARB */
+   { 28503, 0x000088BA }, /* GL_READ_WRITE */
+   { 28517, 0x000088BA }, /* GL_READ_WRITE_ARB */
+   { 28535, 0x00001903 }, /* GL_RED */
+   { 28542, 0x00008016 }, /* GL_REDUCE */
+   { 28552, 0x00008016 }, /* GL_REDUCE_EXT */
+   { 28566, 0x00000D15 }, /* GL_RED_BIAS */
+   { 28578, 0x00000D52 }, /* GL_RED_BITS */
+   { 28590, 0x00000D14 }, /* GL_RED_SCALE */
+   { 28603, 0x00008512 }, /* GL_REFLECTION_MAP */
+   { 28621, 0x00008512 }, /* GL_REFLECTION_MAP_ARB */
+   { 28643, 0x00008512 }, /* GL_REFLECTION_MAP_NV */
+   { 28664, 0x00001C00 }, /* GL_RENDER */
+   { 28674, 0x00008D41 }, /* GL_RENDERBUFFER */
+   { 28690, 0x00008D53 }, /* GL_RENDERBUFFER_ALPHA_SIZE */
+   { 28717, 0x00008CA7 }, /* GL_RENDERBUFFER_BINDING_EXT */
+   { 28745, 0x00008D52 }, /* GL_RENDERBUFFER_BLUE_SIZE */
+   { 28771, 0x00008D54 }, /* GL_RENDERBUFFER_DEPTH_SIZE */
+   { 28798, 0x00008D41 }, /* GL_RENDERBUFFER_EXT */
+   { 28818, 0x00008D51 }, /* GL_RENDERBUFFER_GREEN_SIZE */
+   { 28845, 0x00008D43 }, /* GL_RENDERBUFFER_HEIGHT */
+   { 28868, 0x00008D43 }, /* GL_RENDERBUFFER_HEIGHT_EXT */
+   { 28895, 0x00008D44 }, /* GL_RENDERBUFFER_INTERNAL_FORMAT */
+   { 28927, 0x00008D44 }, /* GL_RENDERBUFFER_INTERNAL_FORMAT_EXT */
+   { 28963, 0x00008D50 }, /* GL_RENDERBUFFER_RED_SIZE */
+   { 28988, 0x00008CAB }, /* GL_RENDERBUFFER_SAMPLES */
+   { 29012, 0x00008D55 }, /* GL_RENDERBUFFER_STENCIL_SIZE */
+   { 29041, 0x00008D42 }, /* GL_RENDERBUFFER_WIDTH */
+   { 29063, 0x00008D42 }, /* GL_RENDERBUFFER_WIDTH_EXT */
+   { 29089, 0x00001F01 }, /* GL_RENDERER */
+   { 29101, 0x00000C40 }, /* GL_RENDER_MODE */
+   { 29116, 0x00002901 }, /* GL_REPEAT */
+   { 29126, 0x00001E01 }, /* GL_REPLACE */
+   { 29137, 0x00008062 }, /* GL_REPLACE_EXT */
+   { 29152, 0x00008153 }, /* GL_REPLICATE_BORDER_HP */
+   { 29175, 0x0000803A }, /* GL_RESCALE_NORMAL */
+   { 29193, 0x0000803A }, /* GL_RESCALE_NORMAL_EXT */
+   { 29215, 0x00000102 }, /* GL_RETURN */
+   { 29225, 0x00001907 }, /* GL_RGB */
+   { 29232, 0x00008052 }, /* GL_RGB10 */
+   { 29241, 0x00008059 }, /* GL_RGB10_A2 */
+   { 29253, 0x00008059 }, /* GL_RGB10_A2_EXT */
+   { 29269, 0x00008052 }, /* GL_RGB10_EXT */
+   { 29282, 0x00008053 }, /* GL_RGB12 */
+   { 29291, 0x00008053 }, /* GL_RGB12_EXT */
+   { 29304, 0x00008054 }, /* GL_RGB16 */
+   { 29313, 0x00008054 }, /* GL_RGB16_EXT */
+   { 29326, 0x0000804E }, /* GL_RGB2_EXT */
+   { 29338, 0x0000804F }, /* GL_RGB4 */
+   { 29346, 0x0000804F }, /* GL_RGB4_EXT */
+   { 29358, 0x000083A1 }, /* GL_RGB4_S3TC */
+   { 29371, 0x00008050 }, /* GL_RGB5 */
+   { 29379, 0x00008057 }, /* GL_RGB5_A1 */
+   { 29390, 0x00008057 }, /* GL_RGB5_A1_EXT */
+   { 29405, 0x00008050 }, /* GL_RGB5_EXT */
+   { 29417, 0x00008051 }, /* GL_RGB8 */
+   { 29425, 0x00008051 }, /* GL_RGB8_EXT */
+   { 29437, 0x00001908 }, /* GL_RGBA */
+   { 29445, 0x0000805A }, /* GL_RGBA12 */
+   { 29455, 0x0000805A }, /* GL_RGBA12_EXT */
+   { 29469, 0x0000805B }, /* GL_RGBA16 */
+   { 29479, 0x0000805B }, /* GL_RGBA16_EXT */
+   { 29493, 0x00008055 }, /* GL_RGBA2 */
+   { 29502, 0x00008055 }, /* GL_RGBA2_EXT */
+   { 29515, 0x00008056 }, /* GL_RGBA4 */
+   { 29524, 0x000083A5 }, /* GL_RGBA4_DXT5_S3TC */
+   { 29543, 0x00008056 }, /* GL_RGBA4_EXT */
+   { 29556, 0x000083A3 }, /* GL_RGBA4_S3TC */
+   { 29570, 0x00008058 }, /* GL_RGBA8 */
+   { 29579, 0x00008058 }, /* GL_RGBA8_EXT */
+   { 29592, 0x00008F97 }, /* GL_RGBA8_SNORM */
+   { 29607, 0x000083A4 }, /* GL_RGBA_DXT5_S3TC */
+   { 29625, 0x00000C31 }, /* GL_RGBA_MODE */
+   { 29638, 0x000083A2 }, /* GL_RGBA_S3TC */
+   { 29651, 0x00008F93 }, /* GL_RGBA_SNORM */
+   { 29665, 0x000083A0 }, /* GL_RGB_S3TC */
+   { 29677, 0x00008573 }, /* GL_RGB_SCALE */
+   { 29690, 0x00008573 }, /* GL_RGB_SCALE_ARB */
+   { 29707, 0x00008573 }, /* GL_RGB_SCALE_EXT */
+   { 29724, 0x00000407 }, /* GL_RIGHT */
+   { 29733, 0x00002000 }, /* GL_S */
+   { 29738, 0x00008B5D }, /* GL_SAMPLER_1D */
+   { 29752, 0x00008B61 }, /* GL_SAMPLER_1D_SHADOW */
+   { 29773, 0x00008B5E }, /* GL_SAMPLER_2D */
+   { 29787, 0x00008B62 }, /* GL_SAMPLER_2D_SHADOW */
+   { 29808, 0x00008B5F }, /* GL_SAMPLER_3D */
+   { 29822, 0x00008B60 }, /* GL_SAMPLER_CUBE */
+   { 29838, 0x000080A9 }, /* GL_SAMPLES */
+   { 29849, 0x000086B4 }, /* GL_SAMPLES_3DFX */
+   { 29865, 0x000080A9 }, /* GL_SAMPLES_ARB */
+   { 29880, 0x00008914 }, /* GL_SAMPLES_PASSED */
+   { 29898, 0x00008914 }, /* GL_SAMPLES_PASSED_ARB */
+   { 29920, 0x0000809E }, /* GL_SAMPLE_ALPHA_TO_COVERAGE */
+   { 29948, 0x0000809E }, /* GL_SAMPLE_ALPHA_TO_COVERAGE_ARB */
+   { 29980, 0x0000809F }, /* GL_SAMPLE_ALPHA_TO_ONE */
+   { 30003, 0x0000809F }, /* GL_SAMPLE_ALPHA_TO_ONE_ARB */
+   { 30030, 0x000080A8 }, /* GL_SAMPLE_BUFFERS */
+   { 30048, 0x000086B3 }, /* GL_SAMPLE_BUFFERS_3DFX */
+   { 30071, 0x000080A8 }, /* GL_SAMPLE_BUFFERS_ARB */
+   { 30093, 0x000080A0 }, /* GL_SAMPLE_COVERAGE */
+   { 30112, 0x000080A0 }, /* GL_SAMPLE_COVERAGE_ARB */
+   { 30135, 0x000080AB }, /* GL_SAMPLE_COVERAGE_INVERT */
+   { 30161, 0x000080AB }, /* GL_SAMPLE_COVERAGE_INVERT_ARB */
+   { 30191, 0x000080AA }, /* GL_SAMPLE_COVERAGE_VALUE */
+   { 30216, 0x000080AA }, /* GL_SAMPLE_COVERAGE_VALUE_ARB */
+   { 30245, 0x00080000 }, /* GL_SCISSOR_BIT */
+   { 30260, 0x00000C10 }, /* GL_SCISSOR_BOX */
+   { 30275, 0x00000C11 }, /* GL_SCISSOR_TEST */
+   { 30291, 0x0000845E }, /* GL_SECONDARY_COLOR_ARRAY */
+   { 30316, 0x0000889C }, /* GL_SECONDARY_COLOR_ARRAY_BUFFER_BINDING */
+   { 30356, 0x0000889C }, /* GL_SECONDARY_COLOR_ARRAY_BUFFER_BINDING_ARB */
+   { 30400, 0x0000845D }, /* GL_SECONDARY_COLOR_ARRAY_POINTER */
+   { 30433, 0x0000845A }, /* GL_SECONDARY_COLOR_ARRAY_SIZE */
+   { 30463, 0x0000845C }, /* GL_SECONDARY_COLOR_ARRAY_STRIDE */
+   { 30495, 0x0000845B }, /* GL_SECONDARY_COLOR_ARRAY_TYPE */
+   { 30525, 0x00001C02 }, /* GL_SELECT */
+   { 30535, 0x00000DF3 }, /* GL_SELECTION_BUFFER_POINTER */
+   { 30563, 0x00000DF4 }, /* GL_SELECTION_BUFFER_SIZE */
+   { 30588, 0x00008012 }, /* GL_SEPARABLE_2D */
+   { 30604, 0x000081FA }, /* GL_SEPARATE_SPECULAR_COLOR */
+   { 30631, 0x000081FA }, /* GL_SEPARATE_SPECULAR_COLOR_EXT */
+   { 30662, 0x0000150F }, /* GL_SET */
+   { 30669, 0x00008B48 }, /* GL_SHADER_OBJECT_ARB */
+   { 30690, 0x00008B88 }, /* GL_SHADER_SOURCE_LENGTH */
+   { 30714, 0x00008B4F }, /* GL_SHADER_TYPE */
+   { 30729, 0x00000B54 }, /* GL_SHADE_MODEL */
+   { 30744, 0x00008B8C }, /* GL_SHADING_LANGUAGE_VERSION */
+   { 30772, 0x000080BF }, /* GL_SHADOW_AMBIENT_SGIX */
+   { 30795, 0x000081FB }, /* GL_SHARED_TEXTURE_PALETTE_EXT */
+   { 30825, 0x00001601 }, /* GL_SHININESS */
+   { 30838, 0x00001402 }, /* GL_SHORT */
+   { 30847, 0x00009119 }, /* GL_SIGNALED */
+   { 30859, 0x00008F9C }, /* GL_SIGNED_NORMALIZED */
+   { 30880, 0x000081F9 }, /* GL_SINGLE_COLOR */
+   { 30896, 0x000081F9 }, /* GL_SINGLE_COLOR_EXT */
+   { 30916, 0x000085CC }, /* GL_SLICE_ACCUM_SUN */
+   { 30935, 0x00008C46 }, /* GL_SLUMINANCE */
+   { 30949, 0x00008C47 }, /* GL_SLUMINANCE8 */
+   { 30964, 0x00008C45 }, /* GL_SLUMINANCE8_ALPHA8 */
+   { 30986, 0x00008C44 }, /* GL_SLUMINANCE_ALPHA */
+   { 31006, 0x00001D01 }, /* GL_SMOOTH */
+   { 31016, 0x00000B23 }, /* GL_SMOOTH_LINE_WIDTH_GRANULARITY */
+   { 31049, 0x00000B22 }, /* GL_SMOOTH_LINE_WIDTH_RANGE */
+   { 31076, 0x00000B13 }, /* GL_SMOOTH_POINT_SIZE_GRANULARITY */
+   { 31109, 0x00000B12 }, /* GL_SMOOTH_POINT_SIZE_RANGE */
+   { 31136, 0x00008588 }, /* GL_SOURCE0_ALPHA */
+   { 31153, 0x00008588 }, /* GL_SOURCE0_ALPHA_ARB */
+   { 31174, 0x00008588 }, /* GL_SOURCE0_ALPHA_EXT */
+   { 31195, 0x00008580 }, /* GL_SOURCE0_RGB */
+   { 31210, 0x00008580 }, /* GL_SOURCE0_RGB_ARB */
+   { 31229, 0x00008580 }, /* GL_SOURCE0_RGB_EXT */
+   { 31248, 0x00008589 }, /* GL_SOURCE1_ALPHA */
+   { 31265, 0x00008589 }, /* GL_SOURCE1_ALPHA_ARB */
+   { 31286, 0x00008589 }, /* GL_SOURCE1_ALPHA_EXT */
+   { 31307, 0x00008581 }, /* GL_SOURCE1_RGB */
+   { 31322, 0x00008581 }, /* GL_SOURCE1_RGB_ARB */
+   { 31341, 0x00008581 }, /* GL_SOURCE1_RGB_EXT */
+   { 31360, 0x0000858A }, /* GL_SOURCE2_ALPHA */
+   { 31377, 0x0000858A }, /* GL_SOURCE2_ALPHA_ARB */
+   { 31398, 0x0000858A }, /* GL_SOURCE2_ALPHA_EXT */
+   { 31419, 0x00008582 }, /* GL_SOURCE2_RGB */
+   { 31434, 0x00008582 }, /* GL_SOURCE2_RGB_ARB */
+   { 31453, 0x00008582 }, /* GL_SOURCE2_RGB_EXT */
+   { 31472, 0x0000858B }, /* GL_SOURCE3_ALPHA_NV */
+   { 31492, 0x00008583 }, /* GL_SOURCE3_RGB_NV */
+   { 31510, 0x00001202 }, /* GL_SPECULAR */
+   { 31522, 0x00002402 }, /* GL_SPHERE_MAP */
+   { 31536, 0x00001206 }, /* GL_SPOT_CUTOFF */
+   { 31551, 0x00001204 }, /* GL_SPOT_DIRECTION */
+   { 31569, 0x00001205 }, /* GL_SPOT_EXPONENT */
+   { 31586, 0x00008588 }, /* GL_SRC0_ALPHA */
+   { 31600, 0x00008580 }, /* GL_SRC0_RGB */
+   { 31612, 0x00008589 }, /* GL_SRC1_ALPHA */
+   { 31626, 0x00008581 }, /* GL_SRC1_RGB */
+   { 31638, 0x0000858A }, /* GL_SRC2_ALPHA */
+   { 31652, 0x00008582 }, /* GL_SRC2_RGB */
+   { 31664, 0x00000302 }, /* GL_SRC_ALPHA */
+   { 31677, 0x00000308 }, /* GL_SRC_ALPHA_SATURATE */
+   { 31699, 0x00000300 }, /* GL_SRC_COLOR */
+   { 31712, 0x00008C40 }, /* GL_SRGB */
+   { 31720, 0x00008C41 }, /* GL_SRGB8 */
+   { 31729, 0x00008C43 }, /* GL_SRGB8_ALPHA8 */
+   { 31745, 0x00008C42 }, /* GL_SRGB_ALPHA */
+   { 31759, 0x00000503 }, /* GL_STACK_OVERFLOW */
+   { 31777, 0x00000504 }, /* GL_STACK_UNDERFLOW */
+   { 31796, 0x000088E6 }, /* GL_STATIC_COPY */
+   { 31811, 0x000088E6 }, /* GL_STATIC_COPY_ARB */
+   { 31830, 0x000088E4 }, /* GL_STATIC_DRAW */
+   { 31845, 0x000088E4 }, /* GL_STATIC_DRAW_ARB */
+   { 31864, 0x000088E5 }, /* GL_STATIC_READ */
+   { 31879, 0x000088E5 }, /* GL_STATIC_READ_ARB */
+   { 31898, 0x00001802 }, /* GL_STENCIL */
+   { 31909, 0x00008D20 }, /* GL_STENCIL_ATTACHMENT */
+   { 31931, 0x00008D20 }, /* GL_STENCIL_ATTACHMENT_EXT */
+   { 31957, 0x00008801 }, /* GL_STENCIL_BACK_FAIL */
+   { 31978, 0x00008801 }, /* GL_STENCIL_BACK_FAIL_ATI */
+   { 32003, 0x00008800 }, /* GL_STENCIL_BACK_FUNC */
+   { 32024, 0x00008800 }, /* GL_STENCIL_BACK_FUNC_ATI */
+   { 32049, 0x00008802 }, /* GL_STENCIL_BACK_PASS_DEPTH_FAIL */
+   { 32081, 0x00008802 }, /* GL_STENCIL_BACK_PASS_DEPTH_FAIL_ATI */
+   { 32117, 0x00008803 }, /* GL_STENCIL_BACK_PASS_DEPTH_PASS */
+   { 32149, 0x00008803 }, /* GL_STENCIL_BACK_PASS_DEPTH_PASS_ATI */
+   { 32185, 0x00008CA3 }, /* GL_STENCIL_BACK_REF */
+   { 32205, 0x00008CA4 }, /* GL_STENCIL_BACK_VALUE_MASK */
+   { 32232, 0x00008CA5 }, /* GL_STENCIL_BACK_WRITEMASK */
+   { 32258, 0x00000D57 }, /* GL_STENCIL_BITS */
+   { 32274, 0x00000400 }, /* GL_STENCIL_BUFFER_BIT */
+   { 32296, 0x00000B91 }, /* GL_STENCIL_CLEAR_VALUE */
+   { 32319, 0x00000B94 }, /* GL_STENCIL_FAIL */
+   { 32335, 0x00000B92 }, /* GL_STENCIL_FUNC */
+   { 32351, 0x00001901 }, /* GL_STENCIL_INDEX */
+   { 32368, 0x00008D49 }, /* GL_STENCIL_INDEX16_EXT */
+   { 32391, 0x00008D46 }, /* GL_STENCIL_INDEX1_EXT */
+   { 32413, 0x00008D47 }, /* GL_STENCIL_INDEX4_EXT */
+   { 32435, 0x00008D48 }, /* GL_STENCIL_INDEX8_EXT */
+   { 32457, 0x00008D45 }, /* GL_STENCIL_INDEX_EXT */
+   { 32478, 0x00000B95 }, /* GL_STENCIL_PASS_DEPTH_FAIL */
+   { 32505, 0x00000B96 }, /* GL_STENCIL_PASS_DEPTH_PASS */
+   { 32532, 0x00000B97 }, /* GL_STENCIL_REF */
+   { 32547, 0x00000B90 }, /* GL_STENCIL_TEST */
+   { 32563, 0x00008910 }, /* GL_STENCIL_TEST_TWO_SIDE_EXT */
+   { 32592, 0x00000B93 }, /* GL_STENCIL_VALUE_MASK */
+   { 32614, 0x00000B98 }, /* GL_STENCIL_WRITEMASK */
+   { 32635, 0x00000C33 }, /* GL_STEREO */
+   { 32645, 0x000085BE }, /* GL_STORAGE_CACHED_APPLE */
+   { 32669, 0x000085BD }, /* GL_STORAGE_PRIVATE_APPLE */
+   { 32694, 0x000085BF }, /* GL_STORAGE_SHARED_APPLE */
+   { 32718, 0x000088E2 }, /* GL_STREAM_COPY */
+   { 32733, 0x000088E2 }, /* GL_STREAM_COPY_ARB */
+   { 32752, 0x000088E0 }, /* GL_STREAM_DRAW */
+   { 32767, 0x000088E0 }, /* GL_STREAM_DRAW_ARB */
+   { 32786, 0x000088E1 }, /* GL_STREAM_READ */
+   { 32801, 0x000088E1 }, /* GL_STREAM_READ_ARB */
+   { 32820, 0x00000D50 }, /* GL_SUBPIXEL_BITS */
+   { 32837, 0x000084E7 }, /* GL_SUBTRACT */
+   { 32849, 0x000084E7 }, /* GL_SUBTRACT_ARB */
+   { 32865, 0x00009113 }, /* GL_SYNC_CONDITION */
+   { 32883, 0x00009116 }, /* GL_SYNC_FENCE */
+   { 32897, 0x00009115 }, /* GL_SYNC_FLAGS */
+   { 32911, 0x00000001 }, /* GL_SYNC_FLUSH_COMMANDS_BIT */
+   { 32938, 0x00009117 }, /* GL_SYNC_GPU_COMMANDS_COMPLETE */
+   { 32968, 0x00009114 }, /* GL_SYNC_STATUS */
+   { 32983, 0x00002001 }, /* GL_T */
+   { 32988, 0x00002A2A }, /* GL_T2F_C3F_V3F */
+   { 33003, 0x00002A2C }, /* GL_T2F_C4F_N3F_V3F */
+   { 33022, 0x00002A29 }, /* GL_T2F_C4UB_V3F */
+   { 33038, 0x00002A2B }, /* GL_T2F_N3F_V3F */
+   { 33053, 0x00002A27 }, /* GL_T2F_V3F */
+   { 33064, 0x00002A2D }, /* GL_T4F_C4F_N3F_V4F */
+   { 33083, 0x00002A28 }, /* GL_T4F_V4F */
+   { 33094, 0x00008031 }, /* GL_TABLE_TOO_LARGE_EXT */
+   { 33117, 0x00001702 }, /* GL_TEXTURE */
+   { 33128, 0x000084C0 }, /* GL_TEXTURE0 */
+   { 33140, 0x000084C0 }, /* GL_TEXTURE0_ARB */
+   { 33156, 0x000084C1 }, /* GL_TEXTURE1 */
+   { 33168, 0x000084CA }, /* GL_TEXTURE10 */
+   { 33181, 0x000084CA }, /* GL_TEXTURE10_ARB */
+   { 33198, 0x000084CB }, /* GL_TEXTURE11 */
+   { 33211, 0x000084CB }, /* GL_TEXTURE11_ARB */
+   { 33228, 0x000084CC }, /* GL_TEXTURE12 */
+   { 33241, 0x000084CC }, /* GL_TEXTURE12_ARB */
+   { 33258, 0x000084CD }, /* GL_TEXTURE13 */
+   { 33271, 0x000084CD }, /* GL_TEXTURE13_ARB */
+   { 33288, 0x000084CE }, /* GL_TEXTURE14 */
+   { 33301, 0x000084CE }, /* GL_TEXTURE14_ARB */
+   { 33318, 0x000084CF }, /* GL_TEXTURE15 */
+   { 33331, 0x000084CF }, /* GL_TEXTURE15_ARB */
+   { 33348, 0x000084D0 }, /* GL_TEXTURE16 */
+   { 33361, 0x000084D0 }, /* GL_TEXTURE16_ARB */
+   { 33378, 0x000084D1 }, /* GL_TEXTURE17 */
+   { 33391, 0x000084D1 }, /* GL_TEXTURE17_ARB */
+   { 33408, 0x000084D2 }, /* GL_TEXTURE18 */
+   { 33421, 0x000084D2 }, /* GL_TEXTURE18_ARB */
+   { 33438, 0x000084D3 }, /* GL_TEXTURE19 */
+   { 33451, 0x000084D3 }, /* GL_TEXTURE19_ARB */
+   { 33468, 0x000084C1 }, /* GL_TEXTURE1_ARB */
+   { 33484, 0x000084C2 }, /* GL_TEXTURE2 */
+   { 33496, 0x000084D4 }, /* GL_TEXTURE20 */
+   { 33509, 0x000084D4 }, /* GL_TEXTURE20_ARB */
+   { 33526, 0x000084D5 }, /* GL_TEXTURE21 */
+   { 33539, 0x000084D5 }, /* GL_TEXTURE21_ARB */
+   { 33556, 0x000084D6 }, /* GL_TEXTURE22 */
+   { 33569, 0x000084D6 }, /* GL_TEXTURE22_ARB */
+   { 33586, 0x000084D7 }, /* GL_TEXTURE23 */
+   { 33599, 0x000084D7 }, /* GL_TEXTURE23_ARB */
+   { 33616, 0x000084D8 }, /* GL_TEXTURE24 */
+   { 33629, 0x000084D8 }, /* GL_TEXTURE24_ARB */
+   { 33646, 0x000084D9 }, /* GL_TEXTURE25 */
+   { 33659, 0x000084D9 }, /* GL_TEXTURE25_ARB */
+   { 33676, 0x000084DA }, /* GL_TEXTURE26 */
+   { 33689, 0x000084DA }, /* GL_TEXTURE26_ARB */
+   { 33706, 0x000084DB }, /* GL_TEXTURE27 */
+   { 33719, 0x000084DB }, /* GL_TEXTURE27_ARB */
+   { 33736, 0x000084DC }, /* GL_TEXTURE28 */
+   { 33749, 0x000084DC }, /* GL_TEXTURE28_ARB */
+   { 33766, 0x000084DD }, /* GL_TEXTURE29 */
+   { 33779, 0x000084DD }, /* GL_TEXTURE29_ARB */
+   { 33796, 0x000084C2 }, /* GL_TEXTURE2_ARB */
+   { 33812, 0x000084C3 }, /* GL_TEXTURE3 */
+   { 33824, 0x000084DE }, /* GL_TEXTURE30 */
+   { 33837, 0x000084DE }, /* GL_TEXTURE30_ARB */
+   { 33854, 0x000084DF }, /* GL_TEXTURE31 */
+   { 33867, 0x000084DF }, /* GL_TEXTURE31_ARB */
+   { 33884, 0x000084C3 }, /* GL_TEXTURE3_ARB */
+   { 33900, 0x000084C4 }, /* GL_TEXTURE4 */
+   { 33912, 0x000084C4 }, /* GL_TEXTURE4_ARB */
+   { 33928, 0x000084C5 }, /* GL_TEXTURE5 */
+   { 33940, 0x000084C5 }, /* GL_TEXTURE5_ARB */
+   { 33956, 0x000084C6 }, /* GL_TEXTURE6 */
+   { 33968, 0x000084C6 }, /* GL_TEXTURE6_ARB */
+   { 33984, 0x000084C7 }, /* GL_TEXTURE7 */
+   { 33996, 0x000084C7 }, /* GL_TEXTURE7_ARB */
+   { 34012, 0x000084C8 }, /* GL_TEXTURE8 */
+   { 34024, 0x000084C8 }, /* GL_TEXTURE8_ARB */
+   { 34040, 0x000084C9 }, /* GL_TEXTURE9 */
+   { 34052, 0x000084C9 }, /* GL_TEXTURE9_ARB */
+   { 34068, 0x00000DE0 }, /* GL_TEXTURE_1D */
+   { 34082, 0x00008C18 }, /* GL_TEXTURE_1D_ARRAY_EXT */
+   { 34106, 0x00000DE1 }, /* GL_TEXTURE_2D */
+   { 34120, 0x00008C1A }, /* GL_TEXTURE_2D_ARRAY_EXT */
+   { 34144, 0x0000806F }, /* GL_TEXTURE_3D */
+   { 34158, 0x0000805F }, /* GL_TEXTURE_ALPHA_SIZE */
+   { 34180, 0x0000805F }, /* GL_TEXTURE_ALPHA_SIZE_EXT */
+   { 34206, 0x0000813C }, /* GL_TEXTURE_BASE_LEVEL */
+   { 34228, 0x00008068 }, /* GL_TEXTURE_BINDING_1D */
+   { 34250, 0x00008C1C }, /* GL_TEXTURE_BINDING_1D_ARRAY_EXT */
+   { 34282, 0x00008069 }, /* GL_TEXTURE_BINDING_2D */
+   { 34304, 0x00008C1D }, /* GL_TEXTURE_BINDING_2D_ARRAY_EXT */
+   { 34336, 0x0000806A }, /* GL_TEXTURE_BINDING_3D */
+   { 34358, 0x00008514 }, /* GL_TEXTURE_BINDING_CUBE_MAP */
+   { 34386, 0x00008514 }, /* GL_TEXTURE_BINDING_CUBE_MAP_ARB */
+   { 34418, 0x000084F6 }, /* GL_TEXTURE_BINDING_RECTANGLE_ARB */
+   { 34451, 0x000084F6 }, /* GL_TEXTURE_BINDING_RECTANGLE_NV */
+   { 34483, 0x00040000 }, /* GL_TEXTURE_BIT */
+   { 34498, 0x0000805E }, /* GL_TEXTURE_BLUE_SIZE */
+   { 34519, 0x0000805E }, /* GL_TEXTURE_BLUE_SIZE_EXT */
+   { 34544, 0x00001005 }, /* GL_TEXTURE_BORDER */
+   { 34562, 0x00001004 }, /* GL_TEXTURE_BORDER_COLOR */
+   { 34586, 0x00008171 }, /* GL_TEXTURE_CLIPMAP_CENTER_SGIX */
+   { 34617, 0x00008176 }, /* GL_TEXTURE_CLIPMAP_DEPTH_SGIX */
+   { 34647, 0x00008172 }, /* GL_TEXTURE_CLIPMAP_FRAME_SGIX */
+   { 34677, 0x00008175 }, /* GL_TEXTURE_CLIPMAP_LOD_OFFSET_SGIX */
+   { 34712, 0x00008173 }, /* GL_TEXTURE_CLIPMAP_OFFSET_SGIX */
+   { 34743, 0x00008174 }, /* GL_TEXTURE_CLIPMAP_VIRTUAL_DEPTH_SGIX */
+   { 34781, 0x000080BC }, /* GL_TEXTURE_COLOR_TABLE_SGI */
+   { 34808, 0x000081EF }, /* GL_TEXTURE_COLOR_WRITEMASK_SGIS */
+   { 34840, 0x000080BF }, /* GL_TEXTURE_COMPARE_FAIL_VALUE_ARB */
+   { 34874, 0x0000884D }, /* GL_TEXTURE_COMPARE_FUNC */
+   { 34898, 0x0000884D }, /* GL_TEXTURE_COMPARE_FUNC_ARB */
+   { 34926, 0x0000884C }, /* GL_TEXTURE_COMPARE_MODE */
+   { 34950, 0x0000884C }, /* GL_TEXTURE_COMPARE_MODE_ARB */
+   { 34978, 0x0000819B }, /* GL_TEXTURE_COMPARE_OPERATOR_SGIX */
+   { 35011, 0x0000819A }, /* GL_TEXTURE_COMPARE_SGIX */
+   { 35035, 0x00001003 }, /* GL_TEXTURE_COMPONENTS */
+   { 35057, 0x000086A1 }, /* GL_TEXTURE_COMPRESSED */
+   { 35079, 0x000086A1 }, /* GL_TEXTURE_COMPRESSED_ARB */
+   { 35105, 0x000086A3 }, /* GL_TEXTURE_COMPRESSED_FORMATS_ARB */
+   { 35139, 0x000086A0 }, /* GL_TEXTURE_COMPRESSED_IMAGE_SIZE */
+   { 35172, 0x000086A0 }, /* GL_TEXTURE_COMPRESSED_IMAGE_SIZE_ARB */
+   { 35209, 0x000084EF }, /* GL_TEXTURE_COMPRESSION_HINT */
+   { 35237, 0x000084EF }, /* GL_TEXTURE_COMPRESSION_HINT_ARB */
+   { 35269, 0x00008078 }, /* GL_TEXTURE_COORD_ARRAY */
+   { 35292, 0x0000889A }, /* GL_TEXTURE_COORD_ARRAY_BUFFER_BINDING */
+   { 35330, 0x0000889A }, /* GL_TEXTURE_COORD_ARRAY_BUFFER_BINDING_ARB */
+   { 35372, 0x00008092 }, /* GL_TEXTURE_COORD_ARRAY_POINTER */
+   { 35403, 0x00008088 }, /* GL_TEXTURE_COORD_ARRAY_SIZE */
+   { 35431, 0x0000808A }, /* GL_TEXTURE_COORD_ARRAY_STRIDE */
+   { 35461, 0x00008089 }, /* GL_TEXTURE_COORD_ARRAY_TYPE */
+   { 35489, 0x00008513 }, /* GL_TEXTURE_CUBE_MAP */
+   { 35509, 0x00008513 }, /* GL_TEXTURE_CUBE_MAP_ARB */
+   { 35533, 0x00008516 }, /* GL_TEXTURE_CUBE_MAP_NEGATIVE_X */
+   { 35564, 0x00008516 }, /* GL_TEXTURE_CUBE_MAP_NEGATIVE_X_ARB */
+   { 35599, 0x00008518 }, /* GL_TEXTURE_CUBE_MAP_NEGATIVE_Y */
+   { 35630, 0x00008518 }, /* GL_TEXTURE_CUBE_MAP_NEGATIVE_Y_ARB */
+   { 35665, 0x0000851A }, /* GL_TEXTURE_CUBE_MAP_NEGATIVE_Z */
+   { 35696, 0x0000851A }, /* GL_TEXTURE_CUBE_MAP_NEGATIVE_Z_ARB */
+   { 35731, 0x00008515 }, /* GL_TEXTURE_CUBE_MAP_POSITIVE_X */
+   { 35762, 0x00008515 }, /* GL_TEXTURE_CUBE_MAP_POSITIVE_X_ARB */
+   { 35797, 0x00008517 }, /* GL_TEXTURE_CUBE_MAP_POSITIVE_Y */
+   { 35828, 0x00008517 }, /* GL_TEXTURE_CUBE_MAP_POSITIVE_Y_ARB */
+   { 35863, 0x00008519 }, /* GL_TEXTURE_CUBE_MAP_POSITIVE_Z */
+   { 35894, 0x00008519 }, /* GL_TEXTURE_CUBE_MAP_POSITIVE_Z_ARB */
+   { 35929, 0x000088F4 }, /* GL_TEXTURE_CUBE_MAP_SEAMLESS */
+   { 35958, 0x00008071 }, /* GL_TEXTURE_DEPTH */
+   { 35975, 0x0000884A }, /* GL_TEXTURE_DEPTH_SIZE */
+   { 35997, 0x0000884A }, /* GL_TEXTURE_DEPTH_SIZE_ARB */
+   { 36023, 0x00002300 }, /* GL_TEXTURE_ENV */
+   { 36038, 0x00002201 }, /* GL_TEXTURE_ENV_COLOR */
+   { 36059, 0x00002200 }, /* GL_TEXTURE_ENV_MODE */
+   { 36079, 0x00008500 }, /* GL_TEXTURE_FILTER_CONTROL */
+   { 36105, 0x00002500 }, /* GL_TEXTURE_GEN_MODE */
+   { 36125, 0x00000C63 }, /* GL_TEXTURE_GEN_Q */
+   { 36142, 0x00000C62 }, /* GL_TEXTURE_GEN_R */
+   { 36159, 0x00000C60 }, /* GL_TEXTURE_GEN_S */
+   { 36176, 0x00000C61 }, /* GL_TEXTURE_GEN_T */
+   { 36193, 0x0000819D }, /* GL_TEXTURE_GEQUAL_R_SGIX */
+   { 36218, 0x0000805D }, /* GL_TEXTURE_GREEN_SIZE */
+   { 36240, 0x0000805D }, /* GL_TEXTURE_GREEN_SIZE_EXT */
+   { 36266, 0x00001001 }, /* GL_TEXTURE_HEIGHT */
+   { 36284, 0x000080ED }, /* GL_TEXTURE_INDEX_SIZE_EXT */
+   { 36310, 0x00008061 }, /* GL_TEXTURE_INTENSITY_SIZE */
+   { 36336, 0x00008061 }, /* GL_TEXTURE_INTENSITY_SIZE_EXT */
+   { 36366, 0x00001003 }, /* GL_TEXTURE_INTERNAL_FORMAT */
+   { 36393, 0x0000819C }, /* GL_TEXTURE_LEQUAL_R_SGIX */
+   { 36418, 0x00008501 }, /* GL_TEXTURE_LOD_BIAS */
+   { 36438, 0x00008501 }, /* GL_TEXTURE_LOD_BIAS_EXT */
+   { 36462, 0x00008190 }, /* GL_TEXTURE_LOD_BIAS_R_SGIX */
+   { 36489, 0x0000818E }, /* GL_TEXTURE_LOD_BIAS_S_SGIX */
+   { 36516, 0x0000818F }, /* GL_TEXTURE_LOD_BIAS_T_SGIX */
+   { 36543, 0x00008060 }, /* GL_TEXTURE_LUMINANCE_SIZE */
+   { 36569, 0x00008060 }, /* GL_TEXTURE_LUMINANCE_SIZE_EXT */
+   { 36599, 0x00002800 }, /* GL_TEXTURE_MAG_FILTER */
+   { 36621, 0x00000BA8 }, /* GL_TEXTURE_MATRIX */
+   { 36639, 0x000084FE }, /* GL_TEXTURE_MAX_ANISOTROPY_EXT */
+   { 36669, 0x0000836B }, /* GL_TEXTURE_MAX_CLAMP_R_SGIX */
+   { 36697, 0x00008369 }, /* GL_TEXTURE_MAX_CLAMP_S_SGIX */
+   { 36725, 0x0000836A }, /* GL_TEXTURE_MAX_CLAMP_T_SGIX */
+   { 36753, 0x0000813D }, /* GL_TEXTURE_MAX_LEVEL */
+   { 36774, 0x0000813B }, /* GL_TEXTURE_MAX_LOD */
+   { 36793, 0x00002801 }, /* GL_TEXTURE_MIN_FILTER */
+   { 36815, 0x0000813A }, /* GL_TEXTURE_MIN_LOD */
+   { 36834, 0x00008066 }, /* GL_TEXTURE_PRIORITY */
+   { 36854, 0x000085B7 }, /* GL_TEXTURE_RANGE_LENGTH_APPLE */
+   { 36884, 0x000085B8 }, /* GL_TEXTURE_RANGE_POINTER_APPLE */
+   { 36915, 0x000084F5 }, /* GL_TEXTURE_RECTANGLE_ARB */
+   { 36940, 0x000084F5 }, /* GL_TEXTURE_RECTANGLE_NV */
+   { 36964, 0x0000805C }, /* GL_TEXTURE_RED_SIZE */
+   { 36984, 0x0000805C }, /* GL_TEXTURE_RED_SIZE_EXT */
+   { 37008, 0x00008067 }, /* GL_TEXTURE_RESIDENT */
+   { 37028, 0x00000BA5 }, /* GL_TEXTURE_STACK_DEPTH */
+   { 37051, 0x000088F1 }, /* GL_TEXTURE_STENCIL_SIZE */
+   { 37075, 0x000085BC }, /* GL_TEXTURE_STORAGE_HINT_APPLE */
+   { 37105, 0x00008065 }, /* GL_TEXTURE_TOO_LARGE_EXT */
+   { 37130, 0x0000888F }, /* GL_TEXTURE_UNSIGNED_REMAP_MODE_NV */
+   { 37164, 0x00001000 }, /* GL_TEXTURE_WIDTH */
+   { 37181, 0x00008072 }, /* GL_TEXTURE_WRAP_R */
+   { 37199, 0x00002802 }, /* GL_TEXTURE_WRAP_S */
+   { 37217, 0x00002803 }, /* GL_TEXTURE_WRAP_T */
+   { 37235, 0x0000911B }, /* GL_TIMEOUT_EXPIRED */
+   { 37254, 0xFFFFFFFFFFFFFFFF }, /* GL_TIMEOUT_IGNORED */
+   { 37273, 0x000088BF }, /* GL_TIME_ELAPSED_EXT */
+   { 37293, 0x00008648 }, /* GL_TRACK_MATRIX_NV */
+   { 37312, 0x00008649 }, /* GL_TRACK_MATRIX_TRANSFORM_NV */
+   { 37341, 0x00001000 }, /* GL_TRANSFORM_BIT */
+   { 37358, 0x000084E6 }, /* GL_TRANSPOSE_COLOR_MATRIX */
+   { 37384, 0x000084E6 }, /* GL_TRANSPOSE_COLOR_MATRIX_ARB */
+   { 37414, 0x000088B7 }, /* GL_TRANSPOSE_CURRENT_MATRIX_ARB */
+   { 37446, 0x000084E3 }, /* GL_TRANSPOSE_MODELVIEW_MATRIX */
+   { 37476, 0x000084E3 }, /* GL_TRANSPOSE_MODELVIEW_MATRIX_ARB */
+   { 37510, 0x0000862C }, /* GL_TRANSPOSE_NV */
+   { 37526, 0x000084E4 }, /* GL_TRANSPOSE_PROJECTION_MATRIX */
+   { 37557, 0x000084E4 }, /* GL_TRANSPOSE_PROJECTION_MATRIX_ARB */
+   { 37592, 0x000084E5 }, /* GL_TRANSPOSE_TEXTURE_MATRIX */
+   { 37620, 0x000084E5 }, /* GL_TRANSPOSE_TEXTURE_MATRIX_ARB */
+   { 37652, 0x00000004 }, /* GL_TRIANGLES */
+   { 37665, 0x00000006 }, /* GL_TRIANGLE_FAN */
+   { 37681, 0x00008615 }, /* GL_TRIANGLE_MESH_SUN */
+   { 37702, 0x00000005 }, /* GL_TRIANGLE_STRIP */
+   { 37720, 0x00000001 }, /* GL_TRUE */
+   { 37728, 0x00000CF5 }, /* GL_UNPACK_ALIGNMENT */
+   { 37748, 0x0000806E }, /* GL_UNPACK_IMAGE_HEIGHT */
+   { 37771, 0x00000CF1 }, /* GL_UNPACK_LSB_FIRST */
+   { 37791, 0x00000CF2 }, /* GL_UNPACK_ROW_LENGTH */
+   { 37812, 0x0000806D }, /* GL_UNPACK_SKIP_IMAGES */
+   { 37834, 0x00000CF4 }, /* GL_UNPACK_SKIP_PIXELS */
+   { 37856, 0x00000CF3 }, /* GL_UNPACK_SKIP_ROWS */
+   { 37876, 0x00000CF0 }, /* GL_UNPACK_SWAP_BYTES */
+   { 37897, 0x00009118 }, /* GL_UNSIGNALED */
+   { 37911, 0x00001401 }, /* GL_UNSIGNED_BYTE */
+   { 37928, 0x00008362 }, /* GL_UNSIGNED_BYTE_2_3_3_REV */
+   { 37955, 0x00008032 }, /* GL_UNSIGNED_BYTE_3_3_2 */
+   { 37978, 0x00001405 }, /* GL_UNSIGNED_INT */
+   { 37994, 0x00008036 }, /* GL_UNSIGNED_INT_10_10_10_2 */
+   { 38021, 0x000084FA }, /* GL_UNSIGNED_INT_24_8 */
+   { 38042, 0x000084FA }, /* GL_UNSIGNED_INT_24_8_NV */
+   { 38066, 0x00008368 }, /* GL_UNSIGNED_INT_2_10_10_10_REV */
+   { 38097, 0x00008035 }, /* GL_UNSIGNED_INT_8_8_8_8 */
+   { 38121, 0x00008367 }, /* GL_UNSIGNED_INT_8_8_8_8_REV */
+   { 38149, 0x00008C17 }, /* GL_UNSIGNED_NORMALIZED */
+   { 38172, 0x00001403 }, /* GL_UNSIGNED_SHORT */
+   { 38190, 0x00008366 }, /* GL_UNSIGNED_SHORT_1_5_5_5_REV */
+   { 38220, 0x00008033 }, /* GL_UNSIGNED_SHORT_4_4_4_4 */
+   { 38246, 0x00008365 }, /* GL_UNSIGNED_SHORT_4_4_4_4_REV */
+   { 38276, 0x00008034 }, /* GL_UNSIGNED_SHORT_5_5_5_1 */
+   { 38302, 0x00008363 }, /* GL_UNSIGNED_SHORT_5_6_5 */
+   { 38326, 0x00008364 }, /* GL_UNSIGNED_SHORT_5_6_5_REV */
+   { 38354, 0x000085BA }, /* GL_UNSIGNED_SHORT_8_8_APPLE */
+   { 38382, 0x000085BA }, /* GL_UNSIGNED_SHORT_8_8_MESA */
+   { 38409, 0x000085BB }, /* GL_UNSIGNED_SHORT_8_8_REV_APPLE */
+   { 38441, 0x000085BB }, /* GL_UNSIGNED_SHORT_8_8_REV_MESA */
+   { 38472, 0x00008CA2 }, /* GL_UPPER_LEFT */
+   { 38486, 0x00002A20 }, /* GL_V2F */
+   { 38493, 0x00002A21 }, /* GL_V3F */
+   { 38500, 0x00008B83 }, /* GL_VALIDATE_STATUS */
+   { 38519, 0x00001F00 }, /* GL_VENDOR */
+   { 38529, 0x00001F02 }, /* GL_VERSION */
+   { 38540, 0x00008074 }, /* GL_VERTEX_ARRAY */
+   { 38556, 0x000085B5 }, /* GL_VERTEX_ARRAY_BINDING */
+   { 38580, 0x000085B5 }, /* GL_VERTEX_ARRAY_BINDING_APPLE */
+   { 38610, 0x00008896 }, /* GL_VERTEX_ARRAY_BUFFER_BINDING */
+   { 38641, 0x00008896 }, /* GL_VERTEX_ARRAY_BUFFER_BINDING_ARB */
+   { 38676, 0x0000808E }, /* GL_VERTEX_ARRAY_POINTER */
+   { 38700, 0x0000807A }, /* GL_VERTEX_ARRAY_SIZE */
+   { 38721, 0x0000807C }, /* GL_VERTEX_ARRAY_STRIDE */
+   { 38744, 0x0000807B }, /* GL_VERTEX_ARRAY_TYPE */
+   { 38765, 0x00008650 }, /* GL_VERTEX_ATTRIB_ARRAY0_NV */
+   { 38792, 0x0000865A }, /* GL_VERTEX_ATTRIB_ARRAY10_NV */
+   { 38820, 0x0000865B }, /* GL_VERTEX_ATTRIB_ARRAY11_NV */
+   { 38848, 0x0000865C }, /* GL_VERTEX_ATTRIB_ARRAY12_NV */
+   { 38876, 0x0000865D }, /* GL_VERTEX_ATTRIB_ARRAY13_NV */
+   { 38904, 0x0000865E }, /* GL_VERTEX_ATTRIB_ARRAY14_NV */
+   { 38932, 0x0000865F }, /* GL_VERTEX_ATTRIB_ARRAY15_NV */
+   { 38960, 0x00008651 }, /* GL_VERTEX_ATTRIB_ARRAY1_NV */
+   { 38987, 0x00008652 }, /* GL_VERTEX_ATTRIB_ARRAY2_NV */
+   { 39014, 0x00008653 }, /* GL_VERTEX_ATTRIB_ARRAY3_NV */
+   { 39041, 0x00008654 }, /* GL_VERTEX_ATTRIB_ARRAY4_NV */
+   { 39068, 0x00008655 }, /* GL_VERTEX_ATTRIB_ARRAY5_NV */
+   { 39095, 0x00008656 }, /* GL_VERTEX_ATTRIB_ARRAY6_NV */
+   { 39122, 0x00008657 }, /* GL_VERTEX_ATTRIB_ARRAY7_NV */
+   { 39149, 0x00008658 }, /* GL_VERTEX_ATTRIB_ARRAY8_NV */
+   { 39176, 0x00008659 }, /* GL_VERTEX_ATTRIB_ARRAY9_NV */
+   { 39203, 0x0000889F }, /* GL_VERTEX_ATTRIB_ARRAY_BUFFER_BINDING */
+   { 39241, 0x0000889F }, /* GL_VERTEX_ATTRIB_ARRAY_BUFFER_BINDING_ARB */
+   { 39283, 0x00008622 }, /* GL_VERTEX_ATTRIB_ARRAY_ENABLED */
+   { 39314, 0x00008622 }, /* GL_VERTEX_ATTRIB_ARRAY_ENABLED_ARB */
+   { 39349, 0x0000886A }, /* GL_VERTEX_ATTRIB_ARRAY_NORMALIZED */
+   { 39383, 0x0000886A }, /* GL_VERTEX_ATTRIB_ARRAY_NORMALIZED_ARB */
+   { 39421, 0x00008645 }, /* GL_VERTEX_ATTRIB_ARRAY_POINTER */
+   { 39452, 0x00008645 }, /* GL_VERTEX_ATTRIB_ARRAY_POINTER_ARB */
+   { 39487, 0x00008623 }, /* GL_VERTEX_ATTRIB_ARRAY_SIZE */
+   { 39515, 0x00008623 }, /* GL_VERTEX_ATTRIB_ARRAY_SIZE_ARB */
+   { 39547, 0x00008624 }, /* GL_VERTEX_ATTRIB_ARRAY_STRIDE */
+   { 39577, 0x00008624 }, /* GL_VERTEX_ATTRIB_ARRAY_STRIDE_ARB */
+   { 39611, 0x00008625 }, /* GL_VERTEX_ATTRIB_ARRAY_TYPE */
+   { 39639, 0x00008625 }, /* GL_VERTEX_ATTRIB_ARRAY_TYPE_ARB */
+   { 39671, 0x000086A7 }, /* GL_VERTEX_BLEND_ARB */
+   { 39691, 0x00008620 }, /* GL_VERTEX_PROGRAM_ARB */
+   { 39713, 0x0000864A }, /* GL_VERTEX_PROGRAM_BINDING_NV */
+   { 39742, 0x00008620 }, /* GL_VERTEX_PROGRAM_NV */
+   { 39763, 0x00008642 }, /* GL_VERTEX_PROGRAM_POINT_SIZE */
+   { 39792, 0x00008642 }, /* GL_VERTEX_PROGRAM_POINT_SIZE_ARB */
+   { 39825, 0x00008642 }, /* GL_VERTEX_PROGRAM_POINT_SIZE_NV */
+   { 39857, 0x00008643 }, /* GL_VERTEX_PROGRAM_TWO_SIDE */
+   { 39884, 0x00008643 }, /* GL_VERTEX_PROGRAM_TWO_SIDE_ARB */
+   { 39915, 0x00008643 }, /* GL_VERTEX_PROGRAM_TWO_SIDE_NV */
+   { 39945, 0x00008B31 }, /* GL_VERTEX_SHADER */
+   { 39962, 0x00008B31 }, /* GL_VERTEX_SHADER_ARB */
+   { 39983, 0x00008621 }, /* GL_VERTEX_STATE_PROGRAM_NV */
+   { 40010, 0x00000BA2 }, /* GL_VIEWPORT */
+   { 40022, 0x00000800 }, /* GL_VIEWPORT_BIT */
+   { 40038, 0x0000911D }, /* GL_WAIT_FAILED */
+   { 40053, 0x000086AD }, /* GL_WEIGHT_ARRAY_ARB */
+   { 40073, 0x0000889E }, /* GL_WEIGHT_ARRAY_BUFFER_BINDING */
+   { 40104, 0x0000889E }, /* GL_WEIGHT_ARRAY_BUFFER_BINDING_ARB */
+   { 40139, 0x000086AC }, /* GL_WEIGHT_ARRAY_POINTER_ARB */
+   { 40167, 0x000086AB }, /* GL_WEIGHT_ARRAY_SIZE_ARB */
+   { 40192, 0x000086AA }, /* GL_WEIGHT_ARRAY_STRIDE_ARB */
+   { 40219, 0x000086A9 }, /* GL_WEIGHT_ARRAY_TYPE_ARB */
+   { 40244, 0x000086A6 }, /* GL_WEIGHT_SUM_UNITY_ARB */
+   { 40268, 0x000081D4 }, /* GL_WRAP_BORDER_SUN */
+   { 40287, 0x000088B9 }, /* GL_WRITE_ONLY */
+   { 40301, 0x000088B9 }, /* GL_WRITE_ONLY_ARB */
+   { 40319, 0x00001506 }, /* GL_XOR */
+   { 40326, 0x000085B9 }, /* GL_YCBCR_422_APPLE */
+   { 40345, 0x00008757 }, /* GL_YCBCR_MESA */
+   { 40359, 0x00000000 }, /* GL_ZERO */
+   { 40367, 0x00000D16 }, /* GL_ZOOM_X */
+   { 40377, 0x00000D17 }, /* GL_ZOOM_Y */
 };
 
-static const unsigned reduced_enums[1347] =
+static const unsigned reduced_enums[1351] =
 {
        476, /* GL_FALSE */
        692, /* GL_LINES */
        694, /* GL_LINE_LOOP */
        701, /* GL_LINE_STRIP */
-      1744, /* GL_TRIANGLES */
-      1747, /* GL_TRIANGLE_STRIP */
-      1745, /* GL_TRIANGLE_FAN */
+      1748, /* GL_TRIANGLES */
+      1751, /* GL_TRIANGLE_STRIP */
+      1749, /* GL_TRIANGLE_FAN */
       1272, /* GL_QUADS */
       1275, /* GL_QUAD_STRIP */
       1159, /* GL_POLYGON */
@@ -3776,7 +3784,7 @@ static const unsigned reduced_enums[1347] =
        505, /* GL_FOG_BIT */
          8, /* GL_ACCUM */
        711, /* GL_LOAD */
-      1327, /* GL_RETURN */
+      1331, /* GL_RETURN */
        992, /* GL_MULT */
         23, /* GL_ADD */
       1008, /* GL_NEVER */
@@ -3787,15 +3795,15 @@ static const unsigned reduced_enums[1347] =
       1023, /* GL_NOTEQUAL */
        590, /* GL_GEQUAL */
         47, /* GL_ALWAYS */
-      1468, /* GL_SRC_COLOR */
+      1472, /* GL_SRC_COLOR */
       1053, /* GL_ONE_MINUS_SRC_COLOR */
-      1466, /* GL_SRC_ALPHA */
+      1470, /* GL_SRC_ALPHA */
       1052, /* GL_ONE_MINUS_SRC_ALPHA */
        445, /* GL_DST_ALPHA */
       1050, /* GL_ONE_MINUS_DST_ALPHA */
        446, /* GL_DST_COLOR */
       1051, /* GL_ONE_MINUS_DST_COLOR */
-      1467, /* GL_SRC_ALPHA_SATURATE */
+      1471, /* GL_SRC_ALPHA_SATURATE */
        578, /* GL_FRONT_LEFT */
        579, /* GL_FRONT_RIGHT */
         69, /* GL_BACK_LEFT */
@@ -3803,7 +3811,7 @@ static const unsigned reduced_enums[1347] =
        575, /* GL_FRONT */
         68, /* GL_BACK */
        667, /* GL_LEFT */
-      1369, /* GL_RIGHT */
+      1373, /* GL_RIGHT */
        576, /* GL_FRONT_AND_BACK */
         63, /* GL_AUX0 */
         64, /* GL_AUX1 */
@@ -3812,8 +3820,8 @@ static const unsigned reduced_enums[1347] =
        657, /* GL_INVALID_ENUM */
        661, /* GL_INVALID_VALUE */
        660, /* GL_INVALID_OPERATION */
-      1473, /* GL_STACK_OVERFLOW */
-      1474, /* GL_STACK_UNDERFLOW */
+      1477, /* GL_STACK_OVERFLOW */
+      1478, /* GL_STACK_UNDERFLOW */
       1078, /* GL_OUT_OF_MEMORY */
        658, /* GL_INVALID_FRAMEBUFFER_OPERATION */
          0, /* GL_2D */
@@ -3872,7 +3880,7 @@ static const unsigned reduced_enums[1347] =
        683, /* GL_LIGHT_MODEL_LOCAL_VIEWER */
        684, /* GL_LIGHT_MODEL_TWO_SIDE */
        680, /* GL_LIGHT_MODEL_AMBIENT */
-      1415, /* GL_SHADE_MODEL */
+      1419, /* GL_SHADE_MODEL */
        193, /* GL_COLOR_MATERIAL_FACE */
        194, /* GL_COLOR_MATERIAL_PARAMETER */
        192, /* GL_COLOR_MATERIAL */
@@ -3889,24 +3897,24 @@ static const unsigned reduced_enums[1347] =
        357, /* GL_DEPTH_CLEAR_VALUE */
        368, /* GL_DEPTH_FUNC */
         12, /* GL_ACCUM_CLEAR_VALUE */
-      1509, /* GL_STENCIL_TEST */
-      1497, /* GL_STENCIL_CLEAR_VALUE */
-      1499, /* GL_STENCIL_FUNC */
-      1511, /* GL_STENCIL_VALUE_MASK */
-      1498, /* GL_STENCIL_FAIL */
-      1506, /* GL_STENCIL_PASS_DEPTH_FAIL */
-      1507, /* GL_STENCIL_PASS_DEPTH_PASS */
-      1508, /* GL_STENCIL_REF */
-      1512, /* GL_STENCIL_WRITEMASK */
+      1513, /* GL_STENCIL_TEST */
+      1501, /* GL_STENCIL_CLEAR_VALUE */
+      1503, /* GL_STENCIL_FUNC */
+      1515, /* GL_STENCIL_VALUE_MASK */
+      1502, /* GL_STENCIL_FAIL */
+      1510, /* GL_STENCIL_PASS_DEPTH_FAIL */
+      1511, /* GL_STENCIL_PASS_DEPTH_PASS */
+      1512, /* GL_STENCIL_REF */
+      1516, /* GL_STENCIL_WRITEMASK */
        844, /* GL_MATRIX_MODE */
       1013, /* GL_NORMALIZE */
-      1838, /* GL_VIEWPORT */
+      1842, /* GL_VIEWPORT */
        987, /* GL_MODELVIEW_STACK_DEPTH */
       1251, /* GL_PROJECTION_STACK_DEPTH */
-      1719, /* GL_TEXTURE_STACK_DEPTH */
+      1723, /* GL_TEXTURE_STACK_DEPTH */
        985, /* GL_MODELVIEW_MATRIX */
       1250, /* GL_PROJECTION_MATRIX */
-      1702, /* GL_TEXTURE_MATRIX */
+      1706, /* GL_TEXTURE_MATRIX */
         61, /* GL_ATTRIB_STACK_DEPTH */
        136, /* GL_CLIENT_ATTRIB_STACK_DEPTH */
         43, /* GL_ALPHA_TEST */
@@ -3921,27 +3929,27 @@ static const unsigned reduced_enums[1347] =
        191, /* GL_COLOR_LOGIC_OP */
         67, /* GL_AUX_BUFFERS */
        392, /* GL_DRAW_BUFFER */
-      1285, /* GL_READ_BUFFER */
-      1396, /* GL_SCISSOR_BOX */
-      1397, /* GL_SCISSOR_TEST */
+      1289, /* GL_READ_BUFFER */
+      1400, /* GL_SCISSOR_BOX */
+      1401, /* GL_SCISSOR_TEST */
        630, /* GL_INDEX_CLEAR_VALUE */
        635, /* GL_INDEX_WRITEMASK */
        188, /* GL_COLOR_CLEAR_VALUE */
        230, /* GL_COLOR_WRITEMASK */
        632, /* GL_INDEX_MODE */
-      1362, /* GL_RGBA_MODE */
+      1366, /* GL_RGBA_MODE */
        391, /* GL_DOUBLEBUFFER */
-      1513, /* GL_STEREO */
-      1320, /* GL_RENDER_MODE */
+      1517, /* GL_STEREO */
+      1324, /* GL_RENDER_MODE */
       1099, /* GL_PERSPECTIVE_CORRECTION_HINT */
       1152, /* GL_POINT_SMOOTH_HINT */
        697, /* GL_LINE_SMOOTH_HINT */
       1169, /* GL_POLYGON_SMOOTH_HINT */
        525, /* GL_FOG_HINT */
-      1683, /* GL_TEXTURE_GEN_S */
-      1684, /* GL_TEXTURE_GEN_T */
-      1682, /* GL_TEXTURE_GEN_R */
-      1681, /* GL_TEXTURE_GEN_Q */
+      1687, /* GL_TEXTURE_GEN_S */
+      1688, /* GL_TEXTURE_GEN_T */
+      1686, /* GL_TEXTURE_GEN_R */
+      1685, /* GL_TEXTURE_GEN_Q */
       1112, /* GL_PIXEL_MAP_I_TO_I */
       1118, /* GL_PIXEL_MAP_S_TO_S */
       1114, /* GL_PIXEL_MAP_I_TO_R */
@@ -3962,12 +3970,12 @@ static const unsigned reduced_enums[1347] =
       1105, /* GL_PIXEL_MAP_G_TO_G_SIZE */
       1103, /* GL_PIXEL_MAP_B_TO_B_SIZE */
       1101, /* GL_PIXEL_MAP_A_TO_A_SIZE */
-      1756, /* GL_UNPACK_SWAP_BYTES */
-      1751, /* GL_UNPACK_LSB_FIRST */
-      1752, /* GL_UNPACK_ROW_LENGTH */
-      1755, /* GL_UNPACK_SKIP_ROWS */
-      1754, /* GL_UNPACK_SKIP_PIXELS */
-      1749, /* GL_UNPACK_ALIGNMENT */
+      1760, /* GL_UNPACK_SWAP_BYTES */
+      1755, /* GL_UNPACK_LSB_FIRST */
+      1756, /* GL_UNPACK_ROW_LENGTH */
+      1759, /* GL_UNPACK_SKIP_ROWS */
+      1758, /* GL_UNPACK_SKIP_PIXELS */
+      1753, /* GL_UNPACK_ALIGNMENT */
       1087, /* GL_PACK_SWAP_BYTES */
       1082, /* GL_PACK_LSB_FIRST */
       1083, /* GL_PACK_ROW_LENGTH */
@@ -3978,10 +3986,10 @@ static const unsigned reduced_enums[1347] =
        796, /* GL_MAP_STENCIL */
        634, /* GL_INDEX_SHIFT */
        633, /* GL_INDEX_OFFSET */
-      1298, /* GL_RED_SCALE */
-      1296, /* GL_RED_BIAS */
-      1856, /* GL_ZOOM_X */
-      1857, /* GL_ZOOM_Y */
+      1302, /* GL_RED_SCALE */
+      1300, /* GL_RED_BIAS */
+      1860, /* GL_ZOOM_X */
+      1861, /* GL_ZOOM_Y */
        595, /* GL_GREEN_SCALE */
        593, /* GL_GREEN_BIAS */
         93, /* GL_BLUE_SCALE */
@@ -4002,14 +4010,14 @@ static const unsigned reduced_enums[1347] =
        921, /* GL_MAX_TEXTURE_STACK_DEPTH */
        935, /* GL_MAX_VIEWPORT_DIMS */
        850, /* GL_MAX_CLIENT_ATTRIB_STACK_DEPTH */
-      1523, /* GL_SUBPIXEL_BITS */
+      1527, /* GL_SUBPIXEL_BITS */
        629, /* GL_INDEX_BITS */
-      1297, /* GL_RED_BITS */
+      1301, /* GL_RED_BITS */
        594, /* GL_GREEN_BITS */
         92, /* GL_BLUE_BITS */
         41, /* GL_ALPHA_BITS */
        351, /* GL_DEPTH_BITS */
-      1495, /* GL_STENCIL_BITS */
+      1499, /* GL_STENCIL_BITS */
         14, /* GL_ACCUM_RED_BITS */
         13, /* GL_ACCUM_GREEN_BITS */
         10, /* GL_ACCUM_BLUE_BITS */
@@ -4038,39 +4046,39 @@ static const unsigned reduced_enums[1347] =
        739, /* GL_MAP1_GRID_SEGMENTS */
        765, /* GL_MAP2_GRID_DOMAIN */
        766, /* GL_MAP2_GRID_SEGMENTS */
-      1606, /* GL_TEXTURE_1D */
-      1608, /* GL_TEXTURE_2D */
+      1610, /* GL_TEXTURE_1D */
+      1612, /* GL_TEXTURE_2D */
        479, /* GL_FEEDBACK_BUFFER_POINTER */
        480, /* GL_FEEDBACK_BUFFER_SIZE */
        481, /* GL_FEEDBACK_BUFFER_TYPE */
-      1406, /* GL_SELECTION_BUFFER_POINTER */
-      1407, /* GL_SELECTION_BUFFER_SIZE */
-      1724, /* GL_TEXTURE_WIDTH */
-      1688, /* GL_TEXTURE_HEIGHT */
-      1643, /* GL_TEXTURE_COMPONENTS */
-      1627, /* GL_TEXTURE_BORDER_COLOR */
-      1626, /* GL_TEXTURE_BORDER */
+      1410, /* GL_SELECTION_BUFFER_POINTER */
+      1411, /* GL_SELECTION_BUFFER_SIZE */
+      1728, /* GL_TEXTURE_WIDTH */
+      1692, /* GL_TEXTURE_HEIGHT */
+      1647, /* GL_TEXTURE_COMPONENTS */
+      1631, /* GL_TEXTURE_BORDER_COLOR */
+      1630, /* GL_TEXTURE_BORDER */
        383, /* GL_DONT_CARE */
        477, /* GL_FASTEST */
       1009, /* GL_NICEST */
         48, /* GL_AMBIENT */
        380, /* GL_DIFFUSE */
-      1455, /* GL_SPECULAR */
+      1459, /* GL_SPECULAR */
       1173, /* GL_POSITION */
-      1458, /* GL_SPOT_DIRECTION */
-      1459, /* GL_SPOT_EXPONENT */
-      1457, /* GL_SPOT_CUTOFF */
+      1462, /* GL_SPOT_DIRECTION */
+      1463, /* GL_SPOT_EXPONENT */
+      1461, /* GL_SPOT_CUTOFF */
        275, /* GL_CONSTANT_ATTENUATION */
        687, /* GL_LINEAR_ATTENUATION */
       1271, /* GL_QUADRATIC_ATTENUATION */
        244, /* GL_COMPILE */
        245, /* GL_COMPILE_AND_EXECUTE */
        120, /* GL_BYTE */
-      1758, /* GL_UNSIGNED_BYTE */
-      1420, /* GL_SHORT */
-      1769, /* GL_UNSIGNED_SHORT */
+      1762, /* GL_UNSIGNED_BYTE */
+      1424, /* GL_SHORT */
+      1773, /* GL_UNSIGNED_SHORT */
        637, /* GL_INT */
-      1761, /* GL_UNSIGNED_INT */
+      1765, /* GL_UNSIGNED_INT */
        485, /* GL_FLOAT */
          1, /* GL_2_BYTES */
          5, /* GL_3_BYTES */
@@ -4082,7 +4090,7 @@ static const unsigned reduced_enums[1347] =
        299, /* GL_COPY */
         51, /* GL_AND_INVERTED */
       1011, /* GL_NOOP */
-      1852, /* GL_XOR */
+      1856, /* GL_XOR */
       1074, /* GL_OR */
       1012, /* GL_NOR */
        467, /* GL_EQUIV */
@@ -4091,58 +4099,58 @@ static const unsigned reduced_enums[1347] =
        300, /* GL_COPY_INVERTED */
       1076, /* GL_OR_INVERTED */
       1002, /* GL_NAND */
-      1411, /* GL_SET */
+      1415, /* GL_SET */
        464, /* GL_EMISSION */
-      1419, /* GL_SHININESS */
+      1423, /* GL_SHININESS */
         49, /* GL_AMBIENT_AND_DIFFUSE */
        190, /* GL_COLOR_INDEXES */
        952, /* GL_MODELVIEW */
       1249, /* GL_PROJECTION */
-      1541, /* GL_TEXTURE */
+      1545, /* GL_TEXTURE */
        147, /* GL_COLOR */
        346, /* GL_DEPTH */
-      1481, /* GL_STENCIL */
+      1485, /* GL_STENCIL */
        189, /* GL_COLOR_INDEX */
-      1500, /* GL_STENCIL_INDEX */
+      1504, /* GL_STENCIL_INDEX */
        358, /* GL_DEPTH_COMPONENT */
-      1293, /* GL_RED */
+      1297, /* GL_RED */
        592, /* GL_GREEN */
         90, /* GL_BLUE */
         31, /* GL_ALPHA */
-      1328, /* GL_RGB */
-      1347, /* GL_RGBA */
+      1332, /* GL_RGB */
+      1351, /* GL_RGBA */
        715, /* GL_LUMINANCE */
        736, /* GL_LUMINANCE_ALPHA */
         73, /* GL_BITMAP */
       1129, /* GL_POINT */
        685, /* GL_LINE */
        482, /* GL_FILL */
-      1302, /* GL_RENDER */
+      1306, /* GL_RENDER */
        478, /* GL_FEEDBACK */
-      1405, /* GL_SELECT */
+      1409, /* GL_SELECT */
        484, /* GL_FLAT */
-      1430, /* GL_SMOOTH */
+      1434, /* GL_SMOOTH */
        665, /* GL_KEEP */
-      1322, /* GL_REPLACE */
+      1326, /* GL_REPLACE */
        619, /* GL_INCR */
        342, /* GL_DECR */
-      1784, /* GL_VENDOR */
-      1319, /* GL_RENDERER */
-      1785, /* GL_VERSION */
+      1788, /* GL_VENDOR */
+      1323, /* GL_RENDERER */
+      1789, /* GL_VERSION */
        471, /* GL_EXTENSIONS */
-      1370, /* GL_S */
-      1532, /* GL_T */
-      1282, /* GL_R */
+      1374, /* GL_S */
+      1536, /* GL_T */
+      1286, /* GL_R */
       1270, /* GL_Q */
        988, /* GL_MODULATE */
        341, /* GL_DECAL */
-      1678, /* GL_TEXTURE_ENV_MODE */
-      1677, /* GL_TEXTURE_ENV_COLOR */
-      1676, /* GL_TEXTURE_ENV */
+      1682, /* GL_TEXTURE_ENV_MODE */
+      1681, /* GL_TEXTURE_ENV_COLOR */
+      1680, /* GL_TEXTURE_ENV */
        472, /* GL_EYE_LINEAR */
       1035, /* GL_OBJECT_LINEAR */
-      1456, /* GL_SPHERE_MAP */
-      1680, /* GL_TEXTURE_GEN_MODE */
+      1460, /* GL_SPHERE_MAP */
+      1684, /* GL_TEXTURE_GEN_MODE */
       1037, /* GL_OBJECT_PLANE */
        473, /* GL_EYE_PLANE */
       1003, /* GL_NEAREST */
@@ -4151,30 +4159,30 @@ static const unsigned reduced_enums[1347] =
        691, /* GL_LINEAR_MIPMAP_NEAREST */
       1006, /* GL_NEAREST_MIPMAP_LINEAR */
        690, /* GL_LINEAR_MIPMAP_LINEAR */
-      1701, /* GL_TEXTURE_MAG_FILTER */
-      1709, /* GL_TEXTURE_MIN_FILTER */
-      1726, /* GL_TEXTURE_WRAP_S */
-      1727, /* GL_TEXTURE_WRAP_T */
+      1705, /* GL_TEXTURE_MAG_FILTER */
+      1713, /* GL_TEXTURE_MIN_FILTER */
+      1730, /* GL_TEXTURE_WRAP_S */
+      1731, /* GL_TEXTURE_WRAP_T */
        126, /* GL_CLAMP */
-      1321, /* GL_REPEAT */
+      1325, /* GL_REPEAT */
       1167, /* GL_POLYGON_OFFSET_UNITS */
       1166, /* GL_POLYGON_OFFSET_POINT */
       1165, /* GL_POLYGON_OFFSET_LINE */
-      1283, /* GL_R3_G3_B2 */
-      1781, /* GL_V2F */
-      1782, /* GL_V3F */
+      1287, /* GL_R3_G3_B2 */
+      1785, /* GL_V2F */
+      1786, /* GL_V3F */
        123, /* GL_C4UB_V2F */
        124, /* GL_C4UB_V3F */
        121, /* GL_C3F_V3F */
       1000, /* GL_N3F_V3F */
        122, /* GL_C4F_N3F_V3F */
-      1537, /* GL_T2F_V3F */
-      1539, /* GL_T4F_V4F */
-      1535, /* GL_T2F_C4UB_V3F */
-      1533, /* GL_T2F_C3F_V3F */
-      1536, /* GL_T2F_N3F_V3F */
-      1534, /* GL_T2F_C4F_N3F_V3F */
-      1538, /* GL_T4F_C4F_N3F_V4F */
+      1541, /* GL_T2F_V3F */
+      1543, /* GL_T4F_V4F */
+      1539, /* GL_T2F_C4UB_V3F */
+      1537, /* GL_T2F_C3F_V3F */
+      1540, /* GL_T2F_N3F_V3F */
+      1538, /* GL_T2F_C4F_N3F_V3F */
+      1542, /* GL_T4F_C4F_N3F_V4F */
        139, /* GL_CLIP_PLANE0 */
        140, /* GL_CLIP_PLANE1 */
        141, /* GL_CLIP_PLANE2 */
@@ -4203,11 +4211,11 @@ static const unsigned reduced_enums[1347] =
        582, /* GL_FUNC_REVERSE_SUBTRACT */
        280, /* GL_CONVOLUTION_1D */
        281, /* GL_CONVOLUTION_2D */
-      1408, /* GL_SEPARABLE_2D */
+      1412, /* GL_SEPARABLE_2D */
        284, /* GL_CONVOLUTION_BORDER_MODE */
        288, /* GL_CONVOLUTION_FILTER_SCALE */
        286, /* GL_CONVOLUTION_FILTER_BIAS */
-      1294, /* GL_REDUCE */
+      1298, /* GL_REDUCE */
        290, /* GL_CONVOLUTION_FORMAT */
        294, /* GL_CONVOLUTION_WIDTH */
        292, /* GL_CONVOLUTION_HEIGHT */
@@ -4234,16 +4242,16 @@ static const unsigned reduced_enums[1347] =
        937, /* GL_MINMAX */
        939, /* GL_MINMAX_FORMAT */
        941, /* GL_MINMAX_SINK */
-      1540, /* GL_TABLE_TOO_LARGE_EXT */
-      1760, /* GL_UNSIGNED_BYTE_3_3_2 */
-      1771, /* GL_UNSIGNED_SHORT_4_4_4_4 */
-      1773, /* GL_UNSIGNED_SHORT_5_5_5_1 */
-      1766, /* GL_UNSIGNED_INT_8_8_8_8 */
-      1762, /* GL_UNSIGNED_INT_10_10_10_2 */
+      1544, /* GL_TABLE_TOO_LARGE_EXT */
+      1764, /* GL_UNSIGNED_BYTE_3_3_2 */
+      1775, /* GL_UNSIGNED_SHORT_4_4_4_4 */
+      1777, /* GL_UNSIGNED_SHORT_5_5_5_1 */
+      1770, /* GL_UNSIGNED_INT_8_8_8_8 */
+      1766, /* GL_UNSIGNED_INT_10_10_10_2 */
       1164, /* GL_POLYGON_OFFSET_FILL */
       1163, /* GL_POLYGON_OFFSET_FACTOR */
       1162, /* GL_POLYGON_OFFSET_BIAS */
-      1325, /* GL_RESCALE_NORMAL */
+      1329, /* GL_RESCALE_NORMAL */
         36, /* GL_ALPHA4 */
         38, /* GL_ALPHA8 */
         32, /* GL_ALPHA12 */
@@ -4263,53 +4271,53 @@ static const unsigned reduced_enums[1347] =
        645, /* GL_INTENSITY8 */
        639, /* GL_INTENSITY12 */
        641, /* GL_INTENSITY16 */
-      1337, /* GL_RGB2_EXT */
-      1338, /* GL_RGB4 */
-      1341, /* GL_RGB5 */
-      1345, /* GL_RGB8 */
-      1329, /* GL_RGB10 */
-      1333, /* GL_RGB12 */
-      1335, /* GL_RGB16 */
-      1352, /* GL_RGBA2 */
-      1354, /* GL_RGBA4 */
-      1342, /* GL_RGB5_A1 */
-      1358, /* GL_RGBA8 */
-      1330, /* GL_RGB10_A2 */
-      1348, /* GL_RGBA12 */
-      1350, /* GL_RGBA16 */
-      1716, /* GL_TEXTURE_RED_SIZE */
-      1686, /* GL_TEXTURE_GREEN_SIZE */
-      1624, /* GL_TEXTURE_BLUE_SIZE */
-      1611, /* GL_TEXTURE_ALPHA_SIZE */
-      1699, /* GL_TEXTURE_LUMINANCE_SIZE */
-      1690, /* GL_TEXTURE_INTENSITY_SIZE */
-      1323, /* GL_REPLACE_EXT */
+      1341, /* GL_RGB2_EXT */
+      1342, /* GL_RGB4 */
+      1345, /* GL_RGB5 */
+      1349, /* GL_RGB8 */
+      1333, /* GL_RGB10 */
+      1337, /* GL_RGB12 */
+      1339, /* GL_RGB16 */
+      1356, /* GL_RGBA2 */
+      1358, /* GL_RGBA4 */
+      1346, /* GL_RGB5_A1 */
+      1362, /* GL_RGBA8 */
+      1334, /* GL_RGB10_A2 */
+      1352, /* GL_RGBA12 */
+      1354, /* GL_RGBA16 */
+      1720, /* GL_TEXTURE_RED_SIZE */
+      1690, /* GL_TEXTURE_GREEN_SIZE */
+      1628, /* GL_TEXTURE_BLUE_SIZE */
+      1615, /* GL_TEXTURE_ALPHA_SIZE */
+      1703, /* GL_TEXTURE_LUMINANCE_SIZE */
+      1694, /* GL_TEXTURE_INTENSITY_SIZE */
+      1327, /* GL_REPLACE_EXT */
       1258, /* GL_PROXY_TEXTURE_1D */
       1261, /* GL_PROXY_TEXTURE_2D */
-      1722, /* GL_TEXTURE_TOO_LARGE_EXT */
-      1711, /* GL_TEXTURE_PRIORITY */
-      1718, /* GL_TEXTURE_RESIDENT */
-      1614, /* GL_TEXTURE_BINDING_1D */
-      1616, /* GL_TEXTURE_BINDING_2D */
-      1618, /* GL_TEXTURE_BINDING_3D */
+      1726, /* GL_TEXTURE_TOO_LARGE_EXT */
+      1715, /* GL_TEXTURE_PRIORITY */
+      1722, /* GL_TEXTURE_RESIDENT */
+      1618, /* GL_TEXTURE_BINDING_1D */
+      1620, /* GL_TEXTURE_BINDING_2D */
+      1622, /* GL_TEXTURE_BINDING_3D */
       1084, /* GL_PACK_SKIP_IMAGES */
       1080, /* GL_PACK_IMAGE_HEIGHT */
-      1753, /* GL_UNPACK_SKIP_IMAGES */
-      1750, /* GL_UNPACK_IMAGE_HEIGHT */
-      1610, /* GL_TEXTURE_3D */
+      1757, /* GL_UNPACK_SKIP_IMAGES */
+      1754, /* GL_UNPACK_IMAGE_HEIGHT */
+      1614, /* GL_TEXTURE_3D */
       1264, /* GL_PROXY_TEXTURE_3D */
-      1673, /* GL_TEXTURE_DEPTH */
-      1725, /* GL_TEXTURE_WRAP_R */
+      1677, /* GL_TEXTURE_DEPTH */
+      1729, /* GL_TEXTURE_WRAP_R */
        847, /* GL_MAX_3D_TEXTURE_SIZE */
-      1786, /* GL_VERTEX_ARRAY */
+      1790, /* GL_VERTEX_ARRAY */
       1014, /* GL_NORMAL_ARRAY */
        148, /* GL_COLOR_ARRAY */
        623, /* GL_INDEX_ARRAY */
-      1651, /* GL_TEXTURE_COORD_ARRAY */
+      1655, /* GL_TEXTURE_COORD_ARRAY */
        456, /* GL_EDGE_FLAG_ARRAY */
-      1792, /* GL_VERTEX_ARRAY_SIZE */
-      1794, /* GL_VERTEX_ARRAY_TYPE */
-      1793, /* GL_VERTEX_ARRAY_STRIDE */
+      1796, /* GL_VERTEX_ARRAY_SIZE */
+      1798, /* GL_VERTEX_ARRAY_TYPE */
+      1797, /* GL_VERTEX_ARRAY_STRIDE */
       1019, /* GL_NORMAL_ARRAY_TYPE */
       1018, /* GL_NORMAL_ARRAY_STRIDE */
        152, /* GL_COLOR_ARRAY_SIZE */
@@ -4317,24 +4325,24 @@ static const unsigned reduced_enums[1347] =
        153, /* GL_COLOR_ARRAY_STRIDE */
        628, /* GL_INDEX_ARRAY_TYPE */
        627, /* GL_INDEX_ARRAY_STRIDE */
-      1655, /* GL_TEXTURE_COORD_ARRAY_SIZE */
-      1657, /* GL_TEXTURE_COORD_ARRAY_TYPE */
-      1656, /* GL_TEXTURE_COORD_ARRAY_STRIDE */
+      1659, /* GL_TEXTURE_COORD_ARRAY_SIZE */
+      1661, /* GL_TEXTURE_COORD_ARRAY_TYPE */
+      1660, /* GL_TEXTURE_COORD_ARRAY_STRIDE */
        460, /* GL_EDGE_FLAG_ARRAY_STRIDE */
-      1791, /* GL_VERTEX_ARRAY_POINTER */
+      1795, /* GL_VERTEX_ARRAY_POINTER */
       1017, /* GL_NORMAL_ARRAY_POINTER */
        151, /* GL_COLOR_ARRAY_POINTER */
        626, /* GL_INDEX_ARRAY_POINTER */
-      1654, /* GL_TEXTURE_COORD_ARRAY_POINTER */
+      1658, /* GL_TEXTURE_COORD_ARRAY_POINTER */
        459, /* GL_EDGE_FLAG_ARRAY_POINTER */
        993, /* GL_MULTISAMPLE */
-      1382, /* GL_SAMPLE_ALPHA_TO_COVERAGE */
-      1384, /* GL_SAMPLE_ALPHA_TO_ONE */
-      1389, /* GL_SAMPLE_COVERAGE */
-      1386, /* GL_SAMPLE_BUFFERS */
-      1377, /* GL_SAMPLES */
-      1393, /* GL_SAMPLE_COVERAGE_VALUE */
-      1391, /* GL_SAMPLE_COVERAGE_INVERT */
+      1386, /* GL_SAMPLE_ALPHA_TO_COVERAGE */
+      1388, /* GL_SAMPLE_ALPHA_TO_ONE */
+      1393, /* GL_SAMPLE_COVERAGE */
+      1390, /* GL_SAMPLE_BUFFERS */
+      1381, /* GL_SAMPLES */
+      1397, /* GL_SAMPLE_COVERAGE_VALUE */
+      1395, /* GL_SAMPLE_COVERAGE_INVERT */
        195, /* GL_COLOR_MATRIX */
        197, /* GL_COLOR_MATRIX_STACK_DEPTH */
        855, /* GL_MAX_COLOR_MATRIX_STACK_DEPTH */
@@ -4346,9 +4354,9 @@ static const unsigned reduced_enums[1347] =
       1183, /* GL_POST_COLOR_MATRIX_GREEN_BIAS */
       1178, /* GL_POST_COLOR_MATRIX_BLUE_BIAS */
       1174, /* GL_POST_COLOR_MATRIX_ALPHA_BIAS */
-      1634, /* GL_TEXTURE_COLOR_TABLE_SGI */
+      1638, /* GL_TEXTURE_COLOR_TABLE_SGI */
       1265, /* GL_PROXY_TEXTURE_COLOR_TABLE_SGI */
-      1636, /* GL_TEXTURE_COMPARE_FAIL_VALUE_ARB */
+      1640, /* GL_TEXTURE_COMPARE_FAIL_VALUE_ARB */
         80, /* GL_BLEND_DST_RGB */
         89, /* GL_BLEND_SRC_RGB */
         79, /* GL_BLEND_DST_ALPHA */
@@ -4373,7 +4381,7 @@ static const unsigned reduced_enums[1347] =
         72, /* GL_BGRA */
        869, /* GL_MAX_ELEMENTS_VERTICES */
        868, /* GL_MAX_ELEMENTS_INDICES */
-      1689, /* GL_TEXTURE_INDEX_SIZE_EXT */
+      1693, /* GL_TEXTURE_INDEX_SIZE_EXT */
        145, /* GL_CLIP_VOLUME_CLIPPING_HINT_EXT */
       1146, /* GL_POINT_SIZE_MIN */
       1142, /* GL_POINT_SIZE_MAX */
@@ -4381,52 +4389,52 @@ static const unsigned reduced_enums[1347] =
       1132, /* GL_POINT_DISTANCE_ATTENUATION */
        127, /* GL_CLAMP_TO_BORDER */
        130, /* GL_CLAMP_TO_EDGE */
-      1710, /* GL_TEXTURE_MIN_LOD */
-      1708, /* GL_TEXTURE_MAX_LOD */
-      1613, /* GL_TEXTURE_BASE_LEVEL */
-      1707, /* GL_TEXTURE_MAX_LEVEL */
+      1714, /* GL_TEXTURE_MIN_LOD */
+      1712, /* GL_TEXTURE_MAX_LOD */
+      1617, /* GL_TEXTURE_BASE_LEVEL */
+      1711, /* GL_TEXTURE_MAX_LEVEL */
        616, /* GL_IGNORE_BORDER_HP */
        276, /* GL_CONSTANT_BORDER_HP */
-      1324, /* GL_REPLICATE_BORDER_HP */
+      1328, /* GL_REPLICATE_BORDER_HP */
        282, /* GL_CONVOLUTION_BORDER_COLOR */
       1043, /* GL_OCCLUSION_TEST_HP */
       1044, /* GL_OCCLUSION_TEST_RESULT_HP */
        688, /* GL_LINEAR_CLIPMAP_LINEAR_SGIX */
-      1628, /* GL_TEXTURE_CLIPMAP_CENTER_SGIX */
-      1630, /* GL_TEXTURE_CLIPMAP_FRAME_SGIX */
-      1632, /* GL_TEXTURE_CLIPMAP_OFFSET_SGIX */
-      1633, /* GL_TEXTURE_CLIPMAP_VIRTUAL_DEPTH_SGIX */
-      1631, /* GL_TEXTURE_CLIPMAP_LOD_OFFSET_SGIX */
-      1629, /* GL_TEXTURE_CLIPMAP_DEPTH_SGIX */
+      1632, /* GL_TEXTURE_CLIPMAP_CENTER_SGIX */
+      1634, /* GL_TEXTURE_CLIPMAP_FRAME_SGIX */
+      1636, /* GL_TEXTURE_CLIPMAP_OFFSET_SGIX */
+      1637, /* GL_TEXTURE_CLIPMAP_VIRTUAL_DEPTH_SGIX */
+      1635, /* GL_TEXTURE_CLIPMAP_LOD_OFFSET_SGIX */
+      1633, /* GL_TEXTURE_CLIPMAP_DEPTH_SGIX */
        851, /* GL_MAX_CLIPMAP_DEPTH_SGIX */
        852, /* GL_MAX_CLIPMAP_VIRTUAL_DEPTH_SGIX */
       1209, /* GL_POST_TEXTURE_FILTER_BIAS_SGIX */
       1211, /* GL_POST_TEXTURE_FILTER_SCALE_SGIX */
       1208, /* GL_POST_TEXTURE_FILTER_BIAS_RANGE_SGIX */
       1210, /* GL_POST_TEXTURE_FILTER_SCALE_RANGE_SGIX */
-      1697, /* GL_TEXTURE_LOD_BIAS_S_SGIX */
-      1698, /* GL_TEXTURE_LOD_BIAS_T_SGIX */
-      1696, /* GL_TEXTURE_LOD_BIAS_R_SGIX */
+      1701, /* GL_TEXTURE_LOD_BIAS_S_SGIX */
+      1702, /* GL_TEXTURE_LOD_BIAS_T_SGIX */
+      1700, /* GL_TEXTURE_LOD_BIAS_R_SGIX */
        586, /* GL_GENERATE_MIPMAP */
        587, /* GL_GENERATE_MIPMAP_HINT */
        528, /* GL_FOG_OFFSET_SGIX */
        529, /* GL_FOG_OFFSET_VALUE_SGIX */
-      1642, /* GL_TEXTURE_COMPARE_SGIX */
-      1641, /* GL_TEXTURE_COMPARE_OPERATOR_SGIX */
-      1693, /* GL_TEXTURE_LEQUAL_R_SGIX */
-      1685, /* GL_TEXTURE_GEQUAL_R_SGIX */
+      1646, /* GL_TEXTURE_COMPARE_SGIX */
+      1645, /* GL_TEXTURE_COMPARE_OPERATOR_SGIX */
+      1697, /* GL_TEXTURE_LEQUAL_R_SGIX */
+      1689, /* GL_TEXTURE_GEQUAL_R_SGIX */
        359, /* GL_DEPTH_COMPONENT16 */
        362, /* GL_DEPTH_COMPONENT24 */
        365, /* GL_DEPTH_COMPONENT32 */
        306, /* GL_CULL_VERTEX_EXT */
        308, /* GL_CULL_VERTEX_OBJECT_POSITION_EXT */
        307, /* GL_CULL_VERTEX_EYE_POSITION_EXT */
-      1849, /* GL_WRAP_BORDER_SUN */
-      1635, /* GL_TEXTURE_COLOR_WRITEMASK_SGIS */
+      1853, /* GL_WRAP_BORDER_SUN */
+      1639, /* GL_TEXTURE_COLOR_WRITEMASK_SGIS */
        681, /* GL_LIGHT_MODEL_COLOR_CONTROL */
-      1423, /* GL_SINGLE_COLOR */
-      1409, /* GL_SEPARATE_SPECULAR_COLOR */
-      1418, /* GL_SHARED_TEXTURE_PALETTE_EXT */
+      1427, /* GL_SINGLE_COLOR */
+      1413, /* GL_SEPARATE_SPECULAR_COLOR */
+      1422, /* GL_SHARED_TEXTURE_PALETTE_EXT */
        539, /* GL_FRAMEBUFFER_ATTACHMENT_COLOR_ENCODING */
        540, /* GL_FRAMEBUFFER_ATTACHMENT_COMPONENT_TYPE */
        547, /* GL_FRAMEBUFFER_ATTACHMENT_RED_SIZE */
@@ -4439,23 +4447,23 @@ static const unsigned reduced_enums[1347] =
        572, /* GL_FRAMEBUFFER_UNDEFINED */
        372, /* GL_DEPTH_STENCIL_ATTACHMENT */
        622, /* GL_INDEX */
-      1759, /* GL_UNSIGNED_BYTE_2_3_3_REV */
-      1774, /* GL_UNSIGNED_SHORT_5_6_5 */
-      1775, /* GL_UNSIGNED_SHORT_5_6_5_REV */
-      1772, /* GL_UNSIGNED_SHORT_4_4_4_4_REV */
-      1770, /* GL_UNSIGNED_SHORT_1_5_5_5_REV */
-      1767, /* GL_UNSIGNED_INT_8_8_8_8_REV */
-      1765, /* GL_UNSIGNED_INT_2_10_10_10_REV */
-      1705, /* GL_TEXTURE_MAX_CLAMP_S_SGIX */
-      1706, /* GL_TEXTURE_MAX_CLAMP_T_SGIX */
-      1704, /* GL_TEXTURE_MAX_CLAMP_R_SGIX */
+      1763, /* GL_UNSIGNED_BYTE_2_3_3_REV */
+      1778, /* GL_UNSIGNED_SHORT_5_6_5 */
+      1779, /* GL_UNSIGNED_SHORT_5_6_5_REV */
+      1776, /* GL_UNSIGNED_SHORT_4_4_4_4_REV */
+      1774, /* GL_UNSIGNED_SHORT_1_5_5_5_REV */
+      1771, /* GL_UNSIGNED_INT_8_8_8_8_REV */
+      1769, /* GL_UNSIGNED_INT_2_10_10_10_REV */
+      1709, /* GL_TEXTURE_MAX_CLAMP_S_SGIX */
+      1710, /* GL_TEXTURE_MAX_CLAMP_T_SGIX */
+      1708, /* GL_TEXTURE_MAX_CLAMP_R_SGIX */
        944, /* GL_MIRRORED_REPEAT */
-      1365, /* GL_RGB_S3TC */
-      1340, /* GL_RGB4_S3TC */
-      1363, /* GL_RGBA_S3TC */
-      1357, /* GL_RGBA4_S3TC */
-      1361, /* GL_RGBA_DXT5_S3TC */
-      1355, /* GL_RGBA4_DXT5_S3TC */
+      1369, /* GL_RGB_S3TC */
+      1344, /* GL_RGB4_S3TC */
+      1367, /* GL_RGBA_S3TC */
+      1361, /* GL_RGBA4_S3TC */
+      1365, /* GL_RGBA_DXT5_S3TC */
+      1359, /* GL_RGBA4_DXT5_S3TC */
        264, /* GL_COMPRESSED_RGB_S3TC_DXT1_EXT */
        259, /* GL_COMPRESSED_RGBA_S3TC_DXT1_EXT */
        260, /* GL_COMPRESSED_RGBA_S3TC_DXT3_EXT */
@@ -4473,54 +4481,54 @@ static const unsigned reduced_enums[1347] =
        509, /* GL_FOG_COORDINATE_ARRAY */
        199, /* GL_COLOR_SUM */
        332, /* GL_CURRENT_SECONDARY_COLOR */
-      1402, /* GL_SECONDARY_COLOR_ARRAY_SIZE */
-      1404, /* GL_SECONDARY_COLOR_ARRAY_TYPE */
-      1403, /* GL_SECONDARY_COLOR_ARRAY_STRIDE */
-      1401, /* GL_SECONDARY_COLOR_ARRAY_POINTER */
-      1398, /* GL_SECONDARY_COLOR_ARRAY */
+      1406, /* GL_SECONDARY_COLOR_ARRAY_SIZE */
+      1408, /* GL_SECONDARY_COLOR_ARRAY_TYPE */
+      1407, /* GL_SECONDARY_COLOR_ARRAY_STRIDE */
+      1405, /* GL_SECONDARY_COLOR_ARRAY_POINTER */
+      1402, /* GL_SECONDARY_COLOR_ARRAY */
        330, /* GL_CURRENT_RASTER_SECONDARY_COLOR */
         28, /* GL_ALIASED_POINT_SIZE_RANGE */
         27, /* GL_ALIASED_LINE_WIDTH_RANGE */
-      1542, /* GL_TEXTURE0 */
-      1544, /* GL_TEXTURE1 */
-      1566, /* GL_TEXTURE2 */
-      1588, /* GL_TEXTURE3 */
-      1594, /* GL_TEXTURE4 */
-      1596, /* GL_TEXTURE5 */
-      1598, /* GL_TEXTURE6 */
-      1600, /* GL_TEXTURE7 */
-      1602, /* GL_TEXTURE8 */
-      1604, /* GL_TEXTURE9 */
-      1545, /* GL_TEXTURE10 */
-      1547, /* GL_TEXTURE11 */
-      1549, /* GL_TEXTURE12 */
-      1551, /* GL_TEXTURE13 */
-      1553, /* GL_TEXTURE14 */
-      1555, /* GL_TEXTURE15 */
-      1557, /* GL_TEXTURE16 */
-      1559, /* GL_TEXTURE17 */
-      1561, /* GL_TEXTURE18 */
-      1563, /* GL_TEXTURE19 */
-      1567, /* GL_TEXTURE20 */
-      1569, /* GL_TEXTURE21 */
-      1571, /* GL_TEXTURE22 */
-      1573, /* GL_TEXTURE23 */
-      1575, /* GL_TEXTURE24 */
-      1577, /* GL_TEXTURE25 */
-      1579, /* GL_TEXTURE26 */
-      1581, /* GL_TEXTURE27 */
-      1583, /* GL_TEXTURE28 */
-      1585, /* GL_TEXTURE29 */
-      1589, /* GL_TEXTURE30 */
-      1591, /* GL_TEXTURE31 */
+      1546, /* GL_TEXTURE0 */
+      1548, /* GL_TEXTURE1 */
+      1570, /* GL_TEXTURE2 */
+      1592, /* GL_TEXTURE3 */
+      1598, /* GL_TEXTURE4 */
+      1600, /* GL_TEXTURE5 */
+      1602, /* GL_TEXTURE6 */
+      1604, /* GL_TEXTURE7 */
+      1606, /* GL_TEXTURE8 */
+      1608, /* GL_TEXTURE9 */
+      1549, /* GL_TEXTURE10 */
+      1551, /* GL_TEXTURE11 */
+      1553, /* GL_TEXTURE12 */
+      1555, /* GL_TEXTURE13 */
+      1557, /* GL_TEXTURE14 */
+      1559, /* GL_TEXTURE15 */
+      1561, /* GL_TEXTURE16 */
+      1563, /* GL_TEXTURE17 */
+      1565, /* GL_TEXTURE18 */
+      1567, /* GL_TEXTURE19 */
+      1571, /* GL_TEXTURE20 */
+      1573, /* GL_TEXTURE21 */
+      1575, /* GL_TEXTURE22 */
+      1577, /* GL_TEXTURE23 */
+      1579, /* GL_TEXTURE24 */
+      1581, /* GL_TEXTURE25 */
+      1583, /* GL_TEXTURE26 */
+      1585, /* GL_TEXTURE27 */
+      1587, /* GL_TEXTURE28 */
+      1589, /* GL_TEXTURE29 */
+      1593, /* GL_TEXTURE30 */
+      1595, /* GL_TEXTURE31 */
         18, /* GL_ACTIVE_TEXTURE */
        133, /* GL_CLIENT_ACTIVE_TEXTURE */
        922, /* GL_MAX_TEXTURE_UNITS */
-      1737, /* GL_TRANSPOSE_MODELVIEW_MATRIX */
-      1740, /* GL_TRANSPOSE_PROJECTION_MATRIX */
-      1742, /* GL_TRANSPOSE_TEXTURE_MATRIX */
-      1734, /* GL_TRANSPOSE_COLOR_MATRIX */
-      1524, /* GL_SUBTRACT */
+      1741, /* GL_TRANSPOSE_MODELVIEW_MATRIX */
+      1744, /* GL_TRANSPOSE_PROJECTION_MATRIX */
+      1746, /* GL_TRANSPOSE_TEXTURE_MATRIX */
+      1738, /* GL_TRANSPOSE_COLOR_MATRIX */
+      1528, /* GL_SUBTRACT */
        909, /* GL_MAX_RENDERBUFFER_SIZE_EXT */
        247, /* GL_COMPRESSED_ALPHA */
        251, /* GL_COMPRESSED_LUMINANCE */
@@ -4528,18 +4536,18 @@ static const unsigned reduced_enums[1347] =
        249, /* GL_COMPRESSED_INTENSITY */
        255, /* GL_COMPRESSED_RGB */
        256, /* GL_COMPRESSED_RGBA */
-      1649, /* GL_TEXTURE_COMPRESSION_HINT */
-      1714, /* GL_TEXTURE_RECTANGLE_ARB */
-      1621, /* GL_TEXTURE_BINDING_RECTANGLE_ARB */
+      1653, /* GL_TEXTURE_COMPRESSION_HINT */
+      1718, /* GL_TEXTURE_RECTANGLE_ARB */
+      1625, /* GL_TEXTURE_BINDING_RECTANGLE_ARB */
       1268, /* GL_PROXY_TEXTURE_RECTANGLE_ARB */
        907, /* GL_MAX_RECTANGLE_TEXTURE_SIZE_ARB */
        371, /* GL_DEPTH_STENCIL */
-      1763, /* GL_UNSIGNED_INT_24_8 */
+      1767, /* GL_UNSIGNED_INT_24_8 */
        918, /* GL_MAX_TEXTURE_LOD_BIAS */
-      1703, /* GL_TEXTURE_MAX_ANISOTROPY_EXT */
+      1707, /* GL_TEXTURE_MAX_ANISOTROPY_EXT */
        919, /* GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT */
-      1679, /* GL_TEXTURE_FILTER_CONTROL */
-      1694, /* GL_TEXTURE_LOD_BIAS */
+      1683, /* GL_TEXTURE_FILTER_CONTROL */
+      1698, /* GL_TEXTURE_LOD_BIAS */
        232, /* GL_COMBINE4 */
        912, /* GL_MAX_SHININESS_NV */
        913, /* GL_MAX_SPOT_EXPONENT_NV */
@@ -4547,15 +4555,15 @@ static const unsigned reduced_enums[1347] =
        343, /* GL_DECR_WRAP */
        964, /* GL_MODELVIEW1_ARB */
       1020, /* GL_NORMAL_MAP */
-      1299, /* GL_REFLECTION_MAP */
-      1658, /* GL_TEXTURE_CUBE_MAP */
-      1619, /* GL_TEXTURE_BINDING_CUBE_MAP */
-      1666, /* GL_TEXTURE_CUBE_MAP_POSITIVE_X */
-      1660, /* GL_TEXTURE_CUBE_MAP_NEGATIVE_X */
-      1668, /* GL_TEXTURE_CUBE_MAP_POSITIVE_Y */
-      1662, /* GL_TEXTURE_CUBE_MAP_NEGATIVE_Y */
-      1670, /* GL_TEXTURE_CUBE_MAP_POSITIVE_Z */
-      1664, /* GL_TEXTURE_CUBE_MAP_NEGATIVE_Z */
+      1303, /* GL_REFLECTION_MAP */
+      1662, /* GL_TEXTURE_CUBE_MAP */
+      1623, /* GL_TEXTURE_BINDING_CUBE_MAP */
+      1670, /* GL_TEXTURE_CUBE_MAP_POSITIVE_X */
+      1664, /* GL_TEXTURE_CUBE_MAP_NEGATIVE_X */
+      1672, /* GL_TEXTURE_CUBE_MAP_POSITIVE_Y */
+      1666, /* GL_TEXTURE_CUBE_MAP_NEGATIVE_Y */
+      1674, /* GL_TEXTURE_CUBE_MAP_POSITIVE_Z */
+      1668, /* GL_TEXTURE_CUBE_MAP_NEGATIVE_Z */
       1266, /* GL_PROXY_TEXTURE_CUBE_MAP */
        863, /* GL_MAX_CUBE_MAP_TEXTURE_SIZE */
        999, /* GL_MULTISAMPLE_FILTER_HINT_NV */
@@ -4565,20 +4573,20 @@ static const unsigned reduced_enums[1347] =
        231, /* GL_COMBINE */
        238, /* GL_COMBINE_RGB */
        233, /* GL_COMBINE_ALPHA */
-      1366, /* GL_RGB_SCALE */
+      1370, /* GL_RGB_SCALE */
         24, /* GL_ADD_SIGNED */
        648, /* GL_INTERPOLATE */
        271, /* GL_CONSTANT */
       1215, /* GL_PRIMARY_COLOR */
       1212, /* GL_PREVIOUS */
-      1438, /* GL_SOURCE0_RGB */
-      1444, /* GL_SOURCE1_RGB */
-      1450, /* GL_SOURCE2_RGB */
-      1454, /* GL_SOURCE3_RGB_NV */
-      1435, /* GL_SOURCE0_ALPHA */
-      1441, /* GL_SOURCE1_ALPHA */
-      1447, /* GL_SOURCE2_ALPHA */
-      1453, /* GL_SOURCE3_ALPHA_NV */
+      1442, /* GL_SOURCE0_RGB */
+      1448, /* GL_SOURCE1_RGB */
+      1454, /* GL_SOURCE2_RGB */
+      1458, /* GL_SOURCE3_RGB_NV */
+      1439, /* GL_SOURCE0_ALPHA */
+      1445, /* GL_SOURCE1_ALPHA */
+      1451, /* GL_SOURCE2_ALPHA */
+      1457, /* GL_SOURCE3_ALPHA_NV */
       1057, /* GL_OPERAND0_RGB */
       1063, /* GL_OPERAND1_RGB */
       1069, /* GL_OPERAND2_RGB */
@@ -4587,32 +4595,32 @@ static const unsigned reduced_enums[1347] =
       1060, /* GL_OPERAND1_ALPHA */
       1066, /* GL_OPERAND2_ALPHA */
       1072, /* GL_OPERAND3_ALPHA_NV */
-      1787, /* GL_VERTEX_ARRAY_BINDING */
-      1712, /* GL_TEXTURE_RANGE_LENGTH_APPLE */
-      1713, /* GL_TEXTURE_RANGE_POINTER_APPLE */
-      1853, /* GL_YCBCR_422_APPLE */
-      1776, /* GL_UNSIGNED_SHORT_8_8_APPLE */
-      1778, /* GL_UNSIGNED_SHORT_8_8_REV_APPLE */
-      1721, /* GL_TEXTURE_STORAGE_HINT_APPLE */
-      1515, /* GL_STORAGE_PRIVATE_APPLE */
-      1514, /* GL_STORAGE_CACHED_APPLE */
-      1516, /* GL_STORAGE_SHARED_APPLE */
-      1425, /* GL_SLICE_ACCUM_SUN */
+      1791, /* GL_VERTEX_ARRAY_BINDING */
+      1716, /* GL_TEXTURE_RANGE_LENGTH_APPLE */
+      1717, /* GL_TEXTURE_RANGE_POINTER_APPLE */
+      1857, /* GL_YCBCR_422_APPLE */
+      1780, /* GL_UNSIGNED_SHORT_8_8_APPLE */
+      1782, /* GL_UNSIGNED_SHORT_8_8_REV_APPLE */
+      1725, /* GL_TEXTURE_STORAGE_HINT_APPLE */
+      1519, /* GL_STORAGE_PRIVATE_APPLE */
+      1518, /* GL_STORAGE_CACHED_APPLE */
+      1520, /* GL_STORAGE_SHARED_APPLE */
+      1429, /* GL_SLICE_ACCUM_SUN */
       1274, /* GL_QUAD_MESH_SUN */
-      1746, /* GL_TRIANGLE_MESH_SUN */
-      1826, /* GL_VERTEX_PROGRAM_ARB */
-      1837, /* GL_VERTEX_STATE_PROGRAM_NV */
-      1813, /* GL_VERTEX_ATTRIB_ARRAY_ENABLED */
-      1819, /* GL_VERTEX_ATTRIB_ARRAY_SIZE */
-      1821, /* GL_VERTEX_ATTRIB_ARRAY_STRIDE */
-      1823, /* GL_VERTEX_ATTRIB_ARRAY_TYPE */
+      1750, /* GL_TRIANGLE_MESH_SUN */
+      1830, /* GL_VERTEX_PROGRAM_ARB */
+      1841, /* GL_VERTEX_STATE_PROGRAM_NV */
+      1817, /* GL_VERTEX_ATTRIB_ARRAY_ENABLED */
+      1823, /* GL_VERTEX_ATTRIB_ARRAY_SIZE */
+      1825, /* GL_VERTEX_ATTRIB_ARRAY_STRIDE */
+      1827, /* GL_VERTEX_ATTRIB_ARRAY_TYPE */
        334, /* GL_CURRENT_VERTEX_ATTRIB */
       1228, /* GL_PROGRAM_LENGTH_ARB */
       1242, /* GL_PROGRAM_STRING_ARB */
        986, /* GL_MODELVIEW_PROJECTION_NV */
        615, /* GL_IDENTITY_NV */
        662, /* GL_INVERSE_NV */
-      1739, /* GL_TRANSPOSE_NV */
+      1743, /* GL_TRANSPOSE_NV */
        663, /* GL_INVERSE_TRANSPOSE_NV */
        893, /* GL_MAX_PROGRAM_MATRIX_STACK_DEPTH_ARB */
        892, /* GL_MAX_PROGRAM_MATRICES_ARB */
@@ -4626,33 +4634,33 @@ static const unsigned reduced_enums[1347] =
        836, /* GL_MATRIX7_NV */
        318, /* GL_CURRENT_MATRIX_STACK_DEPTH_ARB */
        315, /* GL_CURRENT_MATRIX_ARB */
-      1829, /* GL_VERTEX_PROGRAM_POINT_SIZE */
-      1832, /* GL_VERTEX_PROGRAM_TWO_SIDE */
+      1833, /* GL_VERTEX_PROGRAM_POINT_SIZE */
+      1836, /* GL_VERTEX_PROGRAM_TWO_SIDE */
       1240, /* GL_PROGRAM_PARAMETER_NV */
-      1817, /* GL_VERTEX_ATTRIB_ARRAY_POINTER */
+      1821, /* GL_VERTEX_ATTRIB_ARRAY_POINTER */
       1244, /* GL_PROGRAM_TARGET_NV */
       1241, /* GL_PROGRAM_RESIDENT_NV */
-      1731, /* GL_TRACK_MATRIX_NV */
-      1732, /* GL_TRACK_MATRIX_TRANSFORM_NV */
-      1827, /* GL_VERTEX_PROGRAM_BINDING_NV */
+      1735, /* GL_TRACK_MATRIX_NV */
+      1736, /* GL_TRACK_MATRIX_TRANSFORM_NV */
+      1831, /* GL_VERTEX_PROGRAM_BINDING_NV */
       1222, /* GL_PROGRAM_ERROR_POSITION_ARB */
        355, /* GL_DEPTH_CLAMP */
-      1795, /* GL_VERTEX_ATTRIB_ARRAY0_NV */
-      1802, /* GL_VERTEX_ATTRIB_ARRAY1_NV */
-      1803, /* GL_VERTEX_ATTRIB_ARRAY2_NV */
-      1804, /* GL_VERTEX_ATTRIB_ARRAY3_NV */
-      1805, /* GL_VERTEX_ATTRIB_ARRAY4_NV */
-      1806, /* GL_VERTEX_ATTRIB_ARRAY5_NV */
-      1807, /* GL_VERTEX_ATTRIB_ARRAY6_NV */
-      1808, /* GL_VERTEX_ATTRIB_ARRAY7_NV */
-      1809, /* GL_VERTEX_ATTRIB_ARRAY8_NV */
-      1810, /* GL_VERTEX_ATTRIB_ARRAY9_NV */
-      1796, /* GL_VERTEX_ATTRIB_ARRAY10_NV */
-      1797, /* GL_VERTEX_ATTRIB_ARRAY11_NV */
-      1798, /* GL_VERTEX_ATTRIB_ARRAY12_NV */
-      1799, /* GL_VERTEX_ATTRIB_ARRAY13_NV */
-      1800, /* GL_VERTEX_ATTRIB_ARRAY14_NV */
-      1801, /* GL_VERTEX_ATTRIB_ARRAY15_NV */
+      1799, /* GL_VERTEX_ATTRIB_ARRAY0_NV */
+      1806, /* GL_VERTEX_ATTRIB_ARRAY1_NV */
+      1807, /* GL_VERTEX_ATTRIB_ARRAY2_NV */
+      1808, /* GL_VERTEX_ATTRIB_ARRAY3_NV */
+      1809, /* GL_VERTEX_ATTRIB_ARRAY4_NV */
+      1810, /* GL_VERTEX_ATTRIB_ARRAY5_NV */
+      1811, /* GL_VERTEX_ATTRIB_ARRAY6_NV */
+      1812, /* GL_VERTEX_ATTRIB_ARRAY7_NV */
+      1813, /* GL_VERTEX_ATTRIB_ARRAY8_NV */
+      1814, /* GL_VERTEX_ATTRIB_ARRAY9_NV */
+      1800, /* GL_VERTEX_ATTRIB_ARRAY10_NV */
+      1801, /* GL_VERTEX_ATTRIB_ARRAY11_NV */
+      1802, /* GL_VERTEX_ATTRIB_ARRAY12_NV */
+      1803, /* GL_VERTEX_ATTRIB_ARRAY13_NV */
+      1804, /* GL_VERTEX_ATTRIB_ARRAY14_NV */
+      1805, /* GL_VERTEX_ATTRIB_ARRAY15_NV */
        748, /* GL_MAP1_VERTEX_ATTRIB0_4_NV */
        755, /* GL_MAP1_VERTEX_ATTRIB1_4_NV */
        756, /* GL_MAP1_VERTEX_ATTRIB2_4_NV */
@@ -4685,27 +4693,27 @@ static const unsigned reduced_enums[1347] =
        779, /* GL_MAP2_VERTEX_ATTRIB13_4_NV */
        780, /* GL_MAP2_VERTEX_ATTRIB14_4_NV */
        781, /* GL_MAP2_VERTEX_ATTRIB15_4_NV */
-      1647, /* GL_TEXTURE_COMPRESSED_IMAGE_SIZE */
-      1644, /* GL_TEXTURE_COMPRESSED */
+      1651, /* GL_TEXTURE_COMPRESSED_IMAGE_SIZE */
+      1648, /* GL_TEXTURE_COMPRESSED */
       1025, /* GL_NUM_COMPRESSED_TEXTURE_FORMATS */
        269, /* GL_COMPRESSED_TEXTURE_FORMATS */
        934, /* GL_MAX_VERTEX_UNITS_ARB */
         22, /* GL_ACTIVE_VERTEX_UNITS_ARB */
-      1848, /* GL_WEIGHT_SUM_UNITY_ARB */
-      1825, /* GL_VERTEX_BLEND_ARB */
+      1852, /* GL_WEIGHT_SUM_UNITY_ARB */
+      1829, /* GL_VERTEX_BLEND_ARB */
        336, /* GL_CURRENT_WEIGHT_ARB */
-      1847, /* GL_WEIGHT_ARRAY_TYPE_ARB */
-      1846, /* GL_WEIGHT_ARRAY_STRIDE_ARB */
-      1845, /* GL_WEIGHT_ARRAY_SIZE_ARB */
-      1844, /* GL_WEIGHT_ARRAY_POINTER_ARB */
-      1841, /* GL_WEIGHT_ARRAY_ARB */
+      1851, /* GL_WEIGHT_ARRAY_TYPE_ARB */
+      1850, /* GL_WEIGHT_ARRAY_STRIDE_ARB */
+      1849, /* GL_WEIGHT_ARRAY_SIZE_ARB */
+      1848, /* GL_WEIGHT_ARRAY_POINTER_ARB */
+      1845, /* GL_WEIGHT_ARRAY_ARB */
        384, /* GL_DOT3_RGB */
        385, /* GL_DOT3_RGBA */
        263, /* GL_COMPRESSED_RGB_FXT1_3DFX */
        258, /* GL_COMPRESSED_RGBA_FXT1_3DFX */
        994, /* GL_MULTISAMPLE_3DFX */
-      1387, /* GL_SAMPLE_BUFFERS_3DFX */
-      1378, /* GL_SAMPLES_3DFX */
+      1391, /* GL_SAMPLE_BUFFERS_3DFX */
+      1382, /* GL_SAMPLES_3DFX */
        975, /* GL_MODELVIEW2_ARB */
        978, /* GL_MODELVIEW3_ARB */
        979, /* GL_MODELVIEW4_ARB */
@@ -4743,7 +4751,7 @@ static const unsigned reduced_enums[1347] =
        989, /* GL_MODULATE_ADD_ATI */
        990, /* GL_MODULATE_SIGNED_ADD_ATI */
        991, /* GL_MODULATE_SUBTRACT_ATI */
-      1854, /* GL_YCBCR_MESA */
+      1858, /* GL_YCBCR_MESA */
       1081, /* GL_PACK_INVERT_MESA */
        339, /* GL_DEBUG_OBJECT_MESA */
        340, /* GL_DEBUG_PRINT_MESA */
@@ -4758,10 +4766,10 @@ static const unsigned reduced_enums[1347] =
        447, /* GL_DU8DV8_ATI */
        114, /* GL_BUMP_ENVMAP_ATI */
        118, /* GL_BUMP_TARGET_ATI */
-      1486, /* GL_STENCIL_BACK_FUNC */
-      1484, /* GL_STENCIL_BACK_FAIL */
-      1488, /* GL_STENCIL_BACK_PASS_DEPTH_FAIL */
-      1490, /* GL_STENCIL_BACK_PASS_DEPTH_PASS */
+      1490, /* GL_STENCIL_BACK_FUNC */
+      1488, /* GL_STENCIL_BACK_FAIL */
+      1492, /* GL_STENCIL_BACK_PASS_DEPTH_FAIL */
+      1494, /* GL_STENCIL_BACK_PASS_DEPTH_PASS */
        532, /* GL_FRAGMENT_PROGRAM_ARB */
       1219, /* GL_PROGRAM_ALU_INSTRUCTIONS_ARB */
       1247, /* GL_PROGRAM_TEX_INSTRUCTIONS_ARB */
@@ -4803,20 +4811,20 @@ static const unsigned reduced_enums[1347] =
        843, /* GL_MATRIX_INDEX_ARRAY_TYPE_ARB */
        842, /* GL_MATRIX_INDEX_ARRAY_STRIDE_ARB */
        840, /* GL_MATRIX_INDEX_ARRAY_POINTER_ARB */
-      1674, /* GL_TEXTURE_DEPTH_SIZE */
+      1678, /* GL_TEXTURE_DEPTH_SIZE */
        377, /* GL_DEPTH_TEXTURE_MODE */
-      1639, /* GL_TEXTURE_COMPARE_MODE */
-      1637, /* GL_TEXTURE_COMPARE_FUNC */
+      1643, /* GL_TEXTURE_COMPARE_MODE */
+      1641, /* GL_TEXTURE_COMPARE_FUNC */
        242, /* GL_COMPARE_R_TO_TEXTURE */
       1153, /* GL_POINT_SPRITE */
        296, /* GL_COORD_REPLACE */
       1157, /* GL_POINT_SPRITE_R_MODE_NV */
-      1276, /* GL_QUERY_COUNTER_BITS */
+      1278, /* GL_QUERY_COUNTER_BITS */
        323, /* GL_CURRENT_QUERY */
-      1278, /* GL_QUERY_RESULT */
-      1280, /* GL_QUERY_RESULT_AVAILABLE */
+      1281, /* GL_QUERY_RESULT */
+      1283, /* GL_QUERY_RESULT_AVAILABLE */
        928, /* GL_MAX_VERTEX_ATTRIBS */
-      1815, /* GL_VERTEX_ATTRIB_ARRAY_NORMALIZED */
+      1819, /* GL_VERTEX_ATTRIB_ARRAY_NORMALIZED */
        375, /* GL_DEPTH_STENCIL_TO_RGBA_NV */
        374, /* GL_DEPTH_STENCIL_TO_BGRA_NV */
        914, /* GL_MAX_TEXTURE_COORDS */
@@ -4824,23 +4832,23 @@ static const unsigned reduced_enums[1347] =
       1224, /* GL_PROGRAM_ERROR_STRING_ARB */
       1226, /* GL_PROGRAM_FORMAT_ASCII_ARB */
       1225, /* GL_PROGRAM_FORMAT_ARB */
-      1723, /* GL_TEXTURE_UNSIGNED_REMAP_MODE_NV */
+      1727, /* GL_TEXTURE_UNSIGNED_REMAP_MODE_NV */
        353, /* GL_DEPTH_BOUNDS_TEST_EXT */
        352, /* GL_DEPTH_BOUNDS_EXT */
         53, /* GL_ARRAY_BUFFER */
        461, /* GL_ELEMENT_ARRAY_BUFFER */
         54, /* GL_ARRAY_BUFFER_BINDING */
        462, /* GL_ELEMENT_ARRAY_BUFFER_BINDING */
-      1789, /* GL_VERTEX_ARRAY_BUFFER_BINDING */
+      1793, /* GL_VERTEX_ARRAY_BUFFER_BINDING */
       1015, /* GL_NORMAL_ARRAY_BUFFER_BINDING */
        149, /* GL_COLOR_ARRAY_BUFFER_BINDING */
        624, /* GL_INDEX_ARRAY_BUFFER_BINDING */
-      1652, /* GL_TEXTURE_COORD_ARRAY_BUFFER_BINDING */
+      1656, /* GL_TEXTURE_COORD_ARRAY_BUFFER_BINDING */
        457, /* GL_EDGE_FLAG_ARRAY_BUFFER_BINDING */
-      1399, /* GL_SECONDARY_COLOR_ARRAY_BUFFER_BINDING */
+      1403, /* GL_SECONDARY_COLOR_ARRAY_BUFFER_BINDING */
        510, /* GL_FOG_COORDINATE_ARRAY_BUFFER_BINDING */
-      1842, /* GL_WEIGHT_ARRAY_BUFFER_BINDING */
-      1811, /* GL_VERTEX_ATTRIB_ARRAY_BUFFER_BINDING */
+      1846, /* GL_WEIGHT_ARRAY_BUFFER_BINDING */
+      1815, /* GL_VERTEX_ATTRIB_ARRAY_BUFFER_BINDING */
       1227, /* GL_PROGRAM_INSTRUCTIONS_ARB */
        888, /* GL_MAX_PROGRAM_INSTRUCTIONS_ARB */
       1233, /* GL_PROGRAM_NATIVE_INSTRUCTIONS_ARB */
@@ -4864,14 +4872,14 @@ static const unsigned reduced_enums[1347] =
        889, /* GL_MAX_PROGRAM_LOCAL_PARAMETERS_ARB */
        885, /* GL_MAX_PROGRAM_ENV_PARAMETERS_ARB */
       1248, /* GL_PROGRAM_UNDER_NATIVE_LIMITS_ARB */
-      1736, /* GL_TRANSPOSE_CURRENT_MATRIX_ARB */
-      1289, /* GL_READ_ONLY */
-      1850, /* GL_WRITE_ONLY */
-      1291, /* GL_READ_WRITE */
+      1740, /* GL_TRANSPOSE_CURRENT_MATRIX_ARB */
+      1293, /* GL_READ_ONLY */
+      1854, /* GL_WRITE_ONLY */
+      1295, /* GL_READ_WRITE */
        102, /* GL_BUFFER_ACCESS */
        105, /* GL_BUFFER_MAPPED */
        107, /* GL_BUFFER_MAP_POINTER */
-      1730, /* GL_TIME_ELAPSED_EXT */
+      1734, /* GL_TIME_ELAPSED_EXT */
        799, /* GL_MATRIX0_ARB */
        811, /* GL_MATRIX1_ARB */
        823, /* GL_MATRIX2_ARB */
@@ -4904,12 +4912,12 @@ static const unsigned reduced_enums[1347] =
        822, /* GL_MATRIX29_ARB */
        825, /* GL_MATRIX30_ARB */
        826, /* GL_MATRIX31_ARB */
-      1519, /* GL_STREAM_DRAW */
-      1521, /* GL_STREAM_READ */
-      1517, /* GL_STREAM_COPY */
-      1477, /* GL_STATIC_DRAW */
-      1479, /* GL_STATIC_READ */
-      1475, /* GL_STATIC_COPY */
+      1523, /* GL_STREAM_DRAW */
+      1525, /* GL_STREAM_READ */
+      1521, /* GL_STREAM_COPY */
+      1481, /* GL_STATIC_DRAW */
+      1483, /* GL_STATIC_READ */
+      1479, /* GL_STATIC_COPY */
        451, /* GL_DYNAMIC_DRAW */
        453, /* GL_DYNAMIC_READ */
        449, /* GL_DYNAMIC_COPY */
@@ -4918,30 +4926,30 @@ static const unsigned reduced_enums[1347] =
       1122, /* GL_PIXEL_PACK_BUFFER_BINDING */
       1126, /* GL_PIXEL_UNPACK_BUFFER_BINDING */
        347, /* GL_DEPTH24_STENCIL8 */
-      1720, /* GL_TEXTURE_STENCIL_SIZE */
-      1672, /* GL_TEXTURE_CUBE_MAP_SEAMLESS */
+      1724, /* GL_TEXTURE_STENCIL_SIZE */
+      1676, /* GL_TEXTURE_CUBE_MAP_SEAMLESS */
        884, /* GL_MAX_PROGRAM_CALL_DEPTH_NV */
        887, /* GL_MAX_PROGRAM_IF_DEPTH_NV */
        891, /* GL_MAX_PROGRAM_LOOP_DEPTH_NV */
        890, /* GL_MAX_PROGRAM_LOOP_COUNT_NV */
        848, /* GL_MAX_ARRAY_TEXTURE_LAYERS_EXT */
-      1510, /* GL_STENCIL_TEST_TWO_SIDE_EXT */
+      1514, /* GL_STENCIL_TEST_TWO_SIDE_EXT */
         17, /* GL_ACTIVE_STENCIL_FACE_EXT */
        949, /* GL_MIRROR_CLAMP_TO_BORDER_EXT */
-      1380, /* GL_SAMPLES_PASSED */
+      1384, /* GL_SAMPLES_PASSED */
        109, /* GL_BUFFER_SERIALIZED_MODIFY_APPLE */
        104, /* GL_BUFFER_FLUSHING_UNMAP_APPLE */
        533, /* GL_FRAGMENT_SHADER */
-      1835, /* GL_VERTEX_SHADER */
+      1839, /* GL_VERTEX_SHADER */
       1238, /* GL_PROGRAM_OBJECT_ARB */
-      1412, /* GL_SHADER_OBJECT_ARB */
+      1416, /* GL_SHADER_OBJECT_ARB */
        872, /* GL_MAX_FRAGMENT_UNIFORM_COMPONENTS */
        932, /* GL_MAX_VERTEX_UNIFORM_COMPONENTS */
        926, /* GL_MAX_VARYING_FLOATS */
        930, /* GL_MAX_VERTEX_TEXTURE_IMAGE_UNITS */
        857, /* GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS */
       1041, /* GL_OBJECT_TYPE_ARB */
-      1414, /* GL_SHADER_TYPE */
+      1418, /* GL_SHADER_TYPE */
        498, /* GL_FLOAT_VEC2 */
        500, /* GL_FLOAT_VEC3 */
        502, /* GL_FLOAT_VEC4 */
@@ -4955,12 +4963,12 @@ static const unsigned reduced_enums[1347] =
        486, /* GL_FLOAT_MAT2 */
        490, /* GL_FLOAT_MAT3 */
        494, /* GL_FLOAT_MAT4 */
-      1371, /* GL_SAMPLER_1D */
-      1373, /* GL_SAMPLER_2D */
-      1375, /* GL_SAMPLER_3D */
-      1376, /* GL_SAMPLER_CUBE */
-      1372, /* GL_SAMPLER_1D_SHADOW */
-      1374, /* GL_SAMPLER_2D_SHADOW */
+      1375, /* GL_SAMPLER_1D */
+      1377, /* GL_SAMPLER_2D */
+      1379, /* GL_SAMPLER_3D */
+      1380, /* GL_SAMPLER_CUBE */
+      1376, /* GL_SAMPLER_1D_SHADOW */
+      1378, /* GL_SAMPLER_2D_SHADOW */
        488, /* GL_FLOAT_MAT2x3 */
        489, /* GL_FLOAT_MAT2x4 */
        492, /* GL_FLOAT_MAT3x2 */
@@ -4970,16 +4978,16 @@ static const unsigned reduced_enums[1347] =
        345, /* GL_DELETE_STATUS */
        246, /* GL_COMPILE_STATUS */
        706, /* GL_LINK_STATUS */
-      1783, /* GL_VALIDATE_STATUS */
+      1787, /* GL_VALIDATE_STATUS */
        636, /* GL_INFO_LOG_LENGTH */
         56, /* GL_ATTACHED_SHADERS */
         20, /* GL_ACTIVE_UNIFORMS */
         21, /* GL_ACTIVE_UNIFORM_MAX_LENGTH */
-      1413, /* GL_SHADER_SOURCE_LENGTH */
+      1417, /* GL_SHADER_SOURCE_LENGTH */
         15, /* GL_ACTIVE_ATTRIBUTES */
         16, /* GL_ACTIVE_ATTRIBUTE_MAX_LENGTH */
        535, /* GL_FRAGMENT_SHADER_DERIVATIVE_HINT */
-      1416, /* GL_SHADING_LANGUAGE_VERSION */
+      1420, /* GL_SHADING_LANGUAGE_VERSION */
        322, /* GL_CURRENT_PROGRAM */
       1090, /* GL_PALETTE4_RGB8_OES */
       1092, /* GL_PALETTE4_RGBA8_OES */
@@ -4993,37 +5001,37 @@ static const unsigned reduced_enums[1347] =
       1094, /* GL_PALETTE8_RGB5_A1_OES */
        618, /* GL_IMPLEMENTATION_COLOR_READ_TYPE_OES */
        617, /* GL_IMPLEMENTATION_COLOR_READ_FORMAT_OES */
-      1768, /* GL_UNSIGNED_NORMALIZED */
-      1607, /* GL_TEXTURE_1D_ARRAY_EXT */
+      1772, /* GL_UNSIGNED_NORMALIZED */
+      1611, /* GL_TEXTURE_1D_ARRAY_EXT */
       1259, /* GL_PROXY_TEXTURE_1D_ARRAY_EXT */
-      1609, /* GL_TEXTURE_2D_ARRAY_EXT */
+      1613, /* GL_TEXTURE_2D_ARRAY_EXT */
       1262, /* GL_PROXY_TEXTURE_2D_ARRAY_EXT */
-      1615, /* GL_TEXTURE_BINDING_1D_ARRAY_EXT */
-      1617, /* GL_TEXTURE_BINDING_2D_ARRAY_EXT */
-      1469, /* GL_SRGB */
-      1470, /* GL_SRGB8 */
-      1472, /* GL_SRGB_ALPHA */
-      1471, /* GL_SRGB8_ALPHA8 */
-      1429, /* GL_SLUMINANCE_ALPHA */
-      1428, /* GL_SLUMINANCE8_ALPHA8 */
-      1426, /* GL_SLUMINANCE */
-      1427, /* GL_SLUMINANCE8 */
+      1619, /* GL_TEXTURE_BINDING_1D_ARRAY_EXT */
+      1621, /* GL_TEXTURE_BINDING_2D_ARRAY_EXT */
+      1473, /* GL_SRGB */
+      1474, /* GL_SRGB8 */
+      1476, /* GL_SRGB_ALPHA */
+      1475, /* GL_SRGB8_ALPHA8 */
+      1433, /* GL_SLUMINANCE_ALPHA */
+      1432, /* GL_SLUMINANCE8_ALPHA8 */
+      1430, /* GL_SLUMINANCE */
+      1431, /* GL_SLUMINANCE8 */
        267, /* GL_COMPRESSED_SRGB */
        268, /* GL_COMPRESSED_SRGB_ALPHA */
        265, /* GL_COMPRESSED_SLUMINANCE */
        266, /* GL_COMPRESSED_SLUMINANCE_ALPHA */
       1155, /* GL_POINT_SPRITE_COORD_ORIGIN */
        714, /* GL_LOWER_LEFT */
-      1780, /* GL_UPPER_LEFT */
-      1492, /* GL_STENCIL_BACK_REF */
-      1493, /* GL_STENCIL_BACK_VALUE_MASK */
-      1494, /* GL_STENCIL_BACK_WRITEMASK */
+      1784, /* GL_UPPER_LEFT */
+      1496, /* GL_STENCIL_BACK_REF */
+      1497, /* GL_STENCIL_BACK_VALUE_MASK */
+      1498, /* GL_STENCIL_BACK_WRITEMASK */
        442, /* GL_DRAW_FRAMEBUFFER_BINDING_EXT */
-      1305, /* GL_RENDERBUFFER_BINDING_EXT */
-      1286, /* GL_READ_FRAMEBUFFER */
+      1309, /* GL_RENDERBUFFER_BINDING_EXT */
+      1290, /* GL_READ_FRAMEBUFFER */
        441, /* GL_DRAW_FRAMEBUFFER */
-      1287, /* GL_READ_FRAMEBUFFER_BINDING_EXT */
-      1315, /* GL_RENDERBUFFER_SAMPLES */
+      1291, /* GL_READ_FRAMEBUFFER_BINDING_EXT */
+      1319, /* GL_RENDERBUFFER_SAMPLES */
        545, /* GL_FRAMEBUFFER_ATTACHMENT_OBJECT_TYPE */
        543, /* GL_FRAMEBUFFER_ATTACHMENT_OBJECT_NAME */
        554, /* GL_FRAMEBUFFER_ATTACHMENT_TEXTURE_LEVEL */
@@ -5057,56 +5065,60 @@ static const unsigned reduced_enums[1347] =
        166, /* GL_COLOR_ATTACHMENT14 */
        168, /* GL_COLOR_ATTACHMENT15 */
        348, /* GL_DEPTH_ATTACHMENT */
-      1482, /* GL_STENCIL_ATTACHMENT */
+      1486, /* GL_STENCIL_ATTACHMENT */
        536, /* GL_FRAMEBUFFER */
-      1303, /* GL_RENDERBUFFER */
-      1317, /* GL_RENDERBUFFER_WIDTH */
-      1310, /* GL_RENDERBUFFER_HEIGHT */
-      1312, /* GL_RENDERBUFFER_INTERNAL_FORMAT */
-      1505, /* GL_STENCIL_INDEX_EXT */
-      1502, /* GL_STENCIL_INDEX1_EXT */
-      1503, /* GL_STENCIL_INDEX4_EXT */
-      1504, /* GL_STENCIL_INDEX8_EXT */
-      1501, /* GL_STENCIL_INDEX16_EXT */
-      1314, /* GL_RENDERBUFFER_RED_SIZE */
-      1309, /* GL_RENDERBUFFER_GREEN_SIZE */
-      1306, /* GL_RENDERBUFFER_BLUE_SIZE */
-      1304, /* GL_RENDERBUFFER_ALPHA_SIZE */
-      1307, /* GL_RENDERBUFFER_DEPTH_SIZE */
-      1316, /* GL_RENDERBUFFER_STENCIL_SIZE */
+      1307, /* GL_RENDERBUFFER */
+      1321, /* GL_RENDERBUFFER_WIDTH */
+      1314, /* GL_RENDERBUFFER_HEIGHT */
+      1316, /* GL_RENDERBUFFER_INTERNAL_FORMAT */
+      1509, /* GL_STENCIL_INDEX_EXT */
+      1506, /* GL_STENCIL_INDEX1_EXT */
+      1507, /* GL_STENCIL_INDEX4_EXT */
+      1508, /* GL_STENCIL_INDEX8_EXT */
+      1505, /* GL_STENCIL_INDEX16_EXT */
+      1318, /* GL_RENDERBUFFER_RED_SIZE */
+      1313, /* GL_RENDERBUFFER_GREEN_SIZE */
+      1310, /* GL_RENDERBUFFER_BLUE_SIZE */
+      1308, /* GL_RENDERBUFFER_ALPHA_SIZE */
+      1311, /* GL_RENDERBUFFER_DEPTH_SIZE */
+      1320, /* GL_RENDERBUFFER_STENCIL_SIZE */
        569, /* GL_FRAMEBUFFER_INCOMPLETE_MULTISAMPLE */
        910, /* GL_MAX_SAMPLES */
+      1285, /* GL_QUERY_WAIT_NV */
+      1280, /* GL_QUERY_NO_WAIT_NV */
+      1277, /* GL_QUERY_BY_REGION_WAIT_NV */
+      1276, /* GL_QUERY_BY_REGION_NO_WAIT_NV */
       1273, /* GL_QUADS_FOLLOW_PROVOKING_VERTEX_CONVENTION_EXT */
        483, /* GL_FIRST_VERTEX_CONVENTION_EXT */
        666, /* GL_LAST_VERTEX_CONVENTION_EXT */
       1252, /* GL_PROVOKING_VERTEX_EXT */
        302, /* GL_COPY_READ_BUFFER */
        303, /* GL_COPY_WRITE_BUFFER */
-      1364, /* GL_RGBA_SNORM */
-      1360, /* GL_RGBA8_SNORM */
-      1422, /* GL_SIGNED_NORMALIZED */
+      1368, /* GL_RGBA_SNORM */
+      1364, /* GL_RGBA8_SNORM */
+      1426, /* GL_SIGNED_NORMALIZED */
        911, /* GL_MAX_SERVER_WAIT_TIMEOUT */
       1040, /* GL_OBJECT_TYPE */
-      1526, /* GL_SYNC_CONDITION */
-      1531, /* GL_SYNC_STATUS */
-      1528, /* GL_SYNC_FLAGS */
-      1527, /* GL_SYNC_FENCE */
-      1530, /* GL_SYNC_GPU_COMMANDS_COMPLETE */
-      1757, /* GL_UNSIGNALED */
-      1421, /* GL_SIGNALED */
+      1530, /* GL_SYNC_CONDITION */
+      1535, /* GL_SYNC_STATUS */
+      1532, /* GL_SYNC_FLAGS */
+      1531, /* GL_SYNC_FENCE */
+      1534, /* GL_SYNC_GPU_COMMANDS_COMPLETE */
+      1761, /* GL_UNSIGNALED */
+      1425, /* GL_SIGNALED */
         46, /* GL_ALREADY_SIGNALED */
-      1728, /* GL_TIMEOUT_EXPIRED */
+      1732, /* GL_TIMEOUT_EXPIRED */
        270, /* GL_CONDITION_SATISFIED */
-      1840, /* GL_WAIT_FAILED */
+      1844, /* GL_WAIT_FAILED */
        468, /* GL_EVAL_BIT */
-      1284, /* GL_RASTER_POSITION_UNCLIPPED_IBM */
+      1288, /* GL_RASTER_POSITION_UNCLIPPED_IBM */
        708, /* GL_LIST_BIT */
-      1623, /* GL_TEXTURE_BIT */
-      1395, /* GL_SCISSOR_BIT */
+      1627, /* GL_TEXTURE_BIT */
+      1399, /* GL_SCISSOR_BIT */
         29, /* GL_ALL_ATTRIB_BITS */
        996, /* GL_MULTISAMPLE_BIT */
         30, /* GL_ALL_CLIENT_ATTRIB_BITS */
-      1729, /* GL_TIMEOUT_IGNORED */
+      1733, /* GL_TIMEOUT_IGNORED */
 };
 
 typedef int (*cfunc)(const void *, const void *);
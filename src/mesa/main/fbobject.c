@@ -39,6 +39,7 @@
 #include "hash.h"
 #include "macros.h"
 #include "mipmap.h"
+#include "queryobj.h"
 #include "renderbuffer.h"
 #include "state.h"
 #include "teximage.h"
@@ -2096,6 +2097,9 @@ _mesa_BlitFramebufferEXT(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1,
       return;
    }
 
+   if (!_mesa_check_conditional_render(ctx))
+      return; /* don't blit */
+
    ASSERT(ctx->Driver.BlitFramebuffer);
    ctx->Driver.BlitFramebuffer(ctx,
                                srcX0, srcY0, srcX1, srcY1,
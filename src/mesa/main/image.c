@@ -3717,6 +3717,75 @@ extract_float_rgba(GLuint n, GLfloat rgba[][4],
 }
 
 
+/**
+ * Determine the byte offsets of the R, G, B and A components within a
+ * pixel of 8-bit-per-component data.  This covers GL_UNSIGNED_BYTE data
+ * in the RGB/BGR/RGBA/BGRA/ABGR layouts plus the packed 8_8_8_8 types,
+ * which are just a byte reordering of the same thing.
+ * Used by the no-transfer-op fast paths of the span unpackers below.
+ * \param offsets  returns the byte offset of each of R, G, B, A; the
+ *                 alpha offset is -1 if the source has no alpha.
+ * \return number of bytes per pixel, or 0 if not one of these cases.
+ */
+static GLint
+get_ubyte_rgba_offsets(GLenum srcFormat, GLenum srcType, GLboolean swapBytes,
+                       GLint offsets[4])
+{
+   GLboolean reverse;
+   GLint comps, i;
+
+   switch (srcFormat) {
+   case GL_RGB:
+      offsets[0] = 0;  offsets[1] = 1;  offsets[2] = 2;  offsets[3] = -1;
+      comps = 3;
+      break;
+   case GL_BGR:
+      offsets[0] = 2;  offsets[1] = 1;  offsets[2] = 0;  offsets[3] = -1;
+      comps = 3;
+      break;
+   case GL_RGBA:
+      offsets[0] = 0;  offsets[1] = 1;  offsets[2] = 2;  offsets[3] = 3;
+      comps = 4;
+      break;
+   case GL_BGRA:
+      offsets[0] = 2;  offsets[1] = 1;  offsets[2] = 0;  offsets[3] = 3;
+      comps = 4;
+      break;
+   case GL_ABGR_EXT:
+      offsets[0] = 3;  offsets[1] = 2;  offsets[2] = 1;  offsets[3] = 0;
+      comps = 4;
+      break;
+   default:
+      return 0;
+   }
+
+   switch (srcType) {
+   case GL_UNSIGNED_BYTE:
+      reverse = GL_FALSE;
+      break;
+   case GL_UNSIGNED_INT_8_8_8_8:
+      /* first component in the most significant byte */
+      reverse = (_mesa_little_endian() != swapBytes);
+      break;
+   case GL_UNSIGNED_INT_8_8_8_8_REV:
+      /* first component in the least significant byte */
+      reverse = (_mesa_little_endian() == swapBytes);
+      break;
+   default:
+      return 0;
+   }
+
+   if (reverse) {
+      if (comps != 4)
+         return 0;
+      for (i = 0; i < 4; i++)
+         offsets[i] = 3 - offsets[i];
+   }
+
+   return comps;
+}
+
+
 /*
  * Unpack a row of color image data from a client buffer according to
  * the pixel unpacking parameters.
@@ -3902,6 +3971,43 @@ _mesa_unpack_color_span_chan( GLcontext *ctx,
    }
 
 
+   /* Other 8-bit RGB/BGR/RGBA/BGRA/ABGR layouts: reorder the whole row
+    * directly instead of going through floats.
+    */
+   if (transferOps == 0 && (dstFormat == GL_RGBA || dstFormat == GL_RGB)) {
+      GLint offsets[4];
+      const GLint srcComps = get_ubyte_rgba_offsets(srcFormat, srcType,
+                                                    srcPacking->SwapBytes,
+                                                    offsets);
+      if (srcComps) {
+         const GLint rOff = offsets[0], gOff = offsets[1], bOff = offsets[2];
+         const GLint aOff = offsets[3];
+         const GLubyte *src = (const GLubyte *) source;
+         GLchan *dst = dest;
+         GLuint i;
+         if (dstFormat == GL_RGBA) {
+            for (i = 0; i < n; i++) {
+               dst[0] = UBYTE_TO_CHAN(src[rOff]);
+               dst[1] = UBYTE_TO_CHAN(src[gOff]);
+               dst[2] = UBYTE_TO_CHAN(src[bOff]);
+               dst[3] = aOff >= 0 ? UBYTE_TO_CHAN(src[aOff]) : CHAN_MAX;
+               src += srcComps;
+               dst += 4;
+            }
+         }
+         else {
+            for (i = 0; i < n; i++) {
+               dst[0] = UBYTE_TO_CHAN(src[rOff]);
+               dst[1] = UBYTE_TO_CHAN(src[gOff]);
+               dst[2] = UBYTE_TO_CHAN(src[bOff]);
+               src += srcComps;
+               dst += 3;
+            }
+         }
+         return;
+      }
+   }
+
    /* general solution begins here */
    {
       GLint dstComponents;
@@ -4122,7 +4228,49 @@ _mesa_unpack_color_span_float( GLcontext *ctx,
           srcType == GL_UNSIGNED_INT_10_10_10_2 ||
           srcType == GL_UNSIGNED_INT_2_10_10_10_REV);
 
-   /* general solution, no special cases, yet */
+   /* Try simple cases first */
+   if (transferOps == 0 && (dstFormat == GL_RGBA || dstFormat == GL_RGB)) {
+      GLint offsets[4], srcComps;
+
+      if (srcType == GL_FLOAT && srcFormat == dstFormat &&
+          !srcPacking->SwapBytes) {
+         const GLint comps = _mesa_components_in_format(srcFormat);
+         _mesa_memcpy(dest, source, n * comps * sizeof(GLfloat));
+         return;
+      }
+
+      srcComps = get_ubyte_rgba_offsets(srcFormat, srcType,
+                                        srcPacking->SwapBytes, offsets);
+      if (srcComps) {
+         const GLint rOff = offsets[0], gOff = offsets[1], bOff = offsets[2];
+         const GLint aOff = offsets[3];
+         const GLubyte *src = (const GLubyte *) source;
+         GLfloat *dst = dest;
+         GLuint i;
+         if (dstFormat == GL_RGBA) {
+            for (i = 0; i < n; i++) {
+               dst[0] = UBYTE_TO_FLOAT(src[rOff]);
+               dst[1] = UBYTE_TO_FLOAT(src[gOff]);
+               dst[2] = UBYTE_TO_FLOAT(src[bOff]);
+               dst[3] = aOff >= 0 ? UBYTE_TO_FLOAT(src[aOff]) : 1.0F;
+               src += srcComps;
+               dst += 4;
+            }
+         }
+         else {
+            for (i = 0; i < n; i++) {
+               dst[0] = UBYTE_TO_FLOAT(src[rOff]);
+               dst[1] = UBYTE_TO_FLOAT(src[gOff]);
+               dst[2] = UBYTE_TO_FLOAT(src[bOff]);
+               src += srcComps;
+               dst += 3;
+            }
+         }
+         return;
+      }
+   }
+
+   /* general solution */
    {
       GLint dstComponents;
       GLint dstRedIndex, dstGreenIndex, dstBlueIndex, dstAlphaIndex;
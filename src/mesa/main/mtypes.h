@@ -1502,6 +1502,23 @@ struct gl_viewport_attrib
 };
 
 
+/**
+ * Index bounds of a run of indices in a buffer object, cached so that
+ * static element buffers needn't be scanned on every glDrawElements.
+ * \sa vbo_get_minmax_index()
+ */
+struct gl_index_range
+{
+   GLintptr Offset;     /**< Byte offset of the first index */
+   GLsizei Count;       /**< Number of indices, 0 if the entry is unused */
+   GLenum Type;         /**< GL_UNSIGNED_BYTE/SHORT/INT */
+   GLuint Stamp;        /**< gl_buffer_object::WriteStamp when computed */
+   GLuint Min, Max;
+};
+
+#define MAX_INDEX_RANGES 8
+
+
 /**
  * GL_ARB_vertex/pixel_buffer_object buffer object
  */
@@ -1520,6 +1537,8 @@ struct gl_buffer_object
    GLsizeiptr Length;   /**< Mapped length */
    /*@}*/
    GLboolean Written;   /**< Ever written to? (for debugging) */
+   GLuint WriteStamp;   /**< Bumped whenever the contents may change */
+   struct gl_index_range IndexRanges[MAX_INDEX_RANGES];
 };
 
 
@@ -1985,6 +2004,10 @@ struct gl_query_state
    struct _mesa_HashTable *QueryObjects;
    struct gl_query_object *CurrentOcclusionObject; /* GL_ARB_occlusion_query */
    struct gl_query_object *CurrentTimerObject;     /* GL_EXT_timer_query */
+
+   /** GL_NV_conditional_render */
+   struct gl_query_object *CondRenderQuery;
+   GLenum CondRenderMode;
 };
 
 
@@ -2582,6 +2605,7 @@ struct gl_extensions
    GLboolean MESA_texture_array;
    GLboolean MESA_texture_signed_rgba;
    GLboolean NV_blend_square;
+   GLboolean NV_conditional_render;
    GLboolean NV_fragment_program;
    GLboolean NV_light_max_exponent;
    GLboolean NV_point_sprite;
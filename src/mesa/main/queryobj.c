@@ -25,6 +25,7 @@
 
 #include "glheader.h"
 #include "context.h"
+#include "enums.h"
 #include "hash.h"
 #include "imports.h"
 #include "queryobj.h"
@@ -199,6 +200,12 @@ _mesa_DeleteQueriesARB(GLsizei n, const GLuint *ids)
          struct gl_query_object *q = lookup_query_object(ctx, ids[i]);
          if (q) {
             ASSERT(!q->Active); /* should be caught earlier */
+            if (q == ctx->Query.CondRenderQuery) {
+               /* stop conditional rendering rather than keep a stale
+                * pointer around
+                */
+               _mesa_EndConditionalRender();
+            }
             _mesa_HashRemove(ctx->Query.QueryObjects, ids[i]);
             ctx->Driver.DeleteQuery(ctx, q);
          }
@@ -277,6 +284,11 @@ _mesa_BeginQueryARB(GLenum target, GLuint id)
                      "glBeginQueryARB(query already active)");
          return;
       }
+      if (q == ctx->Query.CondRenderQuery) {
+         _mesa_error(ctx, GL_INVALID_OPERATION,
+                     "glBeginQueryARB(query used for conditional rendering)");
+         return;
+      }
    }
 
    q->Target = target;
@@ -532,6 +544,105 @@ _mesa_GetQueryObjectui64vEXT(GLuint id, GLenum pname, GLuint64EXT *params)
 }
 
 
+/**
+ * GL_NV_conditional_render: until glEndConditionalRenderNV(), rendering
+ * commands are discarded if the samples-passed query 'query' counted
+ * no samples.
+ */
+void GLAPIENTRY
+_mesa_BeginConditionalRender(GLuint query, GLenum mode)
+{
+   struct gl_query_object *q;
+   GET_CURRENT_CONTEXT(ctx);
+   ASSERT_OUTSIDE_BEGIN_END(ctx);
+
+   if (!ctx->Extensions.NV_conditional_render || ctx->Query.CondRenderQuery) {
+      _mesa_error(ctx, GL_INVALID_OPERATION, "glBeginConditionalRender()");
+      return;
+   }
+
+   switch (mode) {
+   case GL_QUERY_WAIT_NV:
+   case GL_QUERY_NO_WAIT_NV:
+   case GL_QUERY_BY_REGION_WAIT_NV:
+   case GL_QUERY_BY_REGION_NO_WAIT_NV:
+      /* OK */
+      break;
+   default:
+      _mesa_error(ctx, GL_INVALID_ENUM, "glBeginConditionalRender(mode)");
+      return;
+   }
+
+   q = query ? lookup_query_object(ctx, query) : NULL;
+   if (!q) {
+      _mesa_error(ctx, GL_INVALID_VALUE,
+                  "glBeginConditionalRender(query=%u)", query);
+      return;
+   }
+
+   if (q->Active || q->Target != GL_SAMPLES_PASSED_ARB) {
+      _mesa_error(ctx, GL_INVALID_OPERATION, "glBeginConditionalRender()");
+      return;
+   }
+
+   FLUSH_VERTICES(ctx, 0x0);
+
+   ctx->Query.CondRenderQuery = q;
+   ctx->Query.CondRenderMode = mode;
+}
+
+
+void GLAPIENTRY
+_mesa_EndConditionalRender(void)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   ASSERT_OUTSIDE_BEGIN_END(ctx);
+
+   if (!ctx->Query.CondRenderQuery) {
+      _mesa_error(ctx, GL_INVALID_OPERATION, "glEndConditionalRender()");
+      return;
+   }
+
+   FLUSH_VERTICES(ctx, 0x0);
+
+   ctx->Query.CondRenderQuery = NULL;
+}
+
+
+/**
+ * Called by the rendering commands (drawing, clearing, pixel transfers
+ * to the framebuffer) to decide whether to go ahead.
+ * \return GL_FALSE if conditional rendering discards the command.
+ */
+GLboolean
+_mesa_check_conditional_render(GLcontext *ctx)
+{
+   struct gl_query_object *q = ctx->Query.CondRenderQuery;
+
+   if (!q)
+      return GL_TRUE;
+
+   switch (ctx->Query.CondRenderMode) {
+   case GL_QUERY_WAIT_NV:
+   case GL_QUERY_BY_REGION_WAIT_NV:
+      if (!q->Ready)
+         ctx->Driver.WaitQuery(ctx, q);
+      return q->Result > 0;
+   case GL_QUERY_NO_WAIT_NV:
+   case GL_QUERY_BY_REGION_NO_WAIT_NV:
+      /* render unconditionally if the result isn't in yet */
+      if (!q->Ready)
+         ctx->Driver.CheckQuery(ctx, q);
+      return q->Ready ? q->Result > 0 : GL_TRUE;
+   default:
+      _mesa_problem(ctx, "Bad cond render mode %s in "
+                    " _mesa_check_conditional_render()",
+                    _mesa_lookup_enum_by_nr(ctx->Query.CondRenderMode));
+      return GL_TRUE;
+   }
+}
+
+
 void
 _mesa_init_queryobj_dispatch(struct _glapi_table *disp)
 {
@@ -546,6 +657,9 @@ _mesa_init_queryobj_dispatch(struct _glapi_table *disp)
 
    SET_GetQueryObjecti64vEXT(disp, _mesa_GetQueryObjecti64vEXT);
    SET_GetQueryObjectui64vEXT(disp, _mesa_GetQueryObjectui64vEXT);
+
+   SET_BeginConditionalRenderNV(disp, _mesa_BeginConditionalRender);
+   SET_EndConditionalRenderNV(disp, _mesa_EndConditionalRender);
 }
 
 
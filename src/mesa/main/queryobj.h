@@ -72,6 +72,15 @@ _mesa_GetQueryObjecti64vEXT(GLuint id, GLenum pname, GLint64EXT *params);
 extern void GLAPIENTRY
 _mesa_GetQueryObjectui64vEXT(GLuint id, GLenum pname, GLuint64EXT *params);
 
+extern void GLAPIENTRY
+_mesa_BeginConditionalRender(GLuint query, GLenum mode);
+
+extern void GLAPIENTRY
+_mesa_EndConditionalRender(void);
+
+extern GLboolean
+_mesa_check_conditional_render(GLcontext *ctx);
+
 extern void
 _mesa_init_query_object_functions(struct dd_function_table *driver);
 
@@ -92,6 +101,12 @@ _mesa_init_queryobj_dispatch(struct _glapi_table *disp)
 {
 }
 
+static INLINE GLboolean
+_mesa_check_conditional_render(GLcontext *ctx)
+{
+   return GL_TRUE;
+}
+
 #endif /* FEATURE_queryobj */
 
 extern void
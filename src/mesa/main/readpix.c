@@ -203,6 +203,8 @@ _mesa_ReadPixels( GLint x, GLint y, GLsizei width, GLsizei height,
          _mesa_error(ctx, GL_INVALID_OPERATION, "glReadPixels(PBO is mapped)");
          return;
       }
+
+      _mesa_bufferobj_written(ctx->Pack.BufferObj);
    }
 
    ctx->Driver.ReadPixels(ctx, x, y, width, height,
@@ -514,6 +514,9 @@ _mesa_GetTexImage( GLenum target, GLint level, GLenum format,
    texUnit = _mesa_get_current_tex_unit(ctx);
    texObj = _mesa_select_tex_object(ctx, texUnit, target);
 
+   if (_mesa_is_bufferobj(ctx->Pack.BufferObj))
+      _mesa_bufferobj_written(ctx->Pack.BufferObj);
+
    _mesa_lock_texture(ctx, texObj);
    {
       struct gl_texture_image *texImage =
@@ -562,6 +565,8 @@ _mesa_GetCompressedTexImageARB(GLenum target, GLint level, GLvoid *img)
       texImage = _mesa_select_tex_image(ctx, texObj, target, level);
       if (texImage) {
          if (texImage->IsCompressed) {
+            if (_mesa_is_bufferobj(ctx->Pack.BufferObj))
+               _mesa_bufferobj_written(ctx->Pack.BufferObj);
             /* this typically calls _mesa_get_compressed_teximage() */
             ctx->Driver.GetCompressedTexImage(ctx, target, level, img,
                                               texObj, texImage);
@@ -332,12 +332,17 @@ _mesa_reference_texobj(struct gl_texture_object **ptr,
 
       ASSERT(valid_texture_object(oldTex));
 
+#ifdef _glthread_HAVE_ATOMICS
+      ASSERT(oldTex->RefCount > 0);
+      deleteFlag = (_glthread_ATOMIC_DEC(oldTex->RefCount) == 0);
+#else
       _glthread_LOCK_MUTEX(oldTex->Mutex);
       ASSERT(oldTex->RefCount > 0);
       oldTex->RefCount--;
 
       deleteFlag = (oldTex->RefCount == 0);
       _glthread_UNLOCK_MUTEX(oldTex->Mutex);
+#endif
 
       if (deleteFlag) {
          GET_CURRENT_CONTEXT(ctx);
@@ -354,6 +359,24 @@ _mesa_reference_texobj(struct gl_texture_object **ptr,
    if (tex) {
       /* reference new texture */
       ASSERT(valid_texture_object(tex));
+#ifdef _glthread_HAVE_ATOMICS
+      {
+         /* increment unless another thread just dropped it to zero */
+         GLint count;
+         do {
+            count = tex->RefCount;
+         } while (count != 0 &&
+                  !_glthread_ATOMIC_CMPXCHG(tex->RefCount, count, count + 1));
+
+         if (count == 0) {
+            _mesa_problem(NULL, "referencing deleted texture object");
+            *ptr = NULL;
+         }
+         else {
+            *ptr = tex;
+         }
+      }
+#else
       _glthread_LOCK_MUTEX(tex->Mutex);
       if (tex->RefCount == 0) {
          /* this texture's being deleted (look just above) */
@@ -366,6 +389,7 @@ _mesa_reference_texobj(struct gl_texture_object **ptr,
          *ptr = tex;
       }
       _glthread_UNLOCK_MUTEX(tex->Mutex);
+#endif
    }
 }
 
@@ -984,7 +1008,6 @@ _mesa_BindTexture( GLenum target, GLuint texName )
    struct gl_texture_unit *texUnit = &ctx->Texture.Unit[unit];
    struct gl_texture_object *newTexObj = NULL, *defaultTexObj = NULL;
    GLint targetIndex;
-   GLboolean early_out = GL_FALSE;
    ASSERT_OUTSIDE_BEGIN_END(ctx);
 
    if (MESA_VERBOSE & (VERBOSE_API|VERBOSE_TEXTURE))
@@ -1038,14 +1061,11 @@ _mesa_BindTexture( GLenum target, GLuint texName )
 
    assert(valid_texture_object(newTexObj));
 
-   _glthread_LOCK_MUTEX(ctx->Shared->Mutex);
+   /* No lock needed: the shared state's refcount only matters here to
+    * tell whether other contexts might have changed the object.
+    */
    if ((ctx->Shared->RefCount == 1)
        && (newTexObj == texUnit->CurrentTex[targetIndex])) {
-      early_out = GL_TRUE;
-   }
-   _glthread_UNLOCK_MUTEX(ctx->Shared->Mutex);
-
-   if (early_out) {
       return;
    }
 
@@ -649,6 +649,54 @@ _mesa_make_temp_chan_image(GLcontext *ctx, GLuint dims,
 }
 
 
+/**
+ * Specialized version of swizzle_copy() for 4-component source and
+ * destination pixels where every destination component comes from the
+ * source (no ZERO/ONE).  Each pixel is moved as one 32-bit word and the
+ * bytes are rearranged with shifts and masks instead of one at a time.
+ * Both pointers must be 4-byte aligned.
+ */
+static void
+swizzle_copy_4to4(GLuint *dst, const GLuint *src, const GLubyte *map,
+                  GLuint count)
+{
+   const GLboolean littleEndian = _mesa_little_endian();
+   GLuint i;
+
+   if (map[0] == 0 && map[1] == 1 && map[2] == 2 && map[3] == 3) {
+      _mesa_memcpy(dst, src, count * 4);
+   }
+   else if (map[0] == 3 && map[1] == 2 && map[2] == 1 && map[3] == 0) {
+      /* full byte reversal, independent of host byte order */
+      for (i = 0; i < count; i++) {
+         const GLuint p = src[i];
+         dst[i] = (p >> 24) | ((p >> 8) & 0xff00) |
+                  ((p << 8) & 0xff0000) | (p << 24);
+      }
+   }
+   else if (littleEndian &&
+            map[0] == 2 && map[1] == 1 && map[2] == 0 && map[3] == 3) {
+      /* RGBA <-> BGRA */
+      for (i = 0; i < count; i++) {
+         const GLuint p = src[i];
+         dst[i] = (p & 0xff00ff00) | ((p & 0xff) << 16) | ((p >> 16) & 0xff);
+      }
+   }
+   else {
+      GLuint shift[4], j;
+      for (j = 0; j < 4; j++)
+         shift[j] = littleEndian ? 8 * j : 8 * (3 - j);
+      for (i = 0; i < count; i++) {
+         const GLuint p = src[i];
+         dst[i] = (((p >> shift[map[0]]) & 0xff) << shift[0]) |
+                  (((p >> shift[map[1]]) & 0xff) << shift[1]) |
+                  (((p >> shift[map[2]]) & 0xff) << shift[2]) |
+                  (((p >> shift[map[3]]) & 0xff) << shift[3]);
+      }
+   }
+}
+
+
 /**
  * Copy GLubyte pixels from <src> to <dst> with swizzling.
  * \param dst  destination pixels
@@ -693,6 +741,13 @@ swizzle_copy(GLubyte *dst, GLuint dstComponents, const GLubyte *src,
    ASSERT(srcComponents <= 4);
    ASSERT(dstComponents <= 4);
 
+   if (dstComponents == 4 && srcComponents == 4 &&
+       map[0] < 4 && map[1] < 4 && map[2] < 4 && map[3] < 4 &&
+       (((uintptr_t) dst | (uintptr_t) src) & 3) == 0) {
+      swizzle_copy_4to4((GLuint *) dst, (const GLuint *) src, map, count);
+      return;
+   }
+
    switch (dstComponents) {
    case 4:
       switch (srcComponents) {
@@ -1286,37 +1341,47 @@ _mesa_texstore_rgb565(TEXSTORE_PARAMS)
    else if (!ctx->_ImageTransferState &&
             !srcPacking->SwapBytes &&
             baseInternalFormat == GL_RGB &&
-            srcFormat == GL_RGB &&
-            srcType == GL_UNSIGNED_BYTE &&
-            dims == 2) {
-      /* do optimized tex store */
+            (srcFormat == GL_RGB || srcFormat == GL_BGR ||
+             srcFormat == GL_RGBA || srcFormat == GL_BGRA) &&
+            srcType == GL_UNSIGNED_BYTE) {
+      /* do optimized tex store, packing straight from the user's ubyte
+       * pixels without going through a temporary GLchan image.
+       */
+      const GLint srcComps = _mesa_components_in_format(srcFormat);
+      const GLint rIdx = (srcFormat == GL_BGR || srcFormat == GL_BGRA) ? 2 : 0;
+      const GLint bIdx = 2 - rIdx;
       const GLint srcRowStride = _mesa_image_row_stride(srcPacking, srcWidth,
                                                         srcFormat, srcType);
-      const GLubyte *src = (const GLubyte *)
-         _mesa_image_address(dims, srcPacking, srcAddr, srcWidth, srcHeight,
-                             srcFormat, srcType, 0, 0, 0);
-      GLubyte *dst = (GLubyte *) dstAddr
-                   + dstYoffset * dstRowStride
-                   + dstXoffset * dstFormat->TexelBytes;
-      GLint row, col;
-      for (row = 0; row < srcHeight; row++) {
-         const GLubyte *srcUB = (const GLubyte *) src;
-         GLushort *dstUS = (GLushort *) dst;
-         /* check for byteswapped format */
-         if (dstFormat == &_mesa_texformat_rgb565) {
-            for (col = 0; col < srcWidth; col++) {
-               dstUS[col] = PACK_COLOR_565( srcUB[0], srcUB[1], srcUB[2] );
-               srcUB += 3;
+      GLint img, row, col;
+      for (img = 0; img < srcDepth; img++) {
+         const GLubyte *src = (const GLubyte *)
+            _mesa_image_address(dims, srcPacking, srcAddr, srcWidth, srcHeight,
+                                srcFormat, srcType, img, 0, 0);
+         GLubyte *dst = (GLubyte *) dstAddr
+            + dstImageOffsets[dstZoffset + img] * dstFormat->TexelBytes
+            + dstYoffset * dstRowStride
+            + dstXoffset * dstFormat->TexelBytes;
+         for (row = 0; row < srcHeight; row++) {
+            const GLubyte *srcUB = (const GLubyte *) src;
+            GLushort *dstUS = (GLushort *) dst;
+            /* check for byteswapped format */
+            if (dstFormat == &_mesa_texformat_rgb565) {
+               for (col = 0; col < srcWidth; col++) {
+                  dstUS[col] = PACK_COLOR_565( srcUB[rIdx], srcUB[1],
+                                               srcUB[bIdx] );
+                  srcUB += srcComps;
+               }
             }
-         }
-         else {
-            for (col = 0; col < srcWidth; col++) {
-               dstUS[col] = PACK_COLOR_565_REV( srcUB[0], srcUB[1], srcUB[2] );
-               srcUB += 3;
+            else {
+               for (col = 0; col < srcWidth; col++) {
+                  dstUS[col] = PACK_COLOR_565_REV( srcUB[rIdx], srcUB[1],
+                                                   srcUB[bIdx] );
+                  srcUB += srcComps;
+               }
             }
+            dst += dstRowStride;
+            src += srcRowStride;
          }
-         dst += dstRowStride;
-         src += srcRowStride;
       }
    }
    else {
@@ -1760,3 +1760,623 @@ _mesa_execute_program(GLcontext * ctx,
 
    return GL_TRUE;
 }
+
+
+/*
+ * Batched program execution.
+ *
+ * _mesa_execute_program() decodes every instruction and register
+ * reference for each vertex or fragment.  For straight-line programs
+ * (no branches, subroutines, condition codes or relative addressing)
+ * _mesa_execute_program_batch() instead decodes each instruction once
+ * and applies it to up to PROG_BATCH_SIZE elements in a row, each with
+ * its own set of temporary and output registers.  Texture instructions
+ * fetch the texels of the whole batch with one callback.
+ */
+
+
+/** A decoded source register reference */
+struct batch_src
+{
+   const GLfloat *ptr;   /**< register value for the first element */
+   GLuint stride;        /**< floats between elements (0 if uniform) */
+   GLuint swz[4];
+   GLboolean abs, negate;
+};
+
+
+/** Stands in for the unused sources of an instruction */
+static const struct batch_src ZeroSrc = {
+   ZeroVec, 0, { SWIZZLE_X, SWIZZLE_Y, SWIZZLE_Z, SWIZZLE_W },
+   GL_FALSE, GL_FALSE
+};
+
+
+/**
+ * Can the given program be executed by _mesa_execute_program_batch()?
+ * This is relatively cheap but should be done once per program change,
+ * not per batch.
+ */
+GLboolean
+_mesa_program_batchable(const struct gl_program *program)
+{
+   GLuint pc;
+
+   if (!program)
+      return GL_FALSE;
+
+   for (pc = 0; pc < program->NumInstructions; pc++) {
+      const struct prog_instruction *inst = program->Instructions + pc;
+      const GLuint numSrc = _mesa_num_inst_src_regs(inst->Opcode);
+      GLuint i;
+
+      switch (inst->Opcode) {
+      case OPCODE_ABS:
+      case OPCODE_ADD:
+      case OPCODE_CMP:
+      case OPCODE_COS:
+      case OPCODE_DP2:
+      case OPCODE_DP3:
+      case OPCODE_DP4:
+      case OPCODE_DPH:
+      case OPCODE_DST:
+      case OPCODE_EX2:
+      case OPCODE_FLR:
+      case OPCODE_FRC:
+      case OPCODE_KIL:
+      case OPCODE_LG2:
+      case OPCODE_LIT:
+      case OPCODE_LRP:
+      case OPCODE_MAD:
+      case OPCODE_MAX:
+      case OPCODE_MIN:
+      case OPCODE_MOV:
+      case OPCODE_MUL:
+      case OPCODE_NRM3:
+      case OPCODE_NRM4:
+      case OPCODE_POW:
+      case OPCODE_RCP:
+      case OPCODE_RSQ:
+      case OPCODE_SCS:
+      case OPCODE_SEQ:
+      case OPCODE_SGE:
+      case OPCODE_SGT:
+      case OPCODE_SIN:
+      case OPCODE_SLE:
+      case OPCODE_SLT:
+      case OPCODE_SNE:
+      case OPCODE_SUB:
+      case OPCODE_XPD:
+      case OPCODE_TEX:
+      case OPCODE_TXB:
+      case OPCODE_TXP:
+      case OPCODE_NOP:
+      case OPCODE_END:
+         break;
+      default:
+         return GL_FALSE;
+      }
+
+      for (i = 0; i < numSrc; i++) {
+         const struct prog_src_register *src = &inst->SrcReg[i];
+         if (src->RelAddr)
+            return GL_FALSE;
+         if (src->Negate != NEGATE_NONE && src->Negate != NEGATE_XYZW)
+            return GL_FALSE;
+         if (GET_SWZ(src->Swizzle, 0) > SWIZZLE_W ||
+             GET_SWZ(src->Swizzle, 1) > SWIZZLE_W ||
+             GET_SWZ(src->Swizzle, 2) > SWIZZLE_W ||
+             GET_SWZ(src->Swizzle, 3) > SWIZZLE_W)
+            return GL_FALSE;
+         switch (src->File) {
+         case PROGRAM_TEMPORARY:
+         case PROGRAM_INPUT:
+         case PROGRAM_OUTPUT:
+         case PROGRAM_LOCAL_PARAM:
+         case PROGRAM_ENV_PARAM:
+         case PROGRAM_STATE_VAR:
+         case PROGRAM_CONSTANT:
+         case PROGRAM_UNIFORM:
+         case PROGRAM_NAMED_PARAM:
+            break;
+         default:
+            return GL_FALSE;
+         }
+      }
+
+      if (_mesa_num_inst_dst_regs(inst->Opcode)) {
+         const struct prog_dst_register *dst = &inst->DstReg;
+         if (dst->RelAddr ||
+             dst->CondMask != COND_TR ||
+             inst->CondUpdate)
+            return GL_FALSE;
+         if (!(dst->File == PROGRAM_TEMPORARY &&
+               dst->Index < MAX_PROGRAM_TEMPS) &&
+             !(dst->File == PROGRAM_OUTPUT &&
+               dst->Index < MAX_PROGRAM_OUTPUTS))
+            return GL_FALSE;
+      }
+   }
+
+   return GL_TRUE;
+}
+
+
+/**
+ * Decode a source register reference.
+ * Mirrors get_src_register_pointer().
+ */
+static void
+decode_batch_src(const struct gl_program *program,
+                 struct gl_program_batch_machine *machine,
+                 GLfloat (*envParams)[4],
+                 const struct prog_src_register *source,
+                 struct batch_src *src)
+{
+   const GLint reg = source->Index;
+
+   src->ptr = ZeroVec;
+   src->stride = 0;
+
+   switch (source->File) {
+   case PROGRAM_TEMPORARY:
+      if (reg < MAX_PROGRAM_TEMPS) {
+         src->ptr = machine->Temporaries[reg][0];
+         src->stride = 4;
+      }
+      break;
+   case PROGRAM_INPUT:
+      if (reg < (GLint) machine->NumInputs && machine->Inputs[reg]) {
+         src->ptr = machine->Inputs[reg][0];
+         src->stride = 4;
+      }
+      break;
+   case PROGRAM_OUTPUT:
+      if (reg < MAX_PROGRAM_OUTPUTS) {
+         src->ptr = machine->Outputs[reg][0];
+         src->stride = 4;
+      }
+      break;
+   case PROGRAM_LOCAL_PARAM:
+      if (reg < MAX_PROGRAM_LOCAL_PARAMS)
+         src->ptr = program->LocalParams[reg];
+      break;
+   case PROGRAM_ENV_PARAM:
+      if (reg < MAX_PROGRAM_ENV_PARAMS)
+         src->ptr = envParams[reg];
+      break;
+   default:
+      if (reg < (GLint) program->Parameters->NumParameters)
+         src->ptr = program->Parameters->ParameterValues[reg];
+      break;
+   }
+
+   src->swz[0] = GET_SWZ(source->Swizzle, 0);
+   src->swz[1] = GET_SWZ(source->Swizzle, 1);
+   src->swz[2] = GET_SWZ(source->Swizzle, 2);
+   src->swz[3] = GET_SWZ(source->Swizzle, 3);
+   src->abs = source->Abs;
+   src->negate = source->Negate != NEGATE_NONE;
+}
+
+
+/**
+ * Fetch a decoded source register for element 'k'.
+ * Mirrors fetch_vector4().
+ */
+static INLINE void
+fetch_batch_src(const struct batch_src *src, GLuint k, GLfloat result[4])
+{
+   const GLfloat *v = src->ptr + k * src->stride;
+
+   result[0] = v[src->swz[0]];
+   result[1] = v[src->swz[1]];
+   result[2] = v[src->swz[2]];
+   result[3] = v[src->swz[3]];
+
+   if (src->abs) {
+      result[0] = FABSF(result[0]);
+      result[1] = FABSF(result[1]);
+      result[2] = FABSF(result[2]);
+      result[3] = FABSF(result[3]);
+   }
+   if (src->negate) {
+      result[0] = -result[0];
+      result[1] = -result[1];
+      result[2] = -result[2];
+      result[3] = -result[3];
+   }
+}
+
+
+/**
+ * Store 'value' into the destination register of element 'k'.
+ * Mirrors store_vector4() for instructions which don't use condition codes.
+ */
+static INLINE void
+store_batch_dst(const struct prog_instruction *inst, GLfloat (*dst)[4],
+                GLuint k, const GLfloat value[4])
+{
+   const GLuint writeMask = inst->DstReg.WriteMask;
+   GLfloat *d = dst[k];
+
+   if (inst->SaturateMode == SATURATE_ZERO_ONE) {
+      if (writeMask & WRITEMASK_X)
+         d[0] = CLAMP(value[0], 0.0F, 1.0F);
+      if (writeMask & WRITEMASK_Y)
+         d[1] = CLAMP(value[1], 0.0F, 1.0F);
+      if (writeMask & WRITEMASK_Z)
+         d[2] = CLAMP(value[2], 0.0F, 1.0F);
+      if (writeMask & WRITEMASK_W)
+         d[3] = CLAMP(value[3], 0.0F, 1.0F);
+   }
+   else {
+      if (writeMask & WRITEMASK_X)
+         d[0] = value[0];
+      if (writeMask & WRITEMASK_Y)
+         d[1] = value[1];
+      if (writeMask & WRITEMASK_Z)
+         d[2] = value[2];
+      if (writeMask & WRITEMASK_W)
+         d[3] = value[3];
+   }
+}
+
+
+/**
+ * Execute a TEX, TXB or TXP instruction for 'n' elements.
+ * Mirrors the corresponding cases of _mesa_execute_program() and
+ * fetch_texel().
+ */
+static void
+exec_batch_texture(GLcontext *ctx,
+                   const struct gl_program_batch_machine *machine,
+                   const struct prog_instruction *inst,
+                   const struct batch_src *coord,
+                   GLuint n, GLfloat (*dst)[4])
+{
+   const GLuint unit = machine->Samplers[inst->TexSrcUnit];
+   GLfloat texcoord[PROG_BATCH_SIZE][4], lodBias[PROG_BATCH_SIZE];
+   GLfloat color[PROG_BATCH_SIZE][4];
+   GLuint k;
+
+   for (k = 0; k < n; k++) {
+      fetch_batch_src(coord, k, texcoord[k]);
+      lodBias[k] = 0.0F;
+   }
+
+   if (inst->Opcode == OPCODE_TXP) {
+      for (k = 0; k < n; k++) {
+         if (texcoord[k][3] != 0.0F) {
+            texcoord[k][0] /= texcoord[k][3];
+            texcoord[k][1] /= texcoord[k][3];
+            texcoord[k][2] /= texcoord[k][3];
+         }
+      }
+   }
+   else if (inst->Opcode == OPCODE_TXB) {
+      const struct gl_texture_unit *texUnit = &ctx->Texture.Unit[unit];
+      GLfloat bias = texUnit->LodBias;
+      if (texUnit->_Current)
+         bias += texUnit->_Current->LodBias;
+      /* texcoord[3] is the bias to add to lambda */
+      for (k = 0; k < n; k++)
+         lodBias[k] = bias + texcoord[k][3];
+   }
+
+   /* Note: we only have the right derivatives for fragment input attribs.
+    */
+   if (machine->NumDeriv > 0 &&
+       inst->SrcReg[0].File == PROGRAM_INPUT &&
+       inst->SrcReg[0].Index == FRAG_ATTRIB_TEX0 + inst->TexSrcUnit) {
+      const GLuint attr = inst->SrcReg[0].Index;
+      machine->FetchTexelsDeriv(ctx, n, (const GLfloat (*)[4]) texcoord,
+                                machine->DerivX[attr],
+                                machine->DerivY[attr],
+                                lodBias, unit, color);
+   }
+   else {
+      machine->FetchTexelsLod(ctx, n, (const GLfloat (*)[4]) texcoord,
+                              lodBias, unit, color);
+   }
+
+   for (k = 0; k < n; k++)
+      store_batch_dst(inst, dst, k, color[k]);
+}
+
+
+/**
+ * Execute the given program on 'n' (at most PROG_BATCH_SIZE) elements.
+ * The program must have passed _mesa_program_batchable().
+ * Inputs are read through machine->Inputs and results are left in
+ * machine->Outputs.  Elements killed by KIL get their machine->Killed
+ * entry set.
+ * \return GL_TRUE if any element was killed.
+ */
+GLboolean
+_mesa_execute_program_batch(GLcontext *ctx,
+                            const struct gl_program *program,
+                            struct gl_program_batch_machine *machine,
+                            GLuint n)
+{
+   GLfloat (*envParams)[4];
+   GLboolean killed = GL_FALSE;
+   GLuint pc, k;
+
+   ASSERT(n <= PROG_BATCH_SIZE);
+
+   if (program->Target == GL_VERTEX_PROGRAM_ARB)
+      envParams = ctx->VertexProgram.Parameters;
+   else
+      envParams = ctx->FragmentProgram.Parameters;
+
+   _mesa_bzero(machine->Killed, n);
+
+   for (pc = 0; pc < program->NumInstructions; pc++) {
+      const struct prog_instruction *inst = program->Instructions + pc;
+      const GLuint numSrc = _mesa_num_inst_src_regs(inst->Opcode);
+      struct batch_src src[3];
+      GLfloat (*dst)[4] = NULL;
+      GLuint i;
+
+      if (inst->Opcode == OPCODE_END)
+         break;
+      if (inst->Opcode == OPCODE_NOP)
+         continue;
+
+      for (i = 0; i < numSrc; i++)
+         decode_batch_src(program, machine, envParams,
+                          &inst->SrcReg[i], &src[i]);
+      for (; i < 3; i++)
+         src[i] = ZeroSrc;
+
+      if (_mesa_num_inst_dst_regs(inst->Opcode)) {
+         if (inst->DstReg.File == PROGRAM_TEMPORARY)
+            dst = machine->Temporaries[inst->DstReg.Index];
+         else
+            dst = machine->Outputs[inst->DstReg.Index];
+      }
+
+      if (inst->Opcode == OPCODE_TEX ||
+          inst->Opcode == OPCODE_TXB ||
+          inst->Opcode == OPCODE_TXP) {
+         exec_batch_texture(ctx, machine, inst, &src[0], n, dst);
+         continue;
+      }
+
+      for (k = 0; k < n; k++) {
+         GLfloat a[4], b[4], c[4], result[4];
+
+         fetch_batch_src(&src[0], k, a);
+         fetch_batch_src(&src[1], k, b);
+         fetch_batch_src(&src[2], k, c);
+
+         switch (inst->Opcode) {
+         case OPCODE_ABS:
+            result[0] = FABSF(a[0]);
+            result[1] = FABSF(a[1]);
+            result[2] = FABSF(a[2]);
+            result[3] = FABSF(a[3]);
+            break;
+         case OPCODE_ADD:
+            result[0] = a[0] + b[0];
+            result[1] = a[1] + b[1];
+            result[2] = a[2] + b[2];
+            result[3] = a[3] + b[3];
+            break;
+         case OPCODE_CMP:
+            result[0] = a[0] < 0.0F ? b[0] : c[0];
+            result[1] = a[1] < 0.0F ? b[1] : c[1];
+            result[2] = a[2] < 0.0F ? b[2] : c[2];
+            result[3] = a[3] < 0.0F ? b[3] : c[3];
+            break;
+         case OPCODE_COS:
+            result[0] = result[1] = result[2] = result[3]
+               = (GLfloat) _mesa_cos(a[0]);
+            break;
+         case OPCODE_DP2:
+            result[0] = result[1] = result[2] = result[3] = DOT2(a, b);
+            break;
+         case OPCODE_DP3:
+            result[0] = result[1] = result[2] = result[3] = DOT3(a, b);
+            break;
+         case OPCODE_DP4:
+            result[0] = result[1] = result[2] = result[3] = DOT4(a, b);
+            break;
+         case OPCODE_DPH:
+            result[0] = result[1] = result[2] = result[3]
+               = DOT3(a, b) + b[3];
+            break;
+         case OPCODE_DST:
+            result[0] = 1.0F;
+            result[1] = a[1] * b[1];
+            result[2] = a[2];
+            result[3] = b[3];
+            break;
+         case OPCODE_EX2:
+            result[0] = result[1] = result[2] = result[3]
+               = (GLfloat) _mesa_pow(2.0, a[0]);
+            break;
+         case OPCODE_FLR:
+            result[0] = FLOORF(a[0]);
+            result[1] = FLOORF(a[1]);
+            result[2] = FLOORF(a[2]);
+            result[3] = FLOORF(a[3]);
+            break;
+         case OPCODE_FRC:
+            result[0] = a[0] - FLOORF(a[0]);
+            result[1] = a[1] - FLOORF(a[1]);
+            result[2] = a[2] - FLOORF(a[2]);
+            result[3] = a[3] - FLOORF(a[3]);
+            break;
+         case OPCODE_KIL:
+            if (a[0] < 0.0F || a[1] < 0.0F || a[2] < 0.0F || a[3] < 0.0F) {
+               machine->Killed[k] = GL_TRUE;
+               killed = GL_TRUE;
+            }
+            continue;
+         case OPCODE_LG2:
+            /* The fast LOG2 macro doesn't meet the precision requirements */
+            if (a[0] == 0.0F)
+               result[0] = 0.0F;
+            else
+               result[0] = (GLfloat) (log(a[0]) * 1.442695F);
+            result[1] = result[2] = result[3] = result[0];
+            break;
+         case OPCODE_LIT:
+            {
+               const GLfloat epsilon = 1.0F / 256.0F; /* from NV VP spec */
+               a[0] = MAX2(a[0], 0.0F);
+               a[1] = MAX2(a[1], 0.0F);
+               a[3] = CLAMP(a[3], -(128.0F - epsilon), (128.0F - epsilon));
+               result[0] = 1.0F;
+               result[1] = a[0];
+               if (a[0] > 0.0F) {
+                  if (a[1] == 0.0 && a[3] == 0.0)
+                     result[2] = 1.0F;
+                  else
+                     result[2] = (GLfloat) _mesa_pow(a[1], a[3]);
+               }
+               else {
+                  result[2] = 0.0F;
+               }
+               result[3] = 1.0F;
+            }
+            break;
+         case OPCODE_LRP:
+            result[0] = a[0] * b[0] + (1.0F - a[0]) * c[0];
+            result[1] = a[1] * b[1] + (1.0F - a[1]) * c[1];
+            result[2] = a[2] * b[2] + (1.0F - a[2]) * c[2];
+            result[3] = a[3] * b[3] + (1.0F - a[3]) * c[3];
+            break;
+         case OPCODE_MAD:
+            result[0] = a[0] * b[0] + c[0];
+            result[1] = a[1] * b[1] + c[1];
+            result[2] = a[2] * b[2] + c[2];
+            result[3] = a[3] * b[3] + c[3];
+            break;
+         case OPCODE_MAX:
+            result[0] = MAX2(a[0], b[0]);
+            result[1] = MAX2(a[1], b[1]);
+            result[2] = MAX2(a[2], b[2]);
+            result[3] = MAX2(a[3], b[3]);
+            break;
+         case OPCODE_MIN:
+            result[0] = MIN2(a[0], b[0]);
+            result[1] = MIN2(a[1], b[1]);
+            result[2] = MIN2(a[2], b[2]);
+            result[3] = MIN2(a[3], b[3]);
+            break;
+         case OPCODE_MOV:
+            COPY_4V(result, a);
+            break;
+         case OPCODE_MUL:
+            result[0] = a[0] * b[0];
+            result[1] = a[1] * b[1];
+            result[2] = a[2] * b[2];
+            result[3] = a[3] * b[3];
+            break;
+         case OPCODE_NRM3:
+            {
+               GLfloat tmp = a[0] * a[0] + a[1] * a[1] + a[2] * a[2];
+               if (tmp != 0.0F)
+                  tmp = INV_SQRTF(tmp);
+               result[0] = tmp * a[0];
+               result[1] = tmp * a[1];
+               result[2] = tmp * a[2];
+               result[3] = 0.0F;
+            }
+            break;
+         case OPCODE_NRM4:
+            {
+               GLfloat tmp = a[0] * a[0] + a[1] * a[1] +
+                             a[2] * a[2] + a[3] * a[3];
+               if (tmp != 0.0F)
+                  tmp = INV_SQRTF(tmp);
+               result[0] = tmp * a[0];
+               result[1] = tmp * a[1];
+               result[2] = tmp * a[2];
+               result[3] = tmp * a[3];
+            }
+            break;
+         case OPCODE_POW:
+            result[0] = result[1] = result[2] = result[3]
+               = (GLfloat) _mesa_pow(a[0], b[0]);
+            break;
+         case OPCODE_RCP:
+            result[0] = result[1] = result[2] = result[3] = 1.0F / a[0];
+            break;
+         case OPCODE_RSQ:
+            result[0] = result[1] = result[2] = result[3]
+               = INV_SQRTF(FABSF(a[0]));
+            break;
+         case OPCODE_SCS:
+            result[0] = (GLfloat) _mesa_cos(a[0]);
+            result[1] = (GLfloat) _mesa_sin(a[0]);
+            result[2] = 0.0F;    /* undefined! */
+            result[3] = 0.0F;    /* undefined! */
+            break;
+         case OPCODE_SEQ:
+            result[0] = (a[0] == b[0]) ? 1.0F : 0.0F;
+            result[1] = (a[1] == b[1]) ? 1.0F : 0.0F;
+            result[2] = (a[2] == b[2]) ? 1.0F : 0.0F;
+            result[3] = (a[3] == b[3]) ? 1.0F : 0.0F;
+            break;
+         case OPCODE_SGE:
+            result[0] = (a[0] >= b[0]) ? 1.0F : 0.0F;
+            result[1] = (a[1] >= b[1]) ? 1.0F : 0.0F;
+            result[2] = (a[2] >= b[2]) ? 1.0F : 0.0F;
+            result[3] = (a[3] >= b[3]) ? 1.0F : 0.0F;
+            break;
+         case OPCODE_SGT:
+            result[0] = (a[0] > b[0]) ? 1.0F : 0.0F;
+            result[1] = (a[1] > b[1]) ? 1.0F : 0.0F;
+            result[2] = (a[2] > b[2]) ? 1.0F : 0.0F;
+            result[3] = (a[3] > b[3]) ? 1.0F : 0.0F;
+            break;
+         case OPCODE_SIN:
+            result[0] = result[1] = result[2] = result[3]
+               = (GLfloat) _mesa_sin(a[0]);
+            break;
+         case OPCODE_SLE:
+            result[0] = (a[0] <= b[0]) ? 1.0F : 0.0F;
+            result[1] = (a[1] <= b[1]) ? 1.0F : 0.0F;
+            result[2] = (a[2] <= b[2]) ? 1.0F : 0.0F;
+            result[3] = (a[3] <= b[3]) ? 1.0F : 0.0F;
+            break;
+         case OPCODE_SLT:
+            result[0] = (a[0] < b[0]) ? 1.0F : 0.0F;
+            result[1] = (a[1] < b[1]) ? 1.0F : 0.0F;
+            result[2] = (a[2] < b[2]) ? 1.0F : 0.0F;
+            result[3] = (a[3] < b[3]) ? 1.0F : 0.0F;
+            break;
+         case OPCODE_SNE:
+            result[0] = (a[0] != b[0]) ? 1.0F : 0.0F;
+            result[1] = (a[1] != b[1]) ? 1.0F : 0.0F;
+            result[2] = (a[2] != b[2]) ? 1.0F : 0.0F;
+            result[3] = (a[3] != b[3]) ? 1.0F : 0.0F;
+            break;
+         case OPCODE_SUB:
+            result[0] = a[0] - b[0];
+            result[1] = a[1] - b[1];
+            result[2] = a[2] - b[2];
+            result[3] = a[3] - b[3];
+            break;
+         case OPCODE_XPD:
+            result[0] = a[1] * b[2] - a[2] * b[1];
+            result[1] = a[2] * b[0] - a[0] * b[2];
+            result[2] = a[0] * b[1] - a[1] * b[0];
+            result[3] = 1.0F;
+            break;
+         default:
+            _mesa_problem(ctx, "Bad opcode %d in _mesa_execute_program_batch",
+                          inst->Opcode);
+            return killed;
+         }
+
+         store_batch_dst(inst, dst, k, result);
+      }
+   }
+
+   return killed;
+}
@@ -72,6 +72,52 @@ struct gl_program_machine
 };
 
 
+/** Max number of elements run by one _mesa_execute_program_batch() call */
+#define PROG_BATCH_SIZE 16
+
+
+typedef void (*FetchTexelsLodFunc)(GLcontext *ctx, GLuint n,
+                                   const GLfloat texcoord[][4],
+                                   const GLfloat lambda[], GLuint unit,
+                                   GLfloat color[][4]);
+
+typedef void (*FetchTexelsDerivFunc)(GLcontext *ctx, GLuint n,
+                                     const GLfloat texcoord[][4],
+                                     const GLfloat texdx[4],
+                                     const GLfloat texdy[4],
+                                     const GLfloat lodBias[],
+                                     GLuint unit, GLfloat color[][4]);
+
+
+/**
+ * Virtual machine state used to run a vertex/fragment program on a batch
+ * of up to PROG_BATCH_SIZE vertices or fragments at once.
+ */
+struct gl_program_batch_machine
+{
+   /** Input attributes.  Inputs[attr] points at the value for the first
+    * element of the batch, the following elements come right after it.
+    * May be NULL for attributes the program doesn't read.
+    */
+   const GLfloat (*Inputs[VERT_ATTRIB_MAX])[4];
+   GLuint NumInputs;
+
+   GLfloat (*DerivX)[4];
+   GLfloat (*DerivY)[4];
+   GLuint NumDeriv; /**< Max index into DerivX/Y arrays */
+
+   GLfloat Temporaries[MAX_PROGRAM_TEMPS][PROG_BATCH_SIZE][4];
+   GLfloat Outputs[MAX_PROGRAM_OUTPUTS][PROG_BATCH_SIZE][4];
+   GLboolean Killed[PROG_BATCH_SIZE]; /**< Set by KIL */
+
+   const GLubyte *Samplers;  /** Array mapping sampler var to tex unit */
+
+   /** Texture fetch functions */
+   FetchTexelsLodFunc FetchTexelsLod;
+   FetchTexelsDerivFunc FetchTexelsDeriv;
+};
+
+
 extern void
 _mesa_get_program_register(GLcontext *ctx, gl_register_file file,
                            GLuint index, GLfloat val[4]);
@@ -81,5 +127,14 @@ _mesa_execute_program(GLcontext *ctx,
                       const struct gl_program *program,
                       struct gl_program_machine *machine);
 
+extern GLboolean
+_mesa_program_batchable(const struct gl_program *program);
+
+extern GLboolean
+_mesa_execute_program_batch(GLcontext *ctx,
+                            const struct gl_program *program,
+                            struct gl_program_batch_machine *machine,
+                            GLuint n);
+
 
 #endif /* PROG_EXECUTE_H */
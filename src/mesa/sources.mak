@@ -126,6 +126,7 @@ SWRAST_SOURCES = \
 	swrast/s_texcombine.c \
 	swrast/s_texfilter.c \
 	swrast/s_texstore.c \
+	swrast/s_tiles.c \
 	swrast/s_triangle.c \
 	swrast/s_zoom.c
 
@@ -136,6 +137,7 @@ SWRAST_SETUP_SOURCES = \
 TNL_SOURCES = \
 	tnl/t_context.c \
 	tnl/t_pipeline.c \
+	tnl/t_threads.c \
 	tnl/t_draw.c \
 	tnl/t_rasterpos.c \
 	tnl/t_vb_program.c \
@@ -296,7 +298,10 @@ X86_API =			\
 	x86/glapi_x86.S
 
 X86-64_SOURCES =		\
-	x86-64/xform4.S
+	x86-64/xform4.S		\
+	x86-64/sse_xform.S	\
+	x86-64/sse_normal.S	\
+	x86-64/cliptest.S
 
 X86-64_API =			\
 	x86-64/glapi_x86-64.S
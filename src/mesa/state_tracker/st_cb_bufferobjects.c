@@ -39,6 +39,7 @@
 #include "st_inlines.h"
 #include "st_context.h"
 #include "st_cb_bufferobjects.h"
+#include "st_cb_readpixels.h"
 
 #include "pipe/p_context.h"
 #include "pipe/p_defines.h"
@@ -66,6 +67,18 @@ st_bufferobj_alloc(GLcontext *ctx, GLuint name, GLenum target)
 
 
 
+/**
+ * Complete any glReadPixels into this buffer that is still pending, before
+ * the buffer's contents are accessed.
+ */
+void
+st_bufferobj_resolve(GLcontext *ctx, struct st_buffer_object *st_obj)
+{
+   if (st_obj->readback)
+      st_finish_pbo_readback(ctx, st_obj);
+}
+
+
 /**
  * Deallocate/free a vertex/pixel buffer object.
  * Called via glDeleteBuffersARB().
@@ -75,6 +88,8 @@ st_bufferobj_free(GLcontext *ctx, struct gl_buffer_object *obj)
 {
    struct st_buffer_object *st_obj = st_buffer_object(obj);
 
+   st_discard_pbo_readback(st_obj);
+
    if (st_obj->buffer) 
       pipe_buffer_reference(&st_obj->buffer, NULL);
 
@@ -103,6 +118,8 @@ st_bufferobj_subdata(GLcontext *ctx,
    ASSERT(size >= 0);
    ASSERT(offset + size <= obj->Size);
 
+   st_bufferobj_resolve(ctx, st_obj);
+
    st_cond_flush_pipe_buffer_write(st_context(ctx), st_obj->buffer,
 				   offset, size, data);
 }
@@ -125,6 +142,8 @@ st_bufferobj_get_subdata(GLcontext *ctx,
    ASSERT(size >= 0);
    ASSERT(offset + size <= obj->Size);
 
+   st_bufferobj_resolve(ctx, st_obj);
+
    st_cond_flush_pipe_buffer_read(st_context(ctx), st_obj->buffer,
 				  offset, size, data);
 }
@@ -168,6 +187,8 @@ st_bufferobj_data(GLcontext *ctx,
       buffer_usage = 0;
    }
 
+   st_discard_pbo_readback(st_obj);
+
    pipe_buffer_reference( &st_obj->buffer, NULL );
 
    st_obj->buffer = pipe_buffer_create( pipe->screen, 32, buffer_usage, size );
@@ -207,6 +228,8 @@ st_bufferobj_map(GLcontext *ctx, GLenum target, GLenum access,
       break;      
    }
 
+   st_bufferobj_resolve(ctx, st_obj);
+
    obj->Pointer = st_cond_flush_pipe_buffer_map(st_context(ctx),
 						st_obj->buffer,
 						flags);
@@ -250,6 +273,8 @@ st_bufferobj_map_range(GLcontext *ctx, GLenum target,
    assert(offset < obj->Size);
    assert(offset + length <= obj->Size);
 
+   st_bufferobj_resolve(ctx, st_obj);
+
    obj->Pointer = pipe_buffer_map_range(pipe->screen, st_obj->buffer, offset, length, flags);
    if (obj->Pointer) {
       obj->Pointer = (ubyte *) obj->Pointer + offset;
@@ -316,6 +341,9 @@ st_copy_buffer_subdata(GLcontext *ctx,
    assert(!src->Pointer);
    assert(!dst->Pointer);
 
+   st_bufferobj_resolve(ctx, srcObj);
+   st_bufferobj_resolve(ctx, dstObj);
+
    srcPtr = (ubyte *) pipe_buffer_map_range(pipe->screen,
                                             srcObj->buffer,
                                             readOffset, size,
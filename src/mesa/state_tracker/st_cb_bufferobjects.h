@@ -31,6 +31,7 @@
 struct st_context;
 struct gl_buffer_object;
 struct pipe_buffer;
+struct st_pbo_readback;
 
 /**
  * State_tracker vertex/pixel buffer object, derived from Mesa's
@@ -40,6 +41,7 @@ struct st_buffer_object
 {
    struct gl_buffer_object Base;
    struct pipe_buffer *buffer;  
+   struct st_pbo_readback *readback;  /**< pending glReadPixels, or NULL */
 };
 
 
@@ -51,6 +53,9 @@ st_buffer_object(struct gl_buffer_object *obj)
 }
 
 
+extern void
+st_bufferobj_resolve(GLcontext *ctx, struct st_buffer_object *st_obj);
+
 extern void
 st_init_bufferobject_functions(struct dd_function_table *functions);
 
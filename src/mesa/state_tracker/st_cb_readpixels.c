@@ -41,10 +41,12 @@
 #include "pipe/p_context.h"
 #include "pipe/p_defines.h"
 #include "pipe/p_inlines.h"
+#include "util/u_math.h"
 #include "util/u_tile.h"
 
 #include "st_context.h"
 #include "st_cb_bitmap.h"
+#include "st_cb_bufferobjects.h"
 #include "st_cb_readpixels.h"
 #include "st_cb_fbo.h"
 #include "st_format.h"
@@ -196,15 +198,17 @@ st_get_color_read_renderbuffer(GLcontext *ctx)
 
 
 /**
- * Try to do glReadPixels in a fast manner for common cases.
+ * Try to convert the pixels of a color transfer in a fast manner for
+ * common cases.
+ * \param invert  if true, the transfer's rows are read bottom-to-top
  * \return GL_TRUE for success, GL_FALSE for failure
  */
 static GLboolean
-st_fast_readpixels(GLcontext *ctx, struct st_renderbuffer *strb,
-                   GLint x, GLint y, GLsizei width, GLsizei height,
-                   GLenum format, GLenum type,
-                   const struct gl_pixelstore_attrib *pack,
-                   GLvoid *dest)
+st_fast_pack_pixels(GLcontext *ctx, struct pipe_transfer *trans,
+                    GLboolean invert, GLsizei width, GLsizei height,
+                    GLenum format, GLenum type,
+                    const struct gl_pixelstore_attrib *pack,
+                    GLvoid *dest)
 {
    enum combination {
       A8R8G8B8_UNORM_TO_RGBA_UBYTE,
@@ -212,18 +216,15 @@ st_fast_readpixels(GLcontext *ctx, struct st_renderbuffer *strb,
       A8R8G8B8_UNORM_TO_BGRA_UINT
    } combo;
 
-   if (ctx->_ImageTransferState)
-      return GL_FALSE;
-
-   if (strb->format == PIPE_FORMAT_A8R8G8B8_UNORM &&
+   if (trans->format == PIPE_FORMAT_A8R8G8B8_UNORM &&
        format == GL_RGBA && type == GL_UNSIGNED_BYTE) {
       combo = A8R8G8B8_UNORM_TO_RGBA_UBYTE;
    }
-   else if (strb->format == PIPE_FORMAT_A8R8G8B8_UNORM &&
+   else if (trans->format == PIPE_FORMAT_A8R8G8B8_UNORM &&
             format == GL_RGB && type == GL_UNSIGNED_BYTE) {
       combo = A8R8G8B8_UNORM_TO_RGB_UBYTE;
    }
-   else if (strb->format == PIPE_FORMAT_A8R8G8B8_UNORM &&
+   else if (trans->format == PIPE_FORMAT_A8R8G8B8_UNORM &&
             format == GL_BGRA && type == GL_UNSIGNED_INT_8_8_8_8_REV) {
       combo = A8R8G8B8_UNORM_TO_BGRA_UINT;
    }
@@ -231,35 +232,20 @@ st_fast_readpixels(GLcontext *ctx, struct st_renderbuffer *strb,
       return GL_FALSE;
    }
 
-   /*printf("st_fast_readpixels combo %d\n", (GLint) combo);*/
+   /*printf("st_fast_pack_pixels combo %d\n", (GLint) combo);*/
 
    {
-      struct pipe_context *pipe = ctx->st->pipe;
-      struct pipe_screen *screen = pipe->screen;
-      struct pipe_transfer *trans;
+      struct pipe_screen *screen = ctx->st->pipe->screen;
       const GLubyte *map;
       GLubyte *dst;
-      GLint row, col, dy, dstStride;
-
-      if (st_fb_orientation(ctx->ReadBuffer) == Y_0_TOP) {
-         y = strb->texture->height[0] - y - height;
-      }
-
-      trans = st_cond_flush_get_tex_transfer(st_context(ctx), strb->texture,
-					     0, 0, 0,
-					     PIPE_TRANSFER_READ, x, y,
-					     width, height);
-      if (!trans) {
-         return GL_FALSE;
-      }
+      GLint row, col, y, dy, dstStride;
 
       map = screen->transfer_map(screen, trans);
       if (!map) {
-         screen->tex_transfer_destroy(trans);
          return GL_FALSE;
       }
 
-      if (st_fb_orientation(ctx->ReadBuffer) == Y_0_TOP) {
+      if (invert) {
          y = height - 1;
          dy = -1;
       }
@@ -313,17 +299,240 @@ st_fast_readpixels(GLcontext *ctx, struct st_renderbuffer *strb,
       }
 
       screen->transfer_unmap(screen, trans);
-      screen->tex_transfer_destroy(trans);
    }
 
    return GL_TRUE;
 }
 
 
+/**
+ * Convert the pixels of a color transfer to the requested format/type
+ * with get_tile() and the Mesa image routines, trying the fast paths
+ * above first.
+ * \param invert  if true, the transfer's rows are read bottom-to-top
+ */
+static void
+st_pack_color_pixels(GLcontext *ctx, struct pipe_transfer *trans,
+                     GLboolean invert, GLsizei width, GLsizei height,
+                     GLenum format, GLenum type,
+                     const struct gl_pixelstore_attrib *pack,
+                     GLbitfield transferOps, GLvoid *dest)
+{
+   GLfloat temp[MAX_WIDTH][4];
+   GLfloat *df;
+   GLint i, y, yStep, dfStride;
+   GLubyte *dst;
+   GLint dstStride;
+
+   if (!transferOps &&
+       st_fast_pack_pixels(ctx, trans, invert, width, height,
+                           format, type, pack, dest)) {
+      /* success! */
+      return;
+   }
+
+   if (format == GL_RGBA && type == GL_FLOAT) {
+      /* write tile(row) directly into user's buffer */
+      df = (GLfloat *) _mesa_image_address2d(pack, dest, width,
+                                             height, format, type, 0, 0);
+      dfStride = width * 4;
+   }
+   else {
+      /* write tile(row) into temp row buffer */
+      df = (GLfloat *) temp;
+      dfStride = 0;
+   }
+
+   /* determine bottom-to-top vs. top-to-bottom order */
+   if (invert) {
+      y = height - 1;
+      yStep = -1;
+   }
+   else {
+      y = 0;
+      yStep = 1;
+   }
+
+   /* dest of first pixel in client memory */
+   dst = _mesa_image_address2d(pack, dest, width, height, format, type, 0, 0);
+   /* dest row stride */
+   dstStride = _mesa_image_row_stride(pack, width, format, type);
+
+   /* Do a row at a time to flip image data vertically */
+   for (i = 0; i < height; i++) {
+      pipe_get_tile_rgba(trans, 0, y, width, 1, df);
+      y += yStep;
+      df += dfStride;
+      if (!dfStride) {
+         _mesa_pack_rgba_span_float(ctx, width, temp, format, type, dst,
+                                    pack, transferOps);
+         dst += dstStride;
+      }
+   }
+}
+
+
+/**
+ * A glReadPixels into a pixel pack buffer whose conversion step has
+ * been deferred.  The framebuffer region was copied into a private
+ * texture with surface_copy() when glReadPixels was called; packing it
+ * into the buffer happens in st_finish_pbo_readback() when the buffer
+ * is next accessed.
+ */
+struct st_pbo_readback
+{
+   struct pipe_texture *texture;   /**< copy of the framebuffer region */
+   GLsizei width, height;
+   GLboolean invert;               /**< texture rows are top-to-bottom */
+   GLenum format, type;
+   struct gl_pixelstore_attrib packing;  /**< BufferObj is not used */
+   GLvoid *dest;                   /**< offset into the buffer */
+};
+
+
+/**
+ * Start a glReadPixels into a pixel pack buffer without waiting for it:
+ * the region is copied into a private texture on the GPU and the
+ * conversion to format/type is done later by st_finish_pbo_readback().
+ * This lets the application queue a readback and carry on rendering
+ * until it actually maps the buffer.
+ * \return GL_TRUE if the readback was queued, GL_FALSE to do it now
+ */
+static GLboolean
+st_queue_pbo_readback(GLcontext *ctx, struct st_renderbuffer *strb,
+                      GLint x, GLint y, GLsizei width, GLsizei height,
+                      GLenum format, GLenum type,
+                      const struct gl_pixelstore_attrib *pack,
+                      GLvoid *dest)
+{
+   struct st_context *st = st_context(ctx);
+   struct pipe_context *pipe = st->pipe;
+   struct pipe_screen *screen = pipe->screen;
+   struct st_buffer_object *stobj = st_buffer_object(pack->BufferObj);
+   struct st_pbo_readback *rb;
+   struct pipe_surface *psTex;
+
+   if (ctx->_ImageTransferState ||
+       !pipe->surface_copy ||
+       !strb->surface ||
+       !stobj->buffer)
+      return GL_FALSE;
+
+   if (!screen->get_param(screen, PIPE_CAP_NPOT_TEXTURES) &&
+       (!util_is_pot(width) || !util_is_pot(height)))
+      return GL_FALSE;
+
+   if (!screen->is_format_supported(screen, strb->format, PIPE_TEXTURE_2D,
+                                    PIPE_TEXTURE_USAGE_RENDER_TARGET, 0))
+      return GL_FALSE;
+
+   rb = ST_CALLOC_STRUCT(st_pbo_readback);
+   if (!rb)
+      return GL_FALSE;
+
+   rb->texture = st_texture_create(st, PIPE_TEXTURE_2D, strb->format, 0,
+                                   width, height, 1,
+                                   PIPE_TEXTURE_USAGE_RENDER_TARGET);
+   if (!rb->texture) {
+      _mesa_free(rb);
+      return GL_FALSE;
+   }
+
+   /* for surface_copy(), y=0=top, always */
+   if (st_fb_orientation(ctx->ReadBuffer) == Y_0_TOP) {
+      y = strb->Base.Height - y - height;
+      rb->invert = GL_TRUE;
+   }
+
+   psTex = screen->get_tex_surface(screen, rb->texture, 0, 0, 0,
+                                   PIPE_BUFFER_USAGE_GPU_WRITE);
+   if (!psTex) {
+      pipe_texture_reference(&rb->texture, NULL);
+      _mesa_free(rb);
+      return GL_FALSE;
+   }
+
+   pipe->surface_copy(pipe,
+                      psTex, 0, 0,
+                      strb->surface, x, y,
+                      width, height);
+   pipe_surface_reference(&psTex, NULL);
+
+   rb->width = width;
+   rb->height = height;
+   rb->format = format;
+   rb->type = type;
+   rb->packing = *pack;
+   rb->packing.BufferObj = NULL;
+   rb->dest = dest;
+
+   /* only one readback is kept pending per buffer */
+   if (stobj->readback)
+      st_finish_pbo_readback(ctx, stobj);
+   stobj->readback = rb;
+
+   return GL_TRUE;
+}
+
+
+/**
+ * Complete a glReadPixels queued by st_queue_pbo_readback(): pack the
+ * copied pixels into the buffer object.
+ */
+void
+st_finish_pbo_readback(GLcontext *ctx, struct st_buffer_object *stobj)
+{
+   struct st_context *st = st_context(ctx);
+   struct pipe_screen *screen = st->pipe->screen;
+   struct st_pbo_readback *rb = stobj->readback;
+   struct pipe_transfer *trans;
+   GLubyte *map;
+
+   assert(rb);
+   stobj->readback = NULL;
+
+   map = st_cond_flush_pipe_buffer_map(st, stobj->buffer,
+                                       PIPE_BUFFER_USAGE_CPU_WRITE);
+   if (map) {
+      trans = st_cond_flush_get_tex_transfer(st, rb->texture, 0, 0, 0,
+                                             PIPE_TRANSFER_READ, 0, 0,
+                                             rb->width, rb->height);
+      if (trans) {
+         st_pack_color_pixels(ctx, trans, rb->invert, rb->width, rb->height,
+                              rb->format, rb->type, &rb->packing, 0x0,
+                              ADD_POINTERS(map, rb->dest));
+         screen->tex_transfer_destroy(trans);
+      }
+      pipe_buffer_unmap(screen, stobj->buffer);
+   }
+
+   pipe_texture_reference(&rb->texture, NULL);
+   _mesa_free(rb);
+}
+
+
+/**
+ * Drop a pending readback without doing it, because the buffer's
+ * contents are being replaced or the buffer is being deleted.
+ */
+void
+st_discard_pbo_readback(struct st_buffer_object *stobj)
+{
+   struct st_pbo_readback *rb = stobj->readback;
+
+   if (rb) {
+      stobj->readback = NULL;
+      pipe_texture_reference(&rb->texture, NULL);
+      _mesa_free(rb);
+   }
+}
+
+
 /**
  * Do glReadPixels by getting rows from the framebuffer transfer with
  * get_tile().  Convert to requested format/type with Mesa image routines.
  * Image transfer ops are done in software too.
+ * Reads into a pixel pack buffer are queued when possible.
  */
 static void
 st_readpixels(GLcontext *ctx, GLint x, GLint y, GLsizei width, GLsizei height,
@@ -333,11 +542,9 @@ st_readpixels(GLcontext *ctx, GLint x, GLint y, GLsizei width, GLsizei height,
 {
    struct pipe_context *pipe = ctx->st->pipe;
    struct pipe_screen *screen = pipe->screen;
-   GLfloat temp[MAX_WIDTH][4];
    const GLbitfield transferOps = ctx->_ImageTransferState;
    GLsizei i, j;
-   GLint yStep, dfStride;
-   GLfloat *df;
+   GLint yStep;
    struct st_renderbuffer *strb;
    struct gl_pixelstore_attrib clippedPacking = *pack;
    struct pipe_transfer *trans;
@@ -353,12 +560,23 @@ st_readpixels(GLcontext *ctx, GLint x, GLint y, GLsizei width, GLsizei height,
       return;
    }
 
+   st_flush(ctx->st, PIPE_FLUSH_RENDER_CACHE, NULL);
+
+   if (_mesa_is_bufferobj(clippedPacking.BufferObj) &&
+       format != GL_STENCIL_INDEX &&
+       format != GL_DEPTH_STENCIL &&
+       format != GL_DEPTH_COMPONENT) {
+      strb = st_get_color_read_renderbuffer(ctx);
+      if (strb &&
+          st_queue_pbo_readback(ctx, strb, x, y, width, height,
+                                format, type, &clippedPacking, dest))
+         return;
+   }
+
    dest = _mesa_map_pbo_dest(ctx, &clippedPacking, dest);
    if (!dest)
       return;
 
-   st_flush(ctx->st, PIPE_FLUSH_RENDER_CACHE, NULL);
-
    if (format == GL_STENCIL_INDEX ||
        format == GL_DEPTH_STENCIL) {
       st_read_stencil_pixels(ctx, x, y, width, height,
@@ -376,26 +594,6 @@ st_readpixels(GLcontext *ctx, GLint x, GLint y, GLsizei width, GLsizei height,
    if (!strb)
       return;
 
-   /* try a fast-path readpixels before anything else */
-   if (st_fast_readpixels(ctx, strb, x, y, width, height,
-                          format, type, pack, dest)) {
-      /* success! */
-      _mesa_unmap_pbo_dest(ctx, &clippedPacking);
-      return;
-   }
-
-   if (format == GL_RGBA && type == GL_FLOAT) {
-      /* write tile(row) directly into user's buffer */
-      df = (GLfloat *) _mesa_image_address2d(&clippedPacking, dest, width,
-                                             height, format, type, 0, 0);
-      dfStride = width * 4;
-   }
-   else {
-      /* write tile(row) into temp row buffer */
-      df = (GLfloat *) temp;
-      dfStride = 0;
-   }
-
    if (st_fb_orientation(ctx->ReadBuffer) == Y_0_TOP) {
       y = strb->Base.Height - y - height;
    }
@@ -518,17 +716,9 @@ st_readpixels(GLcontext *ctx, GLint x, GLint y, GLsizei width, GLsizei height,
       }
       else {
          /* RGBA format */
-         /* Do a row at a time to flip image data vertically */
-         for (i = 0; i < height; i++) {
-            pipe_get_tile_rgba(trans, 0, y, width, 1, df);
-            y += yStep;
-            df += dfStride;
-            if (!dfStride) {
-               _mesa_pack_rgba_span_float(ctx, width, temp, format, type, dst,
-                                          &clippedPacking, transferOps);
-               dst += dstStride;
-            }
-         }
+         st_pack_color_pixels(ctx, trans, yStep < 0, width, height,
+                              format, type, &clippedPacking, transferOps,
+                              dest);
       }
    }
 
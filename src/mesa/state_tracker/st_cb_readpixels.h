@@ -29,6 +29,8 @@
 #ifndef ST_CB_READPIXELS_H
 #define ST_CB_READPIXELS_H
 
+struct st_buffer_object;
+
 extern struct st_renderbuffer *
 st_get_color_read_renderbuffer(GLcontext *ctx);
 
@@ -39,6 +41,12 @@ st_read_stencil_pixels(GLcontext *ctx, GLint x, GLint y,
                        const struct gl_pixelstore_attrib *packing,
                        GLvoid *pixels);
 
+extern void
+st_finish_pbo_readback(GLcontext *ctx, struct st_buffer_object *stobj);
+
+extern void
+st_discard_pbo_readback(struct st_buffer_object *stobj);
+
 extern void
 st_init_readpixels_functions(struct dd_function_table *functions);
 
@@ -238,6 +238,8 @@ setup_edgeflags(GLcontext *ctx, GLenum primMode, GLint start, GLint count,
       if (!vec)
          return NULL;
 
+      st_bufferobj_resolve(ctx, stobj);
+
       map = pipe_buffer_map(pipe->screen, stobj->buffer, PIPE_BUFFER_USAGE_CPU_READ);
       map = ADD_POINTERS(map, array->Ptr);
 
@@ -388,6 +390,7 @@ setup_interleaved_attribs(GLcontext *ctx,
             vbuffer->buffer_offset = 0;
          }
          else {
+            st_bufferobj_resolve(ctx, stobj);
             vbuffer->buffer = NULL;
             pipe_buffer_reference(&vbuffer->buffer, stobj->buffer);
             vbuffer->buffer_offset = pointer_to_offset(low);
@@ -444,6 +447,8 @@ setup_non_interleaved_attribs(GLcontext *ctx,
          assert(stobj->buffer);
          /*printf("stobj %u = %p\n", attr, (void*) stobj);*/
 
+         st_bufferobj_resolve(ctx, stobj);
+
          vbuffer[attr].buffer = NULL;
          pipe_buffer_reference(&vbuffer[attr].buffer, stobj->buffer);
          vbuffer[attr].buffer_offset = pointer_to_offset(arrays[mesaAttr]->Ptr);
@@ -637,6 +642,7 @@ st_draw_vbo(GLcontext *ctx,
       if (bufobj && bufobj->Name) {
          /* elements/indexes are in a real VBO */
          struct st_buffer_object *stobj = st_buffer_object(bufobj);
+         st_bufferobj_resolve(ctx, stobj);
          pipe_buffer_reference(&indexBuf, stobj->buffer);
          indexOffset = pointer_to_offset(ib->ptr) / indexSize;
       }
@@ -155,6 +155,8 @@ st_feedback_draw_vbo(GLcontext *ctx,
          struct st_buffer_object *stobj = st_buffer_object(bufobj);
          assert(stobj->buffer);
 
+         st_bufferobj_resolve(ctx, stobj);
+
          vbuffers[attr].buffer = NULL;
          pipe_buffer_reference(&vbuffers[attr].buffer, stobj->buffer);
          vbuffers[attr].buffer_offset = pointer_to_offset(arrays[0]->Ptr);
@@ -220,6 +222,8 @@ st_feedback_draw_vbo(GLcontext *ctx,
       if (bufobj && bufobj->Name) {
          struct st_buffer_object *stobj = st_buffer_object(bufobj);
 
+         st_bufferobj_resolve(ctx, stobj);
+
          index_buffer_handle = stobj->buffer;
 
          map = pipe_buffer_map(pipe->screen, index_buffer_handle,
@@ -42,6 +42,7 @@
 #include "s_span.h"
 #include "s_triangle.h"
 #include "s_texfilter.h"
+#include "s_tiles.h"
 
 
 /**
@@ -265,10 +266,19 @@ _swrast_update_fog_state( GLcontext *ctx )
 static void
 _swrast_update_fragment_program(GLcontext *ctx, GLbitfield newState)
 {
+   SWcontext *swrast = SWRAST_CONTEXT(ctx);
    const struct gl_fragment_program *fp = ctx->FragmentProgram._Current;
    if (fp) {
       _mesa_load_state_parameters(ctx, fp->Base.Parameters);
    }
+   if (newState & _NEW_PROGRAM) {
+      /* NV fragment programs expect temporaries to be cleared per
+       * fragment, which the batched path doesn't do.
+       */
+      swrast->_FragProgBatched = fp &&
+         fp->Base.Target == GL_FRAGMENT_PROGRAM_ARB &&
+         _mesa_program_batchable(&fp->Base);
+   }
 }
 
 
@@ -712,6 +722,8 @@ _swrast_Line( GLcontext *ctx, const SWvertex *v0, const SWvertex *v1 )
       _swrast_print_vertex( ctx, v0 );
       _swrast_print_vertex( ctx, v1 );
    }
+   if (SWRAST_CONTEXT(ctx)->Tiles)
+      _swrast_flush_tiles( ctx );
    SWRAST_CONTEXT(ctx)->Line( ctx, v0, v1 );
 }
 
@@ -722,6 +734,8 @@ _swrast_Point( GLcontext *ctx, const SWvertex *v0 )
       _mesa_debug(ctx, "_swrast_Point\n");
       _swrast_print_vertex( ctx, v0 );
    }
+   if (SWRAST_CONTEXT(ctx)->Tiles)
+      _swrast_flush_tiles( ctx );
    SWRAST_CONTEXT(ctx)->Point( ctx, v0 );
 }
 
@@ -839,6 +853,8 @@ _swrast_CreateContext( GLcontext *ctx )
 
    ctx->swrast_context = swrast;
 
+   _swrast_create_tiles( ctx );
+
    return GL_TRUE;
 }
 
@@ -851,10 +867,14 @@ _swrast_DestroyContext( GLcontext *ctx )
       _mesa_debug(ctx, "_swrast_DestroyContext\n");
    }
 
+   _swrast_destroy_tiles( ctx );
+
    FREE( swrast->SpanArrays );
    if (swrast->ZoomedArrays)
       FREE( swrast->ZoomedArrays );
    FREE( swrast->TexelBuffer );
+   if (swrast->FragProgBatch)
+      FREE( swrast->FragProgBatch );
    FREE( swrast );
 
    ctx->swrast_context = 0;
@@ -902,12 +922,17 @@ _swrast_render_start( GLcontext *ctx )
    if (swrast->Driver.SpanRenderStart)
       swrast->Driver.SpanRenderStart( ctx );
    swrast->PointSpan.end = 0;
+   if (swrast->Tiles)
+      _swrast_tiles_render_start( ctx );
 }
  
 void
 _swrast_render_finish( GLcontext *ctx )
 {
    SWcontext *swrast = SWRAST_CONTEXT(ctx);
+   if (swrast->Tiles)
+      _swrast_tiles_render_finish( ctx );
+
    if (swrast->Driver.SpanRenderFinish)
       swrast->Driver.SpanRenderFinish( ctx );
 
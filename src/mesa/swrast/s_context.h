@@ -68,6 +68,18 @@ typedef void (*swrast_tri_func)( GLcontext *ctx, const SWvertex *,
                                  const SWvertex *, const SWvertex *);
 
 
+/**
+ * Scratch state of a thread rendering screen tiles, see s_tiles.c.
+ */
+typedef struct sw_tile_thread
+{
+   SWspanarrays *SpanArrays;
+   GLfloat *TexelBuffer;
+   GLint Xmin, Xmax, Ymin, Ymax;   /**< bounds of the current tile, inclusive */
+} SWtilethread;
+
+struct swrast_tiles;
+
 typedef void (*validate_texture_image_func)(GLcontext *ctx,
                                             struct gl_texture_object *texObj,
                                             GLuint face, GLuint level);
@@ -229,6 +241,18 @@ typedef struct
    /** State used during execution of fragment programs */
    struct gl_program_machine FragProgMachine;
 
+   /** Can the current fragment program be run on several fragments at
+    * a time?  See _mesa_program_batchable().
+    */
+   GLboolean _FragProgBatched;
+   /** State for batched fragment program execution, allocated lazily */
+   struct gl_program_batch_machine *FragProgBatch;
+
+   /** Worker threads for rendering screen tiles in parallel, or NULL */
+   struct swrast_tiles *Tiles;
+   /** Triangle function run per tile while Triangle bins the triangles */
+   swrast_tri_func TileTriangle;
+
 } SWcontext;
 
 
@@ -254,6 +278,41 @@ CONST_SWRAST_CONTEXT(const GLcontext *ctx)
 }
 
 
+extern SWtilethread *
+_swrast_tile_thread(void);
+
+
+/**
+ * Return the span arrays for the calling thread.  Threads rendering
+ * screen tiles have their own.
+ */
+static INLINE SWspanarrays *
+_swrast_span_arrays(GLcontext *ctx)
+{
+   SWcontext *swrast = SWRAST_CONTEXT(ctx);
+   if (swrast->Tiles) {
+      SWtilethread *thread = _swrast_tile_thread();
+      if (thread)
+         return thread->SpanArrays;
+   }
+   return swrast->SpanArrays;
+}
+
+
+/** As above, for the texel buffer. */
+static INLINE GLfloat *
+_swrast_texel_buffer(GLcontext *ctx)
+{
+   SWcontext *swrast = SWRAST_CONTEXT(ctx);
+   if (swrast->Tiles) {
+      SWtilethread *thread = _swrast_tile_thread();
+      if (thread)
+         return thread->TexelBuffer;
+   }
+   return swrast->TexelBuffer;
+}
+
+
 /**
  * Called prior to framebuffer reading/writing.
  * For drivers that rely on swrast for fallback rendering, this is the
@@ -26,6 +26,7 @@
 #include "main/colormac.h"
 #include "main/context.h"
 #include "main/texstate.h"
+#include "main/imports.h"
 #include "shader/prog_instruction.h"
 
 #include "s_fragprog.h"
@@ -235,6 +236,172 @@ run_program(GLcontext *ctx, SWspan *span, GLuint start, GLuint end)
 }
 
 
+
+/**
+ * Fetch texels for a batch of fragments with given lods.
+ * Called via gl_program_batch_machine::FetchTexelsLod().
+ */
+static void
+fetch_texels_lod(GLcontext *ctx, GLuint n, const GLfloat texcoord[][4],
+                 const GLfloat lodBias[], GLuint unit, GLfloat color[][4])
+{
+   const struct gl_texture_object *texObj = ctx->Texture.Unit[unit]._Current;
+   GLuint i;
+
+   if (texObj) {
+      SWcontext *swrast = SWRAST_CONTEXT(ctx);
+      GLfloat lambda[PROG_BATCH_SIZE] = { 0.0F }, rgba[PROG_BATCH_SIZE][4];
+
+      for (i = 0; i < n; i++)
+         lambda[i] = CLAMP(lodBias[i], texObj->MinLod, texObj->MaxLod);
+
+      swrast->TextureSample[unit](ctx, texObj, n, texcoord, lambda, rgba);
+
+      for (i = 0; i < n; i++)
+         swizzle_texel(rgba[i], color[i], texObj->_Swizzle);
+   }
+   else {
+      for (i = 0; i < n; i++)
+         ASSIGN_4V(color[i], 0.0F, 0.0F, 0.0F, 1.0F);
+   }
+}
+
+
+/**
+ * Fetch texels for a batch of fragments, computing the level of detail
+ * from the texcoord's partial derivatives like fetch_texel_deriv().
+ * Called via gl_program_batch_machine::FetchTexelsDeriv().
+ */
+static void
+fetch_texels_deriv(GLcontext *ctx, GLuint n, const GLfloat texcoord[][4],
+                   const GLfloat texdx[4], const GLfloat texdy[4],
+                   const GLfloat lodBias[], GLuint unit, GLfloat color[][4])
+{
+   const struct gl_texture_object *texObj = ctx->Texture.Unit[unit]._Current;
+   GLuint i;
+
+   if (texObj) {
+      SWcontext *swrast = SWRAST_CONTEXT(ctx);
+      const struct gl_texture_image *texImg =
+         texObj->Image[0][texObj->BaseLevel];
+      const GLfloat texW = (GLfloat) texImg->WidthScale;
+      const GLfloat texH = (GLfloat) texImg->HeightScale;
+      GLfloat lambda[PROG_BATCH_SIZE] = { 0.0F }, rgba[PROG_BATCH_SIZE][4];
+
+      for (i = 0; i < n; i++) {
+         lambda[i] = _swrast_compute_lambda(texdx[0], texdy[0],
+                                            texdx[1], texdy[1],
+                                            texdx[3], texdy[2],
+                                            texW, texH,
+                                            texcoord[i][0], texcoord[i][1],
+                                            texcoord[i][3],
+                                            1.0F / texcoord[i][3])
+                   + lodBias[i];
+         lambda[i] = CLAMP(lambda[i], texObj->MinLod, texObj->MaxLod);
+      }
+
+      swrast->TextureSample[unit](ctx, texObj, n, texcoord, lambda, rgba);
+
+      for (i = 0; i < n; i++)
+         swizzle_texel(rgba[i], color[i], texObj->_Swizzle);
+   }
+   else {
+      for (i = 0; i < n; i++)
+         ASSIGN_4V(color[i], 0.0F, 0.0F, 0.0F, 1.0F);
+   }
+}
+
+
+/**
+ * Run fragment program on the pixels in span from 'start' to 'end' - 1,
+ * PROG_BATCH_SIZE pixels at a time.  Only used for programs accepted by
+ * _mesa_program_batchable(); the results must match run_program().
+ */
+static void
+run_program_batched(GLcontext *ctx, SWspan *span, GLuint start, GLuint end)
+{
+   SWcontext *swrast = SWRAST_CONTEXT(ctx);
+   const struct gl_fragment_program *program = ctx->FragmentProgram._Current;
+   const GLbitfield outputsWritten = program->Base.OutputsWritten;
+   struct gl_program_batch_machine *machine = swrast->FragProgBatch;
+   GLuint attr, i, k;
+
+   machine->NumInputs = FRAG_ATTRIB_MAX;
+   machine->DerivX = (GLfloat (*)[4]) span->attrStepX;
+   machine->DerivY = (GLfloat (*)[4]) span->attrStepY;
+   machine->NumDeriv = FRAG_ATTRIB_MAX;
+   machine->Samplers = program->Base.SamplerUnits;
+   machine->FetchTexelsLod = fetch_texels_lod;
+   machine->FetchTexelsDeriv = fetch_texels_deriv;
+
+   for (; start < end; start += PROG_BATCH_SIZE) {
+      const GLuint n = MIN2(PROG_BATCH_SIZE, end - start);
+
+      /* skip batches which are entirely masked out */
+      for (k = 0; k < n; k++) {
+         if (span->array->mask[start + k])
+            break;
+      }
+      if (k == n)
+         continue;
+
+      /* if running a GLSL program (not ARB_fragment_program) */
+      if (ctx->Shader.CurrentProgram) {
+         /* Store front/back facing value */
+         for (k = 0; k < n; k++)
+            span->array->attribs[FRAG_ATTRIB_FACE][start + k][0]
+               = 1.0F - span->facing;
+      }
+
+      for (attr = 0; attr < FRAG_ATTRIB_MAX; attr++)
+         machine->Inputs[attr] =
+            (const GLfloat (*)[4]) &span->array->attribs[attr][start];
+
+      if (_mesa_execute_program_batch(ctx, &program->Base, machine, n)) {
+         for (k = 0; k < n; k++) {
+            if (machine->Killed[k]) {
+               span->array->mask[start + k] = GL_FALSE;
+               span->writeAll = GL_FALSE;
+            }
+         }
+      }
+
+      for (k = 0; k < n; k++) {
+         i = start + k;
+
+         if (!span->array->mask[i])
+            continue;
+
+         /* Store result color */
+         if (outputsWritten & (1 << FRAG_RESULT_COLOR)) {
+            COPY_4V(span->array->attribs[FRAG_ATTRIB_COL0][i],
+                    machine->Outputs[FRAG_RESULT_COLOR][k]);
+         }
+         else {
+            /* Multiple drawbuffers / render targets */
+            GLuint buf;
+            for (buf = 0; buf < ctx->DrawBuffer->_NumColorDrawBuffers; buf++) {
+               if (outputsWritten & (1 << (FRAG_RESULT_DATA0 + buf))) {
+                  COPY_4V(span->array->attribs[FRAG_ATTRIB_COL0 + buf][i],
+                          machine->Outputs[FRAG_RESULT_DATA0 + buf][k]);
+               }
+            }
+         }
+
+         /* Store result depth/z */
+         if (outputsWritten & (1 << FRAG_RESULT_DEPTH)) {
+            const GLfloat depth = machine->Outputs[FRAG_RESULT_DEPTH][k][2];
+            if (depth <= 0.0)
+               span->array->z[i] = 0;
+            else if (depth >= 1.0)
+               span->array->z[i] = ctx->DrawBuffer->_DepthMax;
+            else
+               span->array->z[i] = IROUND(depth * ctx->DrawBuffer->_DepthMaxF);
+         }
+      }
+   }
+}
+
 /**
  * Execute the current fragment program for all the fragments
  * in the given span.
@@ -242,6 +409,7 @@ run_program(GLcontext *ctx, SWspan *span, GLuint start, GLuint end)
 void
 _swrast_exec_fragment_program( GLcontext *ctx, SWspan *span )
 {
+   SWcontext *swrast = SWRAST_CONTEXT(ctx);
    const struct gl_fragment_program *program = ctx->FragmentProgram._Current;
 
    /* incoming colors should be floats */
@@ -249,7 +417,16 @@ _swrast_exec_fragment_program( GLcontext *ctx, SWspan *span )
       ASSERT(span->array->ChanType == GL_FLOAT);
    }
 
-   run_program(ctx, span, 0, span->end);
+   if (swrast->_FragProgBatched) {
+      if (!swrast->FragProgBatch)
+         swrast->FragProgBatch = (struct gl_program_batch_machine *)
+            CALLOC(sizeof(struct gl_program_batch_machine));
+   }
+
+   if (swrast->_FragProgBatched && swrast->FragProgBatch)
+      run_program_batched(ctx, span, 0, span->end);
+   else
+      run_program(ctx, span, 0, span->end);
 
    if (program->Base.OutputsWritten & (1 << FRAG_RESULT_COLOR)) {
       span->interpMask &= ~SPAN_RGBA;
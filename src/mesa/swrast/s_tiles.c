@@ -0,0 +1,658 @@
+/*
+ * Mesa 3-D graphics library
+ * Version:  7.7
+ *
+ * Copyright (C) 1999-2007  Brian Paul   All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * BRIAN PAUL BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * \file s_tiles.c
+ * Render triangles in screen tiles on several threads.
+ *
+ * While a vertex buffer is being rendered (between _swrast_render_start()
+ * and _swrast_render_finish()) triangles are not drawn right away but
+ * copied and binned into the TILE_SIZE x TILE_SIZE screen tiles their
+ * bounding box touches.  The bins are flushed when the vertex buffer is
+ * finished, when TILE_MAX_TRIS triangles have piled up, or before a point
+ * or line is drawn.  Flushing hands out whole tiles to the threads, each
+ * of which draws the tile's triangles in submission order with the half-
+ * space rasterizer clipped to the tile.  As every pixel belongs to
+ * exactly one tile the result is the same as drawing them one by one, and
+ * nothing is left pending once the vertex buffer is done, so glFinish,
+ * readback and swaps need no extra synchronization.
+ *
+ * Each thread has its own span arrays and texel buffer; all other swrast
+ * state is only read while the tiles are drawn.  Tiling is only used for
+ * state whose fragment processing has no other side effects (no fragment
+ * programs or occlusion queries) and for framebuffers whose renderbuffers
+ * all live in memory.
+ *
+ * Threads are only used when the MESA_SWRAST_THREADS environment variable
+ * asks for more than one; the calling thread always draws tiles too.
+ */
+
+
+#include "main/glheader.h"
+#include "main/colormac.h"
+#include "main/imports.h"
+#include "main/macros.h"
+#include "main/mtypes.h"
+#include "glapi/glthread.h"
+
+#include "s_blend.h"
+#include "s_context.h"
+#include "s_tiles.h"
+
+
+#define SWRAST_MAX_THREADS  8
+#define TILE_SIZE           64
+#define TILE_MAX_TRIS       1024
+
+
+#ifdef PTHREADS
+
+/** The tile thread state of the calling thread */
+static _glthread_TSD TileThreadTSD;
+_glthread_DECLARE_STATIC_MUTEX(TileThreadTSDMutex);
+
+
+/**
+ * A binned triangle.  The vertices are copied as swrast_setup modifies
+ * and restores them around calls to the triangle function.
+ */
+struct tile_tri {
+   SWvertex v[3];
+};
+
+/**
+ * Indexes of the triangles touching a tile, in submission order.
+ */
+struct tile_bin {
+   GLuint *tris;
+   GLuint count;
+   GLuint size;
+};
+
+struct tile_worker {
+   struct swrast_tiles *tiles;
+   SWtilethread state;
+   GLuint id;
+   pthread_t thread;
+};
+
+struct swrast_tiles {
+   GLcontext *ctx;
+   GLuint nr_threads;		/**< including the calling thread */
+   GLboolean binning;		/**< between render start and finish */
+
+   struct tile_tri *tris;
+   GLuint nr_tris;
+
+   struct tile_bin *bins;
+   GLuint nr_bins;		/**< allocated, at least tiles_x * tiles_y */
+   GLuint tiles_x, tiles_y;	/**< tiles of the current draw buffer */
+
+   struct tile_worker worker[SWRAST_MAX_THREADS];
+   _glthread_Mutex mutex;
+   _glthread_Cond work;		/**< signalled when a flush is posted */
+   _glthread_Cond done;		/**< signalled when the last worker finishes */
+   GLuint generation;
+   GLuint pending;
+   GLuint next_tile;
+   GLboolean quit;
+};
+
+
+SWtilethread *
+_swrast_tile_thread(void)
+{
+   return (SWtilethread *) _glthread_GetTSD(&TileThreadTSD);
+}
+
+
+/**
+ * Draw tiles until there are none left.
+ */
+static void
+render_tiles( struct swrast_tiles *tiles, SWtilethread *thread )
+{
+   GLcontext *ctx = tiles->ctx;
+   const SWcontext *swrast = SWRAST_CONTEXT(ctx);
+   const GLuint nr_tiles = tiles->tiles_x * tiles->tiles_y;
+
+   for (;;) {
+      struct tile_bin *bin;
+      GLuint t, i;
+
+      _glthread_LOCK_MUTEX(tiles->mutex);
+      t = tiles->next_tile++;
+      _glthread_UNLOCK_MUTEX(tiles->mutex);
+
+      if (t >= nr_tiles)
+         break;
+
+      bin = &tiles->bins[t];
+      if (!bin->count)
+         continue;
+
+      thread->Xmin = (t % tiles->tiles_x) * TILE_SIZE;
+      thread->Xmax = thread->Xmin + TILE_SIZE - 1;
+      thread->Ymin = (t / tiles->tiles_x) * TILE_SIZE;
+      thread->Ymax = thread->Ymin + TILE_SIZE - 1;
+
+      for (i = 0; i < bin->count; i++) {
+         const struct tile_tri *tri = &tiles->tris[bin->tris[i]];
+         swrast->TileTriangle( ctx, &tri->v[0], &tri->v[1], &tri->v[2] );
+      }
+
+      bin->count = 0;
+   }
+}
+
+
+static void *
+worker_main( void *data )
+{
+   struct tile_worker *worker = (struct tile_worker *) data;
+   struct swrast_tiles *tiles = worker->tiles;
+   GLuint generation = 0;
+
+   _glthread_SetTSD(&TileThreadTSD, &worker->state);
+
+   for (;;) {
+      unsigned short __tmp;
+
+      _glthread_LOCK_MUTEX(tiles->mutex);
+      while (!tiles->quit && tiles->generation == generation)
+	 _glthread_COND_WAIT(tiles->work, tiles->mutex);
+      generation = tiles->generation;
+      if (tiles->quit) {
+	 _glthread_UNLOCK_MUTEX(tiles->mutex);
+	 break;
+      }
+      _glthread_UNLOCK_MUTEX(tiles->mutex);
+
+      START_FAST_MATH(__tmp);
+      render_tiles( tiles, &worker->state );
+      END_FAST_MATH(__tmp);
+
+      _glthread_LOCK_MUTEX(tiles->mutex);
+      if (--tiles->pending == 0)
+	 _glthread_COND_SIGNAL(tiles->done);
+      _glthread_UNLOCK_MUTEX(tiles->mutex);
+   }
+
+   return NULL;
+}
+
+
+static GLboolean
+alloc_thread_state( GLcontext *ctx, SWtilethread *state )
+{
+   state->SpanArrays = MALLOC_STRUCT(sw_span_arrays);
+   state->TexelBuffer = (GLfloat *) MALLOC(ctx->Const.MaxTextureImageUnits *
+                                           MAX_WIDTH * 4 * sizeof(GLfloat));
+   if (!state->SpanArrays || !state->TexelBuffer)
+      return GL_FALSE;
+
+   state->SpanArrays->ChanType = CHAN_TYPE;
+#if CHAN_TYPE == GL_UNSIGNED_BYTE
+   state->SpanArrays->rgba = state->SpanArrays->rgba8;
+#elif CHAN_TYPE == GL_UNSIGNED_SHORT
+   state->SpanArrays->rgba = state->SpanArrays->rgba16;
+#else
+   state->SpanArrays->rgba = state->SpanArrays->attribs[FRAG_ATTRIB_COL0];
+#endif
+   return GL_TRUE;
+}
+
+
+static void
+free_thread_state( SWtilethread *state )
+{
+   if (state->SpanArrays)
+      FREE(state->SpanArrays);
+   if (state->TexelBuffer)
+      FREE(state->TexelBuffer);
+}
+
+
+void
+_swrast_create_tiles( GLcontext *ctx )
+{
+   SWcontext *swrast = SWRAST_CONTEXT(ctx);
+   struct swrast_tiles *tiles;
+   const char *env = _mesa_getenv("MESA_SWRAST_THREADS");
+   GLint nr_threads = env ? _mesa_atoi(env) : 0;
+   GLint i;
+
+   if (nr_threads <= 1)
+      return;
+
+   tiles = CALLOC_STRUCT(swrast_tiles);
+   if (!tiles)
+      return;
+
+   tiles->tris = (struct tile_tri *)
+      MALLOC(TILE_MAX_TRIS * sizeof(struct tile_tri));
+   if (!tiles->tris) {
+      FREE(tiles);
+      return;
+   }
+
+   _glthread_LOCK_MUTEX(TileThreadTSDMutex);
+   (void) _glthread_GetTSD(&TileThreadTSD);
+   _glthread_UNLOCK_MUTEX(TileThreadTSDMutex);
+
+   tiles->ctx = ctx;
+   _glthread_INIT_MUTEX(tiles->mutex);
+   _glthread_INIT_COND(tiles->work);
+   _glthread_INIT_COND(tiles->done);
+
+   /* The calling thread uses the context's own buffers.
+    */
+   tiles->worker[0].tiles = tiles;
+   tiles->worker[0].state.SpanArrays = swrast->SpanArrays;
+   tiles->worker[0].state.TexelBuffer = swrast->TexelBuffer;
+
+   nr_threads = MIN2(nr_threads, SWRAST_MAX_THREADS);
+   for (i = 1; i < nr_threads; i++) {
+      struct tile_worker *worker = &tiles->worker[i];
+      worker->tiles = tiles;
+      worker->id = i;
+      if (!alloc_thread_state(ctx, &worker->state)) {
+         free_thread_state(&worker->state);
+         break;
+      }
+      if (pthread_create(&worker->thread, NULL, worker_main, worker) != 0) {
+         free_thread_state(&worker->state);
+         break;
+      }
+   }
+
+   /* Make do with the threads we got.
+    */
+   tiles->nr_threads = i;
+   swrast->Tiles = tiles;
+
+   if (tiles->nr_threads < 2)
+      _swrast_destroy_tiles( ctx );
+}
+
+
+void
+_swrast_destroy_tiles( GLcontext *ctx )
+{
+   SWcontext *swrast = SWRAST_CONTEXT(ctx);
+   struct swrast_tiles *tiles = swrast->Tiles;
+   GLuint i;
+
+   if (!tiles)
+      return;
+
+   _glthread_LOCK_MUTEX(tiles->mutex);
+   tiles->quit = GL_TRUE;
+   _glthread_COND_BROADCAST(tiles->work);
+   _glthread_UNLOCK_MUTEX(tiles->mutex);
+
+   for (i = 1; i < tiles->nr_threads; i++) {
+      pthread_join(tiles->worker[i].thread, NULL);
+      free_thread_state(&tiles->worker[i].state);
+   }
+
+   _glthread_DESTROY_COND(tiles->work);
+   _glthread_DESTROY_COND(tiles->done);
+   _glthread_DESTROY_MUTEX(tiles->mutex);
+
+   for (i = 0; i < tiles->nr_bins; i++)
+      if (tiles->bins[i].tris)
+         FREE(tiles->bins[i].tris);
+   if (tiles->bins)
+      FREE(tiles->bins);
+   FREE(tiles->tris);
+   FREE(tiles);
+   swrast->Tiles = NULL;
+}
+
+
+/**
+ * Can triangles be drawn in tiles with the current state?  Called when
+ * choosing the triangle function.
+ */
+GLboolean
+_swrast_tiles_allowed( GLcontext *ctx )
+{
+   return SWRAST_CONTEXT(ctx)->Tiles &&
+          !ctx->Query.CurrentOcclusionObject &&
+          !ctx->FragmentProgram._Current &&
+          !ctx->ATIFragmentShader._Enabled;
+}
+
+
+/**
+ * Do all the renderbuffers we may draw to live in memory?  Others may
+ * need a driver call per span, which is not thread safe.
+ */
+static GLboolean
+buffers_in_memory( const struct gl_framebuffer *fb )
+{
+   GLuint i;
+
+   for (i = 0; i < fb->_NumColorDrawBuffers; i++)
+      if (fb->_ColorDrawBuffers[i] && !fb->_ColorDrawBuffers[i]->Data)
+         return GL_FALSE;
+
+   if (fb->_DepthBuffer && !fb->_DepthBuffer->Data)
+      return GL_FALSE;
+
+   if (fb->_StencilBuffer && !fb->_StencilBuffer->Data)
+      return GL_FALSE;
+
+   return GL_TRUE;
+}
+
+
+/**
+ * Start binning the triangles of a vertex buffer, if the framebuffer
+ * allows it.
+ */
+void
+_swrast_tiles_render_start( GLcontext *ctx )
+{
+   struct swrast_tiles *tiles = SWRAST_CONTEXT(ctx)->Tiles;
+   const struct gl_framebuffer *fb = ctx->DrawBuffer;
+   GLuint tiles_x, tiles_y, nr_bins;
+
+   ASSERT(tiles->nr_tris == 0);
+   tiles->binning = GL_FALSE;
+
+   if (!fb || !buffers_in_memory(fb))
+      return;
+
+   tiles_x = (fb->Width + TILE_SIZE - 1) / TILE_SIZE;
+   tiles_y = (fb->Height + TILE_SIZE - 1) / TILE_SIZE;
+   nr_bins = tiles_x * tiles_y;
+
+   if (nr_bins > tiles->nr_bins) {
+      struct tile_bin *bins = (struct tile_bin *)
+         _mesa_realloc(tiles->bins, tiles->nr_bins * sizeof(struct tile_bin),
+                       nr_bins * sizeof(struct tile_bin));
+      if (!bins)
+         return;
+      _mesa_bzero(bins + tiles->nr_bins,
+                  (nr_bins - tiles->nr_bins) * sizeof(struct tile_bin));
+      tiles->bins = bins;
+      tiles->nr_bins = nr_bins;
+   }
+
+   tiles->tiles_x = tiles_x;
+   tiles->tiles_y = tiles_y;
+   tiles->binning = GL_TRUE;
+}
+
+
+void
+_swrast_tiles_render_finish( GLcontext *ctx )
+{
+   struct swrast_tiles *tiles = SWRAST_CONTEXT(ctx)->Tiles;
+
+   _swrast_flush_tiles( ctx );
+   tiles->binning = GL_FALSE;
+}
+
+
+/**
+ * Draw all binned triangles.
+ */
+void
+_swrast_flush_tiles( GLcontext *ctx )
+{
+   SWcontext *swrast = SWRAST_CONTEXT(ctx);
+   struct swrast_tiles *tiles = swrast->Tiles;
+   SWtilethread *thread = &tiles->worker[0].state;
+
+   if (!tiles->nr_tris)
+      return;
+
+   /* The blend function is otherwise chosen lazily on first use.
+    */
+   if (swrast->_RasterMask & BLEND_BIT)
+      _swrast_choose_blend_func( ctx, CHAN_TYPE );
+
+   _glthread_LOCK_MUTEX(tiles->mutex);
+   tiles->next_tile = 0;
+   tiles->pending = tiles->nr_threads - 1;
+   tiles->generation++;
+   _glthread_COND_BROADCAST(tiles->work);
+   _glthread_UNLOCK_MUTEX(tiles->mutex);
+
+   _glthread_SetTSD(&TileThreadTSD, thread);
+   render_tiles( tiles, thread );
+   _glthread_SetTSD(&TileThreadTSD, NULL);
+
+   _glthread_LOCK_MUTEX(tiles->mutex);
+   while (tiles->pending)
+      _glthread_COND_WAIT(tiles->done, tiles->mutex);
+   _glthread_UNLOCK_MUTEX(tiles->mutex);
+
+   tiles->nr_tris = 0;
+}
+
+
+/**
+ * Make room for one more triangle in the bins of tiles [tx0..tx1] x
+ * [ty0..ty1].
+ */
+static GLboolean
+grow_bins( struct swrast_tiles *tiles, GLuint tx0, GLuint tx1,
+           GLuint ty0, GLuint ty1 )
+{
+   GLuint tx, ty;
+
+   for (ty = ty0; ty <= ty1; ty++) {
+      for (tx = tx0; tx <= tx1; tx++) {
+         struct tile_bin *bin = &tiles->bins[ty * tiles->tiles_x + tx];
+         if (bin->count == bin->size) {
+            const GLuint size = MAX2(2 * bin->size, 64);
+            GLuint *tris = (GLuint *)
+               _mesa_realloc(bin->tris, bin->size * sizeof(GLuint),
+                             size * sizeof(GLuint));
+            if (!tris)
+               return GL_FALSE;
+            bin->tris = tris;
+            bin->size = size;
+         }
+      }
+   }
+
+   return GL_TRUE;
+}
+
+
+/**
+ * Copy the parts of a vertex the triangle functions use.
+ */
+static INLINE void
+copy_vertex( const SWcontext *swrast, SWvertex *dst, const SWvertex *src )
+{
+   GLuint i;
+
+   COPY_4V(dst->attrib[FRAG_ATTRIB_WPOS], src->attrib[FRAG_ATTRIB_WPOS]);
+   COPY_4V(dst->attrib[FRAG_ATTRIB_CI], src->attrib[FRAG_ATTRIB_CI]);
+   for (i = 0; i < swrast->_NumActiveAttribs; i++) {
+      const GLuint attr = swrast->_ActiveAttribs[i];
+      COPY_4V(dst->attrib[attr], src->attrib[attr]);
+   }
+   COPY_CHAN4(dst->color, src->color);
+}
+
+
+/**
+ * Return floor(f) clamped to [lo, hi], or 'nan' if f is not a number.
+ */
+static INLINE GLint
+pixel_bound( GLfloat f, GLint lo, GLint hi, GLint nan )
+{
+   if (f < (GLfloat) lo)
+      return lo;
+   if (f > (GLfloat) hi)
+      return hi;
+   if (f >= (GLfloat) lo)
+      return IFLOOR(f);
+   return nan;
+}
+
+
+/**
+ * Called via swrast->Triangle when tiling is possible for the current
+ * state.  Bins the triangle, or draws it right away outside of vertex
+ * buffer rendering.
+ */
+void
+_swrast_tile_triangle( GLcontext *ctx,
+                       const SWvertex *v0,
+                       const SWvertex *v1,
+                       const SWvertex *v2 )
+{
+   SWcontext *swrast = SWRAST_CONTEXT(ctx);
+   struct swrast_tiles *tiles = swrast->Tiles;
+   const struct gl_framebuffer *fb = ctx->DrawBuffer;
+   GLfloat minx, maxx, miny, maxy;
+   GLint x0, x1, y0, y1;
+   GLuint tx, ty, tri;
+
+   if (!tiles->binning) {
+      swrast->TileTriangle( ctx, v0, v1, v2 );
+      return;
+   }
+
+   /* Pixel bounds of the triangle, with a pixel to spare for the
+    * rasterizer's sample offsets.  NaNs give the whole draw buffer.
+    */
+   minx = MIN2(MIN2(v0->attrib[FRAG_ATTRIB_WPOS][0],
+                    v1->attrib[FRAG_ATTRIB_WPOS][0]),
+               v2->attrib[FRAG_ATTRIB_WPOS][0]);
+   maxx = MAX2(MAX2(v0->attrib[FRAG_ATTRIB_WPOS][0],
+                    v1->attrib[FRAG_ATTRIB_WPOS][0]),
+               v2->attrib[FRAG_ATTRIB_WPOS][0]);
+   miny = MIN2(MIN2(v0->attrib[FRAG_ATTRIB_WPOS][1],
+                    v1->attrib[FRAG_ATTRIB_WPOS][1]),
+               v2->attrib[FRAG_ATTRIB_WPOS][1]);
+   maxy = MAX2(MAX2(v0->attrib[FRAG_ATTRIB_WPOS][1],
+                    v1->attrib[FRAG_ATTRIB_WPOS][1]),
+               v2->attrib[FRAG_ATTRIB_WPOS][1]);
+
+   x0 = MAX2(pixel_bound(minx, fb->_Xmin, fb->_Xmax - 1, fb->_Xmin) - 1,
+             fb->_Xmin);
+   x1 = MIN2(pixel_bound(maxx, fb->_Xmin, fb->_Xmax - 1, fb->_Xmax - 1) + 1,
+             fb->_Xmax - 1);
+   y0 = MAX2(pixel_bound(miny, fb->_Ymin, fb->_Ymax - 1, fb->_Ymin) - 1,
+             MAX2(fb->_Ymin, 0));
+   y1 = MIN2(pixel_bound(maxy, fb->_Ymin, fb->_Ymax - 1, fb->_Ymax - 1) + 1,
+             fb->_Ymax - 1);
+   if (x0 > x1 || y0 > y1)
+      return;
+
+   /* Fragments of points buffered earlier must land first.
+    */
+   if (swrast->PointSpan.end > 0)
+      _swrast_flush( ctx );
+
+   if (tiles->nr_tris == TILE_MAX_TRIS)
+      _swrast_flush_tiles( ctx );
+
+   if (!grow_bins(tiles, x0 / TILE_SIZE, x1 / TILE_SIZE,
+                  y0 / TILE_SIZE, y1 / TILE_SIZE)) {
+      _swrast_flush_tiles( ctx );
+      swrast->TileTriangle( ctx, v0, v1, v2 );
+      return;
+   }
+
+   tri = tiles->nr_tris++;
+   copy_vertex( swrast, &tiles->tris[tri].v[0], v0 );
+   copy_vertex( swrast, &tiles->tris[tri].v[1], v1 );
+   copy_vertex( swrast, &tiles->tris[tri].v[2], v2 );
+
+   for (ty = y0 / TILE_SIZE; ty <= (GLuint) y1 / TILE_SIZE; ty++) {
+      for (tx = x0 / TILE_SIZE; tx <= (GLuint) x1 / TILE_SIZE; tx++) {
+         struct tile_bin *bin = &tiles->bins[ty * tiles->tiles_x + tx];
+         bin->tris[bin->count++] = tri;
+      }
+   }
+}
+
+
+#else /* PTHREADS */
+
+
+SWtilethread *
+_swrast_tile_thread(void)
+{
+   return NULL;
+}
+
+void
+_swrast_create_tiles( GLcontext *ctx )
+{
+   (void) ctx;
+}
+
+void
+_swrast_destroy_tiles( GLcontext *ctx )
+{
+   (void) ctx;
+}
+
+GLboolean
+_swrast_tiles_allowed( GLcontext *ctx )
+{
+   (void) ctx;
+   return GL_FALSE;
+}
+
+void
+_swrast_tiles_render_start( GLcontext *ctx )
+{
+   (void) ctx;
+}
+
+void
+_swrast_tiles_render_finish( GLcontext *ctx )
+{
+   (void) ctx;
+}
+
+void
+_swrast_flush_tiles( GLcontext *ctx )
+{
+   (void) ctx;
+}
+
+void
+_swrast_tile_triangle( GLcontext *ctx,
+                       const SWvertex *v0,
+                       const SWvertex *v1,
+                       const SWvertex *v2 )
+{
+   SWRAST_CONTEXT(ctx)->TileTriangle( ctx, v0, v1, v2 );
+}
+
+
+#endif /* PTHREADS */
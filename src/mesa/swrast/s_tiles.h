@@ -0,0 +1,58 @@
+/*
+ * Mesa 3-D graphics library
+ * Version:  7.7
+ *
+ * Copyright (C) 1999-2007  Brian Paul   All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * BRIAN PAUL BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#ifndef S_TILES_H
+#define S_TILES_H
+
+
+#include "swrast.h"
+
+
+extern void
+_swrast_create_tiles( GLcontext *ctx );
+
+extern void
+_swrast_destroy_tiles( GLcontext *ctx );
+
+extern GLboolean
+_swrast_tiles_allowed( GLcontext *ctx );
+
+extern void
+_swrast_tiles_render_start( GLcontext *ctx );
+
+extern void
+_swrast_tiles_render_finish( GLcontext *ctx );
+
+extern void
+_swrast_flush_tiles( GLcontext *ctx );
+
+extern void
+_swrast_tile_triangle( GLcontext *ctx,
+                       const SWvertex *v0,
+                       const SWvertex *v1,
+                       const SWvertex *v2 );
+
+
+#endif
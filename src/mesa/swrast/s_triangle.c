@@ -41,6 +41,7 @@
 #include "s_context.h"
 #include "s_feedback.h"
 #include "s_span.h"
+#include "s_tiles.h"
 #include "s_triangle.h"
 
 
@@ -77,7 +78,7 @@ _swrast_culltriangle( GLcontext *ctx,
 #define INTERP_ATTRIBS 1  /* just for fog */
 #define INTERP_INDEX 1
 #define RENDER_SPAN( span )  _swrast_write_index_span(ctx, &span);
-#include "s_tritemp.h"
+#include "s_triblocktemp.h"
 
 
 
@@ -99,7 +100,7 @@ _swrast_culltriangle( GLcontext *ctx,
    span.blueStep = 0;				\
    span.alphaStep = 0;
 #define RENDER_SPAN( span )  _swrast_write_rgba_span(ctx, &span);
-#include "s_tritemp.h"
+#include "s_triblocktemp.h"
 
 
 
@@ -117,7 +118,7 @@ _swrast_culltriangle( GLcontext *ctx,
       ASSERT(ctx->Light.ShadeModel==GL_SMOOTH);	\
    }
 #define RENDER_SPAN( span )  _swrast_write_rgba_span(ctx, &span);
-#include "s_tritemp.h"
+#include "s_triblocktemp.h"
 
 
 
@@ -863,7 +864,7 @@ fast_persp_span(GLcontext *ctx, SWspan *span,
 #define INTERP_ALPHA 1
 #define INTERP_ATTRIBS 1
 #define RENDER_SPAN( span )   _swrast_write_rgba_span(ctx, &span);
-#include "s_tritemp.h"
+#include "s_triblocktemp.h"
 
 
 
@@ -1012,6 +1013,10 @@ _swrast_choose_triangle( GLcontext *ctx )
    }
 
    if (ctx->RenderMode==GL_RENDER) {
+      /* Bin the triangles into screen tiles for the tile threads?  Only
+       * the half-space rasterizers can be clipped to a tile.
+       */
+      const GLboolean tiled = _swrast_tiles_allowed(ctx);
 
       if (ctx->Polygon.SmoothFlag) {
          _swrast_set_aa_triangle_function(ctx);
@@ -1037,16 +1042,14 @@ _swrast_choose_triangle( GLcontext *ctx )
          }
       }
 
-      if (!rgbmode) {
-         USE(ci_triangle);
-         return;
-      }
-
       /*
        * XXX should examine swrast->_ActiveAttribMask to determine what
        * needs to be interpolated.
        */
-      if (ctx->Texture._EnabledCoordUnits ||
+      if (!rgbmode) {
+         USE(ci_triangle);
+      }
+      else if (ctx->Texture._EnabledCoordUnits ||
           ctx->FragmentProgram._Current ||
           ctx->ATIFragmentShader._Enabled ||
           NEED_SECONDARY_COLOR(ctx) ||
@@ -1065,7 +1068,8 @@ _swrast_choose_triangle( GLcontext *ctx )
          envMode = ctx->Texture.Unit[0].EnvMode;
 
          /* First see if we can use an optimized 2-D texture function */
-         if (ctx->Texture._EnabledCoordUnits == 0x1
+         if (!tiled
+             && ctx->Texture._EnabledCoordUnits == 0x1
              && !ctx->FragmentProgram._Current
              && !ctx->ATIFragmentShader._Enabled
              && ctx->Texture.Unit[0]._ReallyEnabled == TEXTURE_2D_BIT
@@ -1139,6 +1143,11 @@ _swrast_choose_triangle( GLcontext *ctx )
 #endif
 	 }
       }
+
+      if (tiled) {
+         swrast->TileTriangle = swrast->Triangle;
+         USE(_swrast_tile_triangle);
+      }
    }
    else if (ctx->RenderMode==GL_FEEDBACK) {
       USE(_swrast_feedback_triangle);
@@ -0,0 +1,641 @@
+/*
+ * Mesa 3-D graphics library
+ * Version:  7.7
+ *
+ * Copyright (C) 1999-2007  Brian Paul   All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * BRIAN PAUL BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Half-space Triangle Rasterizer Template
+ *
+ * This file is #include'd to generate triangle rasterizers which feed
+ * the generic span functions.  It accepts the same macros as
+ * s_tritemp.h, except for the direct pixel/depth addressing ones:
+ *    INTERP_Z        - if defined, interpolate integer Z values
+ *    INTERP_RGB      - if defined, interpolate integer RGB values
+ *    INTERP_ALPHA    - if defined, interpolate integer Alpha values
+ *    INTERP_INDEX    - if defined, interpolate color index values
+ *    INTERP_ATTRIBS  - if defined, interpolate arbitrary attribs (texcoords,
+ *                         varying vars, etc) and W for perspective correction
+ *
+ * Optionally, one may provide one-time setup code per triangle:
+ *    SETUP_CODE    - code which is to be executed once per triangle
+ *
+ * The following macro MUST be defined:
+ *    RENDER_SPAN(span) - code to write a span of pixels.
+ *
+ * Instead of walking the triangle's edges, the bounding box is visited in
+ * TRI_BLOCK_SIZE x TRI_BLOCK_SIZE pixel blocks.  Each block is tested
+ * against the three edge functions at its corners: blocks entirely
+ * outside an edge are skipped, blocks entirely inside all edges are
+ * accepted without per-pixel work, and only the blocks straddling an
+ * edge test individual pixels.  Since a triangle covers a single run of
+ * pixels on every row, the coverage of a row of blocks is gathered into
+ * one span per scanline, whose interpolants are evaluated directly from
+ * the plane equations.  The span functions interpolate along x only, so
+ * handing them anything but horizontal runs would lose the cheap
+ * per-fragment stepping.
+ *
+ * Vertices are snapped and sampled exactly like s_tritemp.h: a pixel is
+ * inside when its center is on or to the right of a left edge, strictly
+ * to the left of a right edge, on or above a bottom edge and strictly
+ * below a top edge.  The edge functions are evaluated in integer
+ * sub-pixel units so adjacent triangles never crack or overlap.
+ *
+ * Only the pixels inside the draw buffer's clipped bounds are visited,
+ * and on the tile rendering threads (see s_tiles.c) only those of the
+ * current tile.
+ */
+
+
+#ifndef TRI_BLOCK_SIZE
+#define TRI_BLOCK_SIZE 8
+#endif
+
+/*
+ * Some code we unfortunately need to prevent negative interpolated colors.
+ */
+#ifndef CLAMP_INTERPOLANT
+#define CLAMP_INTERPOLANT(CHANNEL, CHANNELSTEP, LEN)		\
+do {								\
+   GLfixed endVal = span.CHANNEL + (LEN) * span.CHANNELSTEP;	\
+   if (endVal < 0) {						\
+      span.CHANNEL -= endVal;					\
+   }								\
+   if (span.CHANNEL < 0) {					\
+      span.CHANNEL = 0;						\
+   }								\
+} while (0)
+#endif
+
+
+static void NAME(GLcontext *ctx, const SWvertex *v0,
+                                 const SWvertex *v1,
+                                 const SWvertex *v2 )
+{
+   const SWcontext *swrast = SWRAST_CONTEXT(ctx);
+   const struct gl_framebuffer *fb = ctx->DrawBuffer;
+#ifdef INTERP_Z
+   const GLint depthBits = fb->Visual.depthBits;
+   const GLint fixedToDepthShift = depthBits <= 16 ? FIXED_SHIFT : 0;
+   const GLfloat maxDepth = fb->_DepthMaxF;
+#define FixedToDepth(F)  ((F) >> fixedToDepthShift)
+#endif
+   const GLint snapMask = ~((FIXED_ONE / (1 << SUB_PIXEL_BITS)) - 1); /* for x/y coord snapping */
+   const GLint subShift = FIXED_SHIFT - SUB_PIXEL_BITS;
+   GLfloat bf = SWRAST_CONTEXT(ctx)->_BackfaceSign;
+   GLint sx[3], sy[3];        /* snapped coords, in sub-pixel units */
+   GLfloat ex1, ey1, ex2, ey2; /* v1 - v0 and v2 - v0, in pixels */
+   GLfloat oneOverArea;
+   int64_t edgeA[3], edgeB[3], edgeC[3];
+   int64_t rejectOfs[3], acceptOfs[3];
+   GLint xmin, xmax, ymin, ymax, bx0, by;
+   GLint bboxXmin, bboxXmax;
+   SWspan span;
+
+   (void) swrast;
+
+   INIT_SPAN(span, GL_POLYGON);
+   span.y = 0; /* silence warnings */
+
+#ifdef INTERP_Z
+   (void) fixedToDepthShift;
+#endif
+
+   /* Compute snapped sub-pixel coords w/ the same half-pixel offsets as
+    * s_tritemp.h.  Pixel (X, Y) is then sampled at ((X+1), Y).
+    */
+   {
+      const SWvertex *v[3];
+      GLuint i;
+      v[0] = v0;  v[1] = v1;  v[2] = v2;
+      for (i = 0; i < 3; i++) {
+         sx[i] = (FloatToFixed(v[i]->attrib[FRAG_ATTRIB_WPOS][0] + 0.5F)
+                  & snapMask) >> subShift;
+         sy[i] = (FloatToFixed(v[i]->attrib[FRAG_ATTRIB_WPOS][1] - 0.5F)
+                  & snapMask) >> subShift;
+      }
+   }
+
+   /* compute area, oneOverArea and perform backface culling */
+   {
+      const int64_t area = (int64_t) (sx[1] - sx[0]) * (sy[2] - sy[0])
+                         - (int64_t) (sx[2] - sx[0]) * (sy[1] - sy[0]);
+      GLfloat farea;
+
+      if (area == 0)
+         return;
+
+      ex1 = (GLfloat) (sx[1] - sx[0]) * (1.0F / (1 << SUB_PIXEL_BITS));
+      ey1 = (GLfloat) (sy[1] - sy[0]) * (1.0F / (1 << SUB_PIXEL_BITS));
+      ex2 = (GLfloat) (sx[2] - sx[0]) * (1.0F / (1 << SUB_PIXEL_BITS));
+      ey2 = (GLfloat) (sy[2] - sy[0]) * (1.0F / (1 << SUB_PIXEL_BITS));
+      farea = ex1 * ey2 - ex2 * ey1;
+
+      if (IS_INF_OR_NAN(farea) || farea == 0.0F)
+         return;
+
+      /* s_tritemp.h's area has the opposite sign */
+      if (-farea * bf * swrast->_BackfaceCullSign < 0.0)
+         return;
+
+      oneOverArea = 1.0F / farea;
+
+      /* 0 = front, 1 = back */
+      span.facing = -oneOverArea * bf > 0.0F;
+
+      /* Edge functions E = A*x + B*y + C, positive inside the triangle.
+       * Pixels exactly on a left or bottom edge are inside, so the other
+       * edges are biased by one to make the test E >= 0 everywhere.
+       */
+      {
+         GLuint i;
+         for (i = 0; i < 3; i++) {
+            const GLuint j = (i + 1) % 3;
+            int64_t a = sy[i] - sy[j];
+            int64_t b = sx[j] - sx[i];
+            int64_t c = -(a * sx[i] + b * sy[i]);
+            if (area < 0) {
+               a = -a;
+               b = -b;
+               c = -c;
+            }
+            if (!(a > 0 || (a == 0 && b > 0)))
+               c -= 1;
+            edgeA[i] = a * (1 << SUB_PIXEL_BITS);  /* per pixel */
+            edgeB[i] = b * (1 << SUB_PIXEL_BITS);
+            edgeC[i] = c;
+            /* offsets from a block's first pixel to the block corner
+             * where the edge function is largest / smallest
+             */
+            rejectOfs[i] = (edgeA[i] > 0 ? edgeA[i] : 0) * (TRI_BLOCK_SIZE - 1)
+                         + (edgeB[i] > 0 ? edgeB[i] : 0) * (TRI_BLOCK_SIZE - 1);
+            acceptOfs[i] = (edgeA[i] < 0 ? edgeA[i] : 0) * (TRI_BLOCK_SIZE - 1)
+                         + (edgeB[i] < 0 ? edgeB[i] : 0) * (TRI_BLOCK_SIZE - 1);
+         }
+      }
+   }
+
+   /* Pixel bounding box, clipped to the draw buffer bounds and tile.  The
+    * samples of column X are at sub-pixel x = (X+1) << SUB_PIXEL_BITS.
+    */
+   {
+      const GLint minx = MIN2(MIN2(sx[0], sx[1]), sx[2]);
+      const GLint maxx = MAX2(MAX2(sx[0], sx[1]), sx[2]);
+      const GLint miny = MIN2(MIN2(sy[0], sy[1]), sy[2]);
+      const GLint maxy = MAX2(MAX2(sy[0], sy[1]), sy[2]);
+      bboxXmin = xmin = -((-minx) >> SUB_PIXEL_BITS) - 1;
+      bboxXmax = xmax = (maxx >> SUB_PIXEL_BITS) - 1;
+      ymin = -((-miny) >> SUB_PIXEL_BITS);
+      ymax = maxy >> SUB_PIXEL_BITS;
+      xmin = MAX2(xmin, fb->_Xmin);
+      xmax = MIN2(xmax, fb->_Xmax - 1);
+      ymin = MAX2(MAX2(ymin, fb->_Ymin), 0);
+      ymax = MIN2(ymax, fb->_Ymax - 1);
+      if (swrast->Tiles) {
+         const SWtilethread *tile = _swrast_tile_thread();
+         if (tile) {
+            xmin = MAX2(xmin, tile->Xmin);
+            xmax = MIN2(xmax, tile->Xmax);
+            ymin = MAX2(ymin, tile->Ymin);
+            ymax = MIN2(ymax, tile->Ymax);
+         }
+      }
+      if (xmin > xmax || ymin > ymax)
+         return;
+   }
+
+   {
+      /* d?/dx and d?/dy derivatives, in pixels */
+#define PLANE_DX(D1, D2)  (oneOverArea * ((D1) * ey2 - (D2) * ey1))
+#define PLANE_DY(D1, D2)  (oneOverArea * ((D2) * ex1 - (D1) * ex2))
+#ifdef INTERP_Z
+      GLfloat z0;
+#endif
+#ifdef INTERP_RGB
+      GLfloat r0, g0, b0, drdy, dgdy, dbdy;
+#endif
+#ifdef INTERP_ALPHA
+      GLfloat a0, dady;
+#endif
+#ifdef INTERP_INDEX
+      GLfloat i0, didx, didy;
+#endif
+#ifdef INTERP_ATTRIBS
+      GLfloat attr0[FRAG_ATTRIB_MAX][4];
+#endif
+
+      /*
+       * Execute user-supplied setup code
+       */
+#ifdef SETUP_CODE
+      SETUP_CODE
+#endif
+
+#ifdef INTERP_Z
+      span.interpMask |= SPAN_Z;
+      {
+         const GLfloat dz1 = v1->attrib[FRAG_ATTRIB_WPOS][2] - v0->attrib[FRAG_ATTRIB_WPOS][2];
+         const GLfloat dz2 = v2->attrib[FRAG_ATTRIB_WPOS][2] - v0->attrib[FRAG_ATTRIB_WPOS][2];
+         z0 = v0->attrib[FRAG_ATTRIB_WPOS][2];
+         span.attrStepX[FRAG_ATTRIB_WPOS][2] = PLANE_DX(dz1, dz2);
+         if (span.attrStepX[FRAG_ATTRIB_WPOS][2] > maxDepth ||
+             span.attrStepX[FRAG_ATTRIB_WPOS][2] < -maxDepth) {
+            /* probably a sliver triangle */
+            span.attrStepX[FRAG_ATTRIB_WPOS][2] = 0.0;
+            span.attrStepY[FRAG_ATTRIB_WPOS][2] = 0.0;
+         }
+         else {
+            span.attrStepY[FRAG_ATTRIB_WPOS][2] = PLANE_DY(dz1, dz2);
+         }
+         if (depthBits <= 16)
+            span.zStep = SignedFloatToFixed(span.attrStepX[FRAG_ATTRIB_WPOS][2]);
+         else
+            span.zStep = (GLint) span.attrStepX[FRAG_ATTRIB_WPOS][2];
+      }
+#endif
+#ifdef INTERP_RGB
+      span.interpMask |= SPAN_RGBA;
+      if (ctx->Light.ShadeModel == GL_SMOOTH) {
+         const GLfloat dr1 = (GLfloat) (v1->color[RCOMP] - v0->color[RCOMP]);
+         const GLfloat dr2 = (GLfloat) (v2->color[RCOMP] - v0->color[RCOMP]);
+         const GLfloat dg1 = (GLfloat) (v1->color[GCOMP] - v0->color[GCOMP]);
+         const GLfloat dg2 = (GLfloat) (v2->color[GCOMP] - v0->color[GCOMP]);
+         const GLfloat db1 = (GLfloat) (v1->color[BCOMP] - v0->color[BCOMP]);
+         const GLfloat db2 = (GLfloat) (v2->color[BCOMP] - v0->color[BCOMP]);
+         r0 = (GLfloat) ChanToFixed(v0->color[RCOMP]);
+         g0 = (GLfloat) ChanToFixed(v0->color[GCOMP]);
+         b0 = (GLfloat) ChanToFixed(v0->color[BCOMP]);
+         span.attrStepX[FRAG_ATTRIB_COL0][0] = PLANE_DX(dr1, dr2);
+         span.attrStepY[FRAG_ATTRIB_COL0][0] = PLANE_DY(dr1, dr2);
+         span.attrStepX[FRAG_ATTRIB_COL0][1] = PLANE_DX(dg1, dg2);
+         span.attrStepY[FRAG_ATTRIB_COL0][1] = PLANE_DY(dg1, dg2);
+         span.attrStepX[FRAG_ATTRIB_COL0][2] = PLANE_DX(db1, db2);
+         span.attrStepY[FRAG_ATTRIB_COL0][2] = PLANE_DY(db1, db2);
+         span.redStep   = SignedFloatToFixed(span.attrStepX[FRAG_ATTRIB_COL0][0]);
+         span.greenStep = SignedFloatToFixed(span.attrStepX[FRAG_ATTRIB_COL0][1]);
+         span.blueStep  = SignedFloatToFixed(span.attrStepX[FRAG_ATTRIB_COL0][2]);
+#  ifdef INTERP_ALPHA
+         {
+            const GLfloat da1 = (GLfloat) (v1->color[ACOMP] - v0->color[ACOMP]);
+            const GLfloat da2 = (GLfloat) (v2->color[ACOMP] - v0->color[ACOMP]);
+            a0 = (GLfloat) ChanToFixed(v0->color[ACOMP]);
+            span.attrStepX[FRAG_ATTRIB_COL0][3] = PLANE_DX(da1, da2);
+            span.attrStepY[FRAG_ATTRIB_COL0][3] = PLANE_DY(da1, da2);
+            span.alphaStep = SignedFloatToFixed(span.attrStepX[FRAG_ATTRIB_COL0][3]);
+         }
+#  endif /* INTERP_ALPHA */
+      }
+      else {
+         ASSERT(ctx->Light.ShadeModel == GL_FLAT);
+         span.interpMask |= SPAN_FLAT;
+         r0 = (GLfloat) ChanToFixed(v2->color[RCOMP]);
+         g0 = (GLfloat) ChanToFixed(v2->color[GCOMP]);
+         b0 = (GLfloat) ChanToFixed(v2->color[BCOMP]);
+         span.attrStepX[FRAG_ATTRIB_COL0][0] = span.attrStepY[FRAG_ATTRIB_COL0][0] = 0.0F;
+         span.attrStepX[FRAG_ATTRIB_COL0][1] = span.attrStepY[FRAG_ATTRIB_COL0][1] = 0.0F;
+         span.attrStepX[FRAG_ATTRIB_COL0][2] = span.attrStepY[FRAG_ATTRIB_COL0][2] = 0.0F;
+         span.redStep   = 0;
+         span.greenStep = 0;
+         span.blueStep  = 0;
+#  ifdef INTERP_ALPHA
+         a0 = (GLfloat) ChanToFixed(v2->color[ACOMP]);
+         span.attrStepX[FRAG_ATTRIB_COL0][3] = span.attrStepY[FRAG_ATTRIB_COL0][3] = 0.0F;
+         span.alphaStep = 0;
+#  endif
+      }
+      drdy = span.attrStepY[FRAG_ATTRIB_COL0][0];
+      dgdy = span.attrStepY[FRAG_ATTRIB_COL0][1];
+      dbdy = span.attrStepY[FRAG_ATTRIB_COL0][2];
+#  ifdef INTERP_ALPHA
+      dady = span.attrStepY[FRAG_ATTRIB_COL0][3];
+#  endif
+#endif /* INTERP_RGB */
+#ifdef INTERP_INDEX
+      span.interpMask |= SPAN_INDEX;
+      if (ctx->Light.ShadeModel == GL_SMOOTH) {
+         const GLfloat di1 = v1->attrib[FRAG_ATTRIB_CI][0] - v0->attrib[FRAG_ATTRIB_CI][0];
+         const GLfloat di2 = v2->attrib[FRAG_ATTRIB_CI][0] - v0->attrib[FRAG_ATTRIB_CI][0];
+         i0 = v0->attrib[FRAG_ATTRIB_CI][0];
+         didx = PLANE_DX(di1, di2);
+         didy = PLANE_DY(di1, di2);
+         span.indexStep = SignedFloatToFixed(didx);
+      }
+      else {
+         span.interpMask |= SPAN_FLAT;
+         i0 = v2->attrib[FRAG_ATTRIB_CI][0];
+         didx = didy = 0.0F;
+         span.indexStep = 0;
+      }
+      (void) didx;
+#endif
+#ifdef INTERP_ATTRIBS
+      {
+         /* attrib[FRAG_ATTRIB_WPOS][3] is 1/W */
+         const GLfloat w0 = v0->attrib[FRAG_ATTRIB_WPOS][3];
+         const GLfloat w1 = v1->attrib[FRAG_ATTRIB_WPOS][3];
+         const GLfloat w2 = v2->attrib[FRAG_ATTRIB_WPOS][3];
+         const GLfloat dwdx = PLANE_DX(w1 - w0, w2 - w0);
+         const GLfloat dwdy = PLANE_DY(w1 - w0, w2 - w0);
+         span.attrStepX[FRAG_ATTRIB_WPOS][3] = dwdx;
+         span.attrStepY[FRAG_ATTRIB_WPOS][3] = dwdy;
+         ATTRIB_LOOP_BEGIN
+            GLuint c;
+            if (swrast->_InterpMode[attr] == GL_FLAT) {
+               /* a constant value times the interpolated 1/W */
+               for (c = 0; c < 4; c++) {
+                  const GLfloat a = v2->attrib[attr][c];
+                  attr0[attr][c] = a * w0;
+                  span.attrStepX[attr][c] = a * dwdx;
+                  span.attrStepY[attr][c] = a * dwdy;
+               }
+            }
+            else {
+               for (c = 0; c < 4; c++) {
+                  const GLfloat a = v0->attrib[attr][c] * w0;
+                  const GLfloat da1 = v1->attrib[attr][c] * w1 - a;
+                  const GLfloat da2 = v2->attrib[attr][c] * w2 - a;
+                  attr0[attr][c] = a;
+                  span.attrStepX[attr][c] = PLANE_DX(da1, da2);
+                  span.attrStepY[attr][c] = PLANE_DY(da1, da2);
+               }
+            }
+         ATTRIB_LOOP_END
+      }
+#endif
+#undef PLANE_DX
+#undef PLANE_DY
+
+      /* Visit the bounding box one row of blocks at a time.  Blocks are
+       * aligned to the screen so neighbouring triangles share them.
+       */
+      bx0 = xmin & ~(TRI_BLOCK_SIZE - 1);
+
+      for (by = ymin & ~(TRI_BLOCK_SIZE - 1); by <= ymax; by += TRI_BLOCK_SIZE) {
+         const GLint rowMin = MAX2(by, ymin);
+         const GLint rowMax = MIN2(by + TRI_BLOCK_SIZE - 1, ymax);
+         GLint left[TRI_BLOCK_SIZE], right[TRI_BLOCK_SIZE];
+         int64_t e[3];
+         GLint bx, row;
+         GLuint i;
+
+         for (row = 0; row < TRI_BLOCK_SIZE; row++) {
+            left[row] = xmax + 1;
+            right[row] = xmin;
+         }
+
+         /* edge functions at the first pixel of the first block */
+         for (i = 0; i < 3; i++) {
+            e[i] = edgeA[i] * (bx0 + 1) + edgeB[i] * by + edgeC[i];
+         }
+
+         for (bx = bx0; bx <= xmax; bx += TRI_BLOCK_SIZE) {
+            const GLint colMin = MAX2(bx, xmin);
+            const GLint colMax = MIN2(bx + TRI_BLOCK_SIZE - 1, xmax);
+
+            if (e[0] + rejectOfs[0] < 0 ||
+                e[1] + rejectOfs[1] < 0 ||
+                e[2] + rejectOfs[2] < 0) {
+               /* trivially rejected */
+            }
+            else if (e[0] + acceptOfs[0] >= 0 &&
+                     e[1] + acceptOfs[1] >= 0 &&
+                     e[2] + acceptOfs[2] >= 0) {
+               /* trivially accepted */
+               for (row = rowMin - by; row <= rowMax - by; row++) {
+                  if (colMin < left[row])
+                     left[row] = colMin;
+                  if (colMax + 1 > right[row])
+                     right[row] = colMax + 1;
+               }
+            }
+            else {
+               /* Test the rows of the block against the edges which cross
+                * it.  The covered pixels of a row are contiguous, so
+                * nothing lies beyond the end of a run found in an earlier
+                * block.
+                */
+               GLuint crossing = 0, edge = 0;
+               for (i = 0; i < 3; i++) {
+                  if (e[i] + acceptOfs[i] < 0) {
+                     crossing++;
+                     edge = i;
+                  }
+               }
+
+               for (row = rowMin - by; row <= rowMax - by; row++) {
+                  GLint x = colMin, end = colMax + 1;
+
+                  if (right[row] > left[row] && right[row] < colMin)
+                     continue;
+
+                  if (crossing == 1) {
+                     /* the common case: step along a single edge */
+                     const int64_t a = edgeA[edge];
+                     int64_t e0 = e[edge] + edgeB[edge] * row + a * (colMin - bx);
+                     if (a > 0) {
+                        while (e0 < 0 && x < end) {
+                           e0 += a;
+                           x++;
+                        }
+                     }
+                     else {
+                        x = colMin;
+                        while (e0 >= 0 && x < end) {
+                           e0 += a;
+                           x++;
+                        }
+                        end = x;
+                        x = colMin;
+                     }
+                  }
+                  else {
+                     int64_t e0 = e[0] + edgeB[0] * row + edgeA[0] * (colMin - bx);
+                     int64_t e1 = e[1] + edgeB[1] * row + edgeA[1] * (colMin - bx);
+                     int64_t e2 = e[2] + edgeB[2] * row + edgeA[2] * (colMin - bx);
+                     while ((e0 | e1 | e2) < 0 && x < end) {
+                        e0 += edgeA[0];
+                        e1 += edgeA[1];
+                        e2 += edgeA[2];
+                        x++;
+                     }
+                     end = x;
+                     while ((e0 | e1 | e2) >= 0 && end <= colMax) {
+                        e0 += edgeA[0];
+                        e1 += edgeA[1];
+                        e2 += edgeA[2];
+                        end++;
+                     }
+                  }
+
+                  if (x < end) {
+                     if (x < left[row])
+                        left[row] = x;
+                     right[row] = end;
+                  }
+               }
+            }
+
+            for (i = 0; i < 3; i++) {
+               e[i] += edgeA[i] * TRI_BLOCK_SIZE;
+            }
+         }
+
+         /* Emit one span per covered scanline of the block row.  The
+          * interpolants are evaluated at the first pixel the triangle
+          * covers on the scanline, ignoring the draw buffer and tile
+          * bounds, and then stepped to the span's first pixel with the
+          * span's own increments.  So every pixel gets the same values no
+          * matter where the tiles split the scanline.
+          */
+         for (row = rowMin - by; row <= rowMax - by; row++) {
+            if (right[row] > left[row]) {
+               GLint runMin = bboxXmin, runMax = bboxXmax, skip;
+               GLfloat dx, dy;
+               GLint len;
+
+               /* exact extent of the scanline's coverage */
+               for (i = 0; i < 3; i++) {
+                  const int64_t k = edgeB[i] * (by + row) + edgeC[i];
+                  if (edgeA[i] > 0) {
+                     /* x + 1 >= ceil(-k / a) */
+                     const int64_t a = edgeA[i];
+                     const int64_t x1 = k <= 0 ? (-k + a - 1) / a : -(k / a);
+                     if (x1 - 1 > runMin)
+                        runMin = (GLint) (x1 - 1);
+                  }
+                  else if (edgeA[i] < 0) {
+                     /* x + 1 <= floor(k / -a) */
+                     const int64_t a = -edgeA[i];
+                     const int64_t x1 = k >= 0 ? k / a : -((-k + a - 1) / a);
+                     if (x1 - 1 < runMax)
+                        runMax = (GLint) (x1 - 1);
+                  }
+               }
+               ASSERT(runMin <= left[row]);
+               ASSERT(runMax >= right[row] - 1);
+
+               /* offset of the run's first sample from v0, in pixels */
+               dx = (GLfloat) (((runMin + 1) << SUB_PIXEL_BITS) - sx[0])
+                  * (1.0F / (1 << SUB_PIXEL_BITS));
+               dy = (GLfloat) (((by + row) << SUB_PIXEL_BITS) - sy[0])
+                  * (1.0F / (1 << SUB_PIXEL_BITS));
+               len = runMax - runMin;
+               skip = left[row] - runMin;
+               (void) len;
+               (void) dx;
+               (void) dy;
+               (void) skip;
+
+               span.x = left[row];
+               span.y = by + row;
+               span.end = right[row] - left[row];
+
+#ifdef INTERP_Z
+               {
+                  const GLfloat z = z0 + span.attrStepX[FRAG_ATTRIB_WPOS][2] * dx
+                                       + span.attrStepY[FRAG_ATTRIB_WPOS][2] * dy;
+                  if (depthBits <= 16) {
+                     /* interpolate fixed-pt values */
+                     const GLfloat tmp = z * FIXED_SCALE + FIXED_HALF;
+                     if (tmp < MAX_GLUINT / 2)
+                        span.z = (GLfixed) tmp;
+                     else
+                        span.z = MAX_GLUINT / 2;
+                  }
+                  else {
+                     /* interpolate depth values w/out scaling */
+                     span.z = (GLuint) z;
+                  }
+                  span.z += skip * span.zStep;
+               }
+#endif
+#ifdef INTERP_RGB
+               span.red = (GLint) (r0 + (span.attrStepX[FRAG_ATTRIB_COL0][0] * dx
+                                         + drdy * dy) * FIXED_SCALE) + FIXED_HALF;
+               span.green = (GLint) (g0 + (span.attrStepX[FRAG_ATTRIB_COL0][1] * dx
+                                           + dgdy * dy) * FIXED_SCALE) + FIXED_HALF;
+               span.blue = (GLint) (b0 + (span.attrStepX[FRAG_ATTRIB_COL0][2] * dx
+                                          + dbdy * dy) * FIXED_SCALE) + FIXED_HALF;
+               CLAMP_INTERPOLANT(red, redStep, len);
+               CLAMP_INTERPOLANT(green, greenStep, len);
+               CLAMP_INTERPOLANT(blue, blueStep, len);
+               span.red += skip * span.redStep;
+               span.green += skip * span.greenStep;
+               span.blue += skip * span.blueStep;
+#endif
+#ifdef INTERP_ALPHA
+               span.alpha = (GLint) (a0 + (span.attrStepX[FRAG_ATTRIB_COL0][3] * dx
+                                           + dady * dy) * FIXED_SCALE) + FIXED_HALF;
+               CLAMP_INTERPOLANT(alpha, alphaStep, len);
+               span.alpha += skip * span.alphaStep;
+#endif
+#ifdef INTERP_INDEX
+               span.index = (GLfixed) ((i0 + didx * dx + didy * dy) * FIXED_SCALE)
+                  + FIXED_HALF;
+               CLAMP_INTERPOLANT(index, indexStep, len);
+               span.index += skip * span.indexStep;
+#endif
+#ifdef INTERP_ATTRIBS
+               span.attrStart[FRAG_ATTRIB_WPOS][3] = v0->attrib[FRAG_ATTRIB_WPOS][3]
+                  + span.attrStepX[FRAG_ATTRIB_WPOS][3] * dx
+                  + span.attrStepY[FRAG_ATTRIB_WPOS][3] * dy
+                  + span.attrStepX[FRAG_ATTRIB_WPOS][3] * skip;
+               ATTRIB_LOOP_BEGIN
+                  GLuint c;
+                  for (c = 0; c < 4; c++) {
+                     span.attrStart[attr][c] = attr0[attr][c]
+                        + span.attrStepX[attr][c] * dx
+                        + span.attrStepY[attr][c] * dy
+                        + span.attrStepX[attr][c] * skip;
+                  }
+               ATTRIB_LOOP_END
+#endif
+
+               {
+                  RENDER_SPAN( span );
+               }
+            }
+         }
+      }
+   }
+}
+
+#undef SETUP_CODE
+#undef RENDER_SPAN
+
+#undef PIXEL_TYPE
+#undef BYTES_PER_ROW
+#undef PIXEL_ADDRESS
+#undef DEPTH_TYPE
+
+#undef INTERP_Z
+#undef INTERP_RGB
+#undef INTERP_ALPHA
+#undef INTERP_INDEX
+#undef INTERP_INT_TEX
+#undef INTERP_ATTRIBS
+
+#undef S_SCALE
+#undef T_SCALE
+
+#undef FixedToDepth
+
+#undef NAME
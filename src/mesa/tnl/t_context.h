@@ -187,6 +187,8 @@ static INLINE GLuint _tnl_translate_prim( const struct _mesa_prim *prim )
 
 
 
+struct tnl_chunk;
+
 /**
  * Contains the current state of a running pipeline.
  */
@@ -224,6 +226,13 @@ struct vertex_buffer
 
    /* Inputs to the vertex program stage */
    GLvector4f *AttribPtr[_TNL_ATTRIB_MAX];      /* GL_NV_vertex_program */
+
+   /* Set when this is one chunk of the main vertex buffer, being run
+    * through the pipeline by one of several threads (see t_threads.c).
+    * Vertex Start of the main buffer is vertex zero of the chunk.
+    */
+   struct tnl_chunk *Chunk;
+   GLuint      Start;
 };
 
 
@@ -260,6 +269,19 @@ struct tnl_pipeline_stage
     *               GL_FALSE - finished pipeline
     */
    GLboolean (*run)( GLcontext *ctx, struct tnl_pipeline_stage * );
+
+   /* Optional.  As run(), but for just the vertices of VB, which is a
+    * chunk of the vertex buffer, and possibly in another thread at the
+    * same time as other chunks.  Output vectors must be looked up with
+    * _tnl_vb_vector(), and the context must not be modified.  Leading
+    * stages with this hook are run on chunks when there are pipeline
+    * threads; validate() may clear it when the current state can't be
+    * split up.
+    *
+    * Return value: GL_FALSE if all vertices of the chunk are clipped.
+    */
+   GLboolean (*run_chunk)( GLcontext *ctx, struct tnl_pipeline_stage *,
+			   struct vertex_buffer *VB );
 };
 
 
@@ -537,6 +559,10 @@ typedef struct
    GLubyte *block[VERT_ATTRIB_MAX];
    GLuint nr_blocks;
 
+   /* Pipeline threads, see t_threads.c:
+    */
+   struct tnl_threads *threads;
+
 } TNLcontext;
 
 
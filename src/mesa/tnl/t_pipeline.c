@@ -33,6 +33,7 @@
 
 #include "t_context.h"
 #include "t_pipeline.h"
+#include "t_threads.h"
 #include "t_vp_build.h"
 #include "t_vertex.h"
 
@@ -153,7 +154,11 @@ void _tnl_run_pipeline( GLcontext *ctx )
 
    START_FAST_MATH(__tmp);
 
-   for (i = 0; i < tnl->pipeline.nr_stages ; i++) {
+   /* Run what we can on several threads, then the rest as usual.
+    */
+   i = tnl->threads ? _tnl_run_pipeline_chunks( ctx ) : 0;
+
+   for ( ; i < tnl->pipeline.nr_stages ; i++) {
       struct tnl_pipeline_stage *s = &tnl->pipeline.stages[i];
       if (!s->run( ctx, s ))
 	 break;
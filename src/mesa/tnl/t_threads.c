@@ -0,0 +1,446 @@
+/*
+ * Mesa 3-D graphics library
+ * Version:  7.7
+ *
+ * Copyright (C) 1999-2007  Brian Paul   All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * BRIAN PAUL BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * \file t_threads.c
+ * Run the per-vertex pipeline stages on chunks of the vertex buffer in
+ * worker threads.
+ *
+ * The leading stages of the pipeline which provide a run_chunk() hook
+ * are run on up to TNL_MAX_THREADS contiguous ranges of the vertex
+ * buffer at once.  Each chunk has its own copy of the vertex_buffer,
+ * whose vectors are views of the chunk's vertices in the real vectors,
+ * so the stages write their results straight into the stage storage
+ * used by the serial pipeline.  Afterwards the main vertex buffer is
+ * pointed back at the real vectors and the remaining stages (in the
+ * default pipeline, just rendering) run as usual.
+ *
+ * Threads are only used when the MESA_TNL_THREADS environment variable
+ * asks for more than one; the calling thread always does the first chunk.
+ */
+
+
+#include "main/glheader.h"
+#include "main/imports.h"
+#include "main/macros.h"
+#include "main/mtypes.h"
+#include "glapi/glthread.h"
+
+#include "t_context.h"
+#include "t_pipeline.h"
+#include "t_threads.h"
+
+
+#define TNL_MAX_THREADS        8
+#define TNL_CHUNK_MIN_VERTS    256
+#define TNL_CHUNK_MAX_VECTORS  128
+
+
+/**
+ * A range of the vertex buffer, processed by one thread.
+ */
+struct tnl_chunk {
+   struct vertex_buffer vb;
+   GLboolean finished;		/**< a stage asked to end the pipeline */
+   GLuint nr_vectors;
+   GLvector4f *parent[TNL_CHUNK_MAX_VECTORS];
+   GLvector4f vector[TNL_CHUNK_MAX_VECTORS];
+};
+
+
+static GLboolean
+is_view( const struct tnl_chunk *chunk, const GLvector4f *vec )
+{
+   return vec >= chunk->vector && vec < chunk->vector + chunk->nr_vectors;
+}
+
+
+/**
+ * Return the chunk's view of vec, creating it on first use.
+ *
+ * Stage-owned vectors (VEC_MALLOC) always have room for a 16 byte
+ * stride, which is what they are written with even if the last run left
+ * them constant.  Anything else is a view at its current stride.
+ */
+GLvector4f *
+_tnl_chunk_vector( struct tnl_chunk *chunk, GLvector4f *vec )
+{
+   GLvector4f *view;
+   GLuint stride, i;
+
+   if (!vec || is_view(chunk, vec))
+      return vec;
+
+   for (i = 0; i < chunk->nr_vectors; i++)
+      if (chunk->parent[i] == vec)
+	 return &chunk->vector[i];
+
+   ASSERT(chunk->nr_vectors < TNL_CHUNK_MAX_VECTORS);
+
+   stride = vec->stride;
+   if (!stride && (vec->flags & VEC_MALLOC))
+      stride = 4 * sizeof(GLfloat);
+
+   view = &chunk->vector[chunk->nr_vectors];
+   chunk->parent[chunk->nr_vectors++] = vec;
+
+   *view = *vec;
+   view->start = (GLfloat *) ((GLubyte *) vec->start +
+			      chunk->vb.Start * stride);
+   view->data = (GLfloat (*)[4]) view->start;
+   view->count = chunk->vb.Count;
+   view->storage = NULL;
+   view->flags &= ~VEC_MALLOC;
+   return view;
+}
+
+
+#ifdef PTHREADS
+
+static GLvector4f *
+parent_vector( const struct tnl_chunk *chunk, GLvector4f *vec )
+{
+   return is_view(chunk, vec) ? chunk->parent[vec - chunk->vector] : vec;
+}
+
+
+/**
+ * Apply 'map' to every vector pointer of a vertex buffer.
+ */
+#define MAP_VECTORS(VB, map)					\
+do {								\
+   GLuint _i;							\
+   (VB)->ObjPtr = map((VB)->ObjPtr);				\
+   (VB)->EyePtr = map((VB)->EyePtr);				\
+   (VB)->ClipPtr = map((VB)->ClipPtr);				\
+   (VB)->NdcPtr = map((VB)->NdcPtr);				\
+   (VB)->NormalPtr = map((VB)->NormalPtr);			\
+   (VB)->FogCoordPtr = map((VB)->FogCoordPtr);			\
+   for (_i = 0; _i < MAX_TEXTURE_COORD_UNITS; _i++)		\
+      (VB)->TexCoordPtr[_i] = map((VB)->TexCoordPtr[_i]);	\
+   for (_i = 0; _i < 2; _i++) {					\
+      (VB)->IndexPtr[_i] = map((VB)->IndexPtr[_i]);		\
+      (VB)->ColorPtr[_i] = map((VB)->ColorPtr[_i]);		\
+      (VB)->SecondaryColorPtr[_i] = map((VB)->SecondaryColorPtr[_i]);	\
+   }								\
+   for (_i = 0; _i < _TNL_ATTRIB_MAX; _i++)			\
+      (VB)->AttribPtr[_i] = map((VB)->AttribPtr[_i]);		\
+} while (0)
+
+
+struct tnl_worker {
+   struct tnl_threads *threads;
+   GLuint id;
+   pthread_t thread;
+};
+
+struct tnl_threads {
+   GLcontext *ctx;
+   GLuint nr_threads;		/**< including the calling thread */
+
+   /* The current job:
+    */
+   GLuint nr_chunks;
+   GLuint nr_stages;
+   struct tnl_chunk chunk[TNL_MAX_THREADS];
+
+   struct tnl_worker worker[TNL_MAX_THREADS];
+   _glthread_Mutex mutex;
+   _glthread_Cond work;		/**< signalled when a job is posted */
+   _glthread_Cond done;		/**< signalled when the last chunk finishes */
+   GLuint generation;
+   GLuint pending;
+   GLboolean quit;
+};
+
+
+/**
+ * Run the chunked stages on one chunk.  Unlike the serial pipeline all
+ * of them run even if one returns GL_FALSE, as the other chunks may
+ * still need their results.
+ */
+static void
+run_chunk( struct tnl_threads *threads, struct tnl_chunk *chunk )
+{
+   TNLcontext *tnl = TNL_CONTEXT(threads->ctx);
+   GLuint i;
+
+   chunk->finished = GL_FALSE;
+
+   for (i = 0; i < threads->nr_stages; i++) {
+      struct tnl_pipeline_stage *s = &tnl->pipeline.stages[i];
+      if (!s->run_chunk( threads->ctx, s, &chunk->vb ))
+	 chunk->finished = GL_TRUE;
+   }
+}
+
+
+static void *
+worker_main( void *data )
+{
+   struct tnl_worker *worker = (struct tnl_worker *) data;
+   struct tnl_threads *threads = worker->threads;
+   GLuint generation = 0;
+
+   for (;;) {
+      unsigned short __tmp;
+      GLboolean active;
+
+      _glthread_LOCK_MUTEX(threads->mutex);
+      while (!threads->quit && threads->generation == generation)
+	 _glthread_COND_WAIT(threads->work, threads->mutex);
+      generation = threads->generation;
+      active = worker->id < threads->nr_chunks;
+      if (threads->quit) {
+	 _glthread_UNLOCK_MUTEX(threads->mutex);
+	 break;
+      }
+      _glthread_UNLOCK_MUTEX(threads->mutex);
+
+      if (!active)
+	 continue;
+
+      START_FAST_MATH(__tmp);
+      run_chunk( threads, &threads->chunk[worker->id] );
+      END_FAST_MATH(__tmp);
+
+      _glthread_LOCK_MUTEX(threads->mutex);
+      if (--threads->pending == 0)
+	 _glthread_COND_SIGNAL(threads->done);
+      _glthread_UNLOCK_MUTEX(threads->mutex);
+   }
+
+   return NULL;
+}
+
+
+
+
+void
+_tnl_create_threads( GLcontext *ctx )
+{
+   TNLcontext *tnl = TNL_CONTEXT(ctx);
+   struct tnl_threads *threads;
+   const char *env = _mesa_getenv("MESA_TNL_THREADS");
+   GLint nr_threads = env ? _mesa_atoi(env) : 0;
+   GLint i;
+
+   if (nr_threads <= 1)
+      return;
+
+   threads = CALLOC_STRUCT(tnl_threads);
+   if (!threads)
+      return;
+
+   threads->ctx = ctx;
+   _glthread_INIT_MUTEX(threads->mutex);
+   _glthread_INIT_COND(threads->work);
+   _glthread_INIT_COND(threads->done);
+
+   nr_threads = MIN2(nr_threads, TNL_MAX_THREADS);
+   for (i = 1; i < nr_threads; i++) {
+      struct tnl_worker *worker = &threads->worker[i];
+      worker->threads = threads;
+      worker->id = i;
+      if (pthread_create(&worker->thread, NULL, worker_main, worker) != 0)
+	 break;
+   }
+
+   /* Make do with the threads we got.
+    */
+   threads->nr_threads = i;
+   tnl->threads = threads;
+
+   if (threads->nr_threads < 2)
+      _tnl_destroy_threads( ctx );
+}
+
+
+void
+_tnl_destroy_threads( GLcontext *ctx )
+{
+   TNLcontext *tnl = TNL_CONTEXT(ctx);
+   struct tnl_threads *threads = tnl->threads;
+   GLuint i;
+
+   if (!threads)
+      return;
+
+   _glthread_LOCK_MUTEX(threads->mutex);
+   threads->quit = GL_TRUE;
+   _glthread_COND_BROADCAST(threads->work);
+   _glthread_UNLOCK_MUTEX(threads->mutex);
+
+   for (i = 1; i < threads->nr_threads; i++)
+      pthread_join(threads->worker[i].thread, NULL);
+
+   _glthread_DESTROY_COND(threads->work);
+   _glthread_DESTROY_COND(threads->done);
+   _glthread_DESTROY_MUTEX(threads->mutex);
+
+   FREE(threads);
+   tnl->threads = NULL;
+}
+
+
+/**
+ * Run the leading stages which support it on chunks of the vertex
+ * buffer, one per thread.  Called from _tnl_run_pipeline() inside its
+ * FAST_MATH block.
+ *
+ * \return number of pipeline stages done, zero if the vertex buffer was
+ * left for the serial pipeline.
+ */
+GLuint
+_tnl_run_pipeline_chunks( GLcontext *ctx )
+{
+   TNLcontext *tnl = TNL_CONTEXT(ctx);
+   struct tnl_threads *threads = tnl->threads;
+   struct vertex_buffer *VB = &tnl->vb;
+   struct tnl_chunk *chunk;
+   const GLuint count = VB->Count;
+   GLuint nr_stages, nr_chunks, start, i;
+   GLubyte ormask = 0, andmask = ~0;
+   GLboolean finished = GL_TRUE;
+
+   for (nr_stages = 0; nr_stages < tnl->pipeline.nr_stages; nr_stages++)
+      if (!tnl->pipeline.stages[nr_stages].run_chunk)
+	 break;
+
+   nr_chunks = MIN2(threads->nr_threads, count / TNL_CHUNK_MIN_VERTS);
+
+   if (nr_stages == 0 || nr_chunks < 2)
+      return 0;
+
+   for (i = 0, start = 0; i < nr_chunks; i++) {
+      struct vertex_buffer *cvb;
+
+      chunk = &threads->chunk[i];
+      cvb = &chunk->vb;
+
+      *cvb = *VB;
+      cvb->Chunk = chunk;
+      cvb->Start = start;
+      cvb->Count = count * (i + 1) / nr_chunks - start;
+
+      if (cvb->ClipMask)
+	 cvb->ClipMask += start;
+      if (cvb->NormalLengthPtr)
+	 cvb->NormalLengthPtr += start;
+      if (cvb->EdgeFlag)
+	 cvb->EdgeFlag += start;
+
+      chunk->nr_vectors = 0;
+#define CHUNK_VECTOR(v) _tnl_chunk_vector(chunk, v)
+      MAP_VECTORS(cvb, CHUNK_VECTOR);
+#undef CHUNK_VECTOR
+
+      start += cvb->Count;
+   }
+
+   _glthread_LOCK_MUTEX(threads->mutex);
+   threads->nr_chunks = nr_chunks;
+   threads->nr_stages = nr_stages;
+   threads->pending = nr_chunks - 1;
+   threads->generation++;
+   _glthread_COND_BROADCAST(threads->work);
+   _glthread_UNLOCK_MUTEX(threads->mutex);
+
+   run_chunk( threads, &threads->chunk[0] );
+
+   _glthread_LOCK_MUTEX(threads->mutex);
+   while (threads->pending)
+      _glthread_COND_WAIT(threads->done, threads->mutex);
+   _glthread_UNLOCK_MUTEX(threads->mutex);
+
+   for (i = 0; i < nr_chunks; i++) {
+      chunk = &threads->chunk[i];
+      ormask |= chunk->vb.ClipOrMask;
+      andmask &= chunk->vb.ClipAndMask;
+      finished &= chunk->finished;
+   }
+
+   /* The first chunk starts at vertex zero, so apart from the vectors
+    * and the count its vertex buffer is the one we want.  The real
+    * vectors take on the size, stride and flags the stages gave the
+    * views.
+    */
+   chunk = &threads->chunk[0];
+
+   *VB = chunk->vb;
+   VB->Chunk = NULL;
+   VB->Start = 0;
+   VB->Count = count;
+   VB->ClipOrMask = ormask;
+   VB->ClipAndMask = andmask;
+#define PARENT_VECTOR(v) parent_vector(chunk, v)
+   MAP_VECTORS(VB, PARENT_VECTOR);
+#undef PARENT_VECTOR
+
+   for (i = 0; i < chunk->nr_vectors; i++) {
+      const GLvector4f *view = &chunk->vector[i];
+      GLvector4f *vec = chunk->parent[i];
+
+      vec->size = view->size;
+      vec->stride = view->stride;
+      vec->flags = view->flags | (vec->flags & VEC_MALLOC);
+      vec->count = view->count == chunk->vb.Count ? count : view->count;
+   }
+
+   /* Every chunk wanted to end the pipeline; that only holds for the
+    * whole buffer if all vertices are outside a common clip plane.
+    */
+   if (finished && andmask)
+      return tnl->pipeline.nr_stages;
+
+   return nr_stages;
+}
+
+
+#else /* PTHREADS */
+
+
+void
+_tnl_create_threads( GLcontext *ctx )
+{
+   (void) ctx;
+}
+
+
+void
+_tnl_destroy_threads( GLcontext *ctx )
+{
+   (void) ctx;
+}
+
+
+GLuint
+_tnl_run_pipeline_chunks( GLcontext *ctx )
+{
+   (void) ctx;
+   return 0;
+}
+
+
+#endif /* PTHREADS */
@@ -0,0 +1,55 @@
+/*
+ * Mesa 3-D graphics library
+ * Version:  7.7
+ *
+ * Copyright (C) 1999-2007  Brian Paul   All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * BRIAN PAUL BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#ifndef _T_THREADS_H_
+#define _T_THREADS_H_
+
+#include "main/mtypes.h"
+#include "t_context.h"
+
+
+extern void _tnl_create_threads( GLcontext *ctx );
+
+extern void _tnl_destroy_threads( GLcontext *ctx );
+
+extern GLuint _tnl_run_pipeline_chunks( GLcontext *ctx );
+
+extern GLvector4f *_tnl_chunk_vector( struct tnl_chunk *chunk,
+				      GLvector4f *vec );
+
+
+/**
+ * Return the vector a pipeline stage should read or write for the
+ * vertices of VB.  For the main vertex buffer that is vec itself, for a
+ * chunk it is a view of the chunk's part of vec.
+ */
+static INLINE GLvector4f *
+_tnl_vb_vector( struct vertex_buffer *VB, GLvector4f *vec )
+{
+   return VB->Chunk ? _tnl_chunk_vector( VB->Chunk, vec ) : vec;
+}
+
+
+#endif
@@ -37,6 +37,7 @@
 
 #include "t_context.h"
 #include "t_pipeline.h"
+#include "t_threads.h"
 
 
 struct fog_stage_data {
@@ -141,24 +142,26 @@ compute_fog_blend_factors(GLcontext *ctx, GLvector4f *out, const GLvector4f *in)
 
 
 static GLboolean
-run_fog_stage(GLcontext *ctx, struct tnl_pipeline_stage *stage)
+run_fog_chunk(GLcontext *ctx, struct tnl_pipeline_stage *stage,
+              struct vertex_buffer *VB)
 {
    TNLcontext *tnl = TNL_CONTEXT(ctx);
-   struct vertex_buffer *VB = &tnl->vb;
    struct fog_stage_data *store = FOG_STAGE_DATA(stage);
-   GLvector4f *input;
+   GLvector4f *fogcoord, *input;
 
 
    if (!ctx->Fog.Enabled)
       return GL_TRUE;
 
+   fogcoord = _tnl_vb_vector(VB, &store->fogcoord);
+
    if (ctx->Fog.FogCoordinateSource == GL_FRAGMENT_DEPTH_EXT && !ctx->VertexProgram._Current) {
       GLuint i;
       GLfloat *coord;
       /* Fog is computed from vertex or fragment Z values */
       /* source = VB->ObjPtr or VB->EyePtr coords */
       /* dest = VB->AttribPtr[_TNL_ATTRIB_FOG] = fog stage private storage */
-      VB->AttribPtr[_TNL_ATTRIB_FOG] = &store->fogcoord;
+      VB->AttribPtr[_TNL_ATTRIB_FOG] = fogcoord;
 
       if (!ctx->_NeedEyeCoords) {
          /* compute fog coords from object coords */
@@ -167,7 +170,7 @@ run_fog_stage(GLcontext *ctx, struct tnl_pipeline_stage *stage)
 
 	 /* Use this to store calculated eye z values:
 	  */
-	 input = &store->fogcoord;
+	 input = fogcoord;
 
 	 plane[0] = m[2];
 	 plane[1] = m[6];
@@ -192,7 +195,7 @@ run_fog_stage(GLcontext *ctx, struct tnl_pipeline_stage *stage)
       }
       else {
          /* fog coordinates = eye Z coordinates - need to copy for ABS */
-	 input = &store->fogcoord;
+	 input = fogcoord;
 
 	 if (VB->EyePtr->size < 2)
 	    _mesa_vector4f_clean_elem( VB->EyePtr, VB->Count, 2 );
@@ -215,7 +218,7 @@ run_fog_stage(GLcontext *ctx, struct tnl_pipeline_stage *stage)
        */
       input->count = VB->ObjPtr->count;
 
-      VB->AttribPtr[_TNL_ATTRIB_FOG] = &store->fogcoord;  /* dest data */
+      VB->AttribPtr[_TNL_ATTRIB_FOG] = fogcoord;  /* dest data */
    }
 
    if (tnl->_DoVertexFog) {
@@ -232,6 +235,13 @@ run_fog_stage(GLcontext *ctx, struct tnl_pipeline_stage *stage)
 }
 
 
+static GLboolean
+run_fog_stage(GLcontext *ctx, struct tnl_pipeline_stage *stage)
+{
+   return run_fog_chunk(ctx, stage, &TNL_CONTEXT(ctx)->vb);
+}
+
+
 
 /* Called the first time stage->run() is invoked.
  */
@@ -273,5 +283,6 @@ const struct tnl_pipeline_stage _tnl_fog_coordinate_stage =
    alloc_fog_data,		/* dtr */
    free_fog_data,		/* dtr */
    NULL,		/* check */
-   run_fog_stage		/* run -- initially set to init. */
+   run_fog_stage,		/* run -- initially set to init. */
+   run_fog_chunk		/* run_chunk */
 };
@@ -36,6 +36,7 @@
 
 #include "t_context.h"
 #include "t_pipeline.h"
+#include "t_threads.h"
 
 #define LIGHT_TWOSIDE       0x1
 #define LIGHT_MATERIAL      0x2
@@ -194,12 +195,11 @@ static void init_lighting_tables( void )
 }
 
 
-static GLboolean run_lighting( GLcontext *ctx, 
-			       struct tnl_pipeline_stage *stage )
+static GLboolean run_lighting_chunk( GLcontext *ctx, 
+				     struct tnl_pipeline_stage *stage,
+				     struct vertex_buffer *VB )
 {
    struct light_stage_data *store = LIGHT_STAGE_DATA(stage);
-   TNLcontext *tnl = TNL_CONTEXT(ctx);
-   struct vertex_buffer *VB = &tnl->vb;
    GLvector4f *input = ctx->_NeedEyeCoords ? VB->EyePtr : VB->ObjPtr;
    GLuint idx;
 
@@ -209,8 +209,9 @@ static GLboolean run_lighting( GLcontext *ctx,
    /* Make sure we can talk about position x,y and z:
     */
    if (input->size <= 2 && input == VB->ObjPtr) {
+      GLvector4f *tmp = _tnl_vb_vector(VB, &store->Input);
 
-      _math_trans_4f( store->Input.data,
+      _math_trans_4f( tmp->data,
 		      VB->ObjPtr->data,
 		      VB->ObjPtr->stride,
 		      GL_FLOAT,
@@ -221,21 +222,24 @@ static GLboolean run_lighting( GLcontext *ctx,
       if (input->size <= 2) {
 	 /* Clean z.
 	  */
-	 _mesa_vector4f_clean_elem(&store->Input, VB->Count, 2);
+	 _mesa_vector4f_clean_elem(tmp, VB->Count, 2);
       }
 	 
       if (input->size <= 1) {
 	 /* Clean y.
 	  */
-	 _mesa_vector4f_clean_elem(&store->Input, VB->Count, 1);
+	 _mesa_vector4f_clean_elem(tmp, VB->Count, 1);
       }
 
-      input = &store->Input;
+      input = tmp;
    }
    
    idx = 0;
 
-   if (prepare_materials( ctx, VB, store ))
+   /* Chunks only get here without material tracking, and
+    * validate_lighting() has already updated the materials.
+    */
+   if (!VB->Chunk && prepare_materials( ctx, VB, store ))
       idx |= LIGHT_MATERIAL;
 
    if (ctx->Light.Model.TwoSide)
@@ -254,6 +258,32 @@ static GLboolean run_lighting( GLcontext *ctx,
 }
 
 
+static GLboolean run_lighting( GLcontext *ctx, 
+			       struct tnl_pipeline_stage *stage )
+{
+   return run_lighting_chunk( ctx, stage, &TNL_CONTEXT(ctx)->vb );
+}
+
+
+/* Material tracking updates the context for every vertex, so can't be
+ * run on chunks.
+ */
+static GLboolean need_material_tracking( GLcontext *ctx )
+{
+   struct vertex_buffer *VB = &TNL_CONTEXT(ctx)->vb;
+   GLuint i;
+
+   if (ctx->Light.ColorMaterialEnabled)
+      return GL_TRUE;
+
+   for (i = _TNL_FIRST_MAT; i <= _TNL_LAST_MAT; i++)
+      if (VB->AttribPtr[i]->stride)
+	 return GL_TRUE;
+
+   return GL_FALSE;
+}
+
+
 /* Called in place of do_lighting when the light table may have changed.
  */
 static void validate_lighting( GLcontext *ctx,
@@ -261,9 +291,21 @@ static void validate_lighting( GLcontext *ctx,
 {
    light_func *tab;
 
+   stage->run_chunk = run_lighting_chunk;
+
    if (!ctx->Light.Enabled || ctx->VertexProgram._Current)
       return;
 
+   if (need_material_tracking( ctx )) {
+      stage->run_chunk = NULL;
+   }
+   else if (TNL_CONTEXT(ctx)->threads) {
+      /* What prepare_materials() does for the serial pipeline.
+       */
+      _mesa_update_material( ctx, ~0 );
+      _mesa_validate_all_lighting_tables( ctx );
+   }
+
    if (ctx->Visual.rgbMode) {
       if (ctx->Light._NeedVertices) {
 	 if (ctx->Light.Model.ColorControl == GL_SEPARATE_SPECULAR_COLOR)
@@ -358,5 +400,6 @@ const struct tnl_pipeline_stage _tnl_lighting_stage =
    init_lighting,
    dtr,				/* destroy */
    validate_lighting,
-   run_lighting
+   run_lighting,
+   run_lighting_chunk
 };
@@ -59,11 +59,11 @@ static void TAG(light_rgba_spec)( GLcontext *ctx,
    const GLuint nstride = VB->AttribPtr[_TNL_ATTRIB_NORMAL]->stride;
    const GLfloat *normal = (GLfloat *)VB->AttribPtr[_TNL_ATTRIB_NORMAL]->data;
 
-   GLfloat (*Fcolor)[4] = (GLfloat (*)[4]) store->LitColor[0].data;
-   GLfloat (*Fspec)[4] = (GLfloat (*)[4]) store->LitSecondary[0].data;
+   GLfloat (*Fcolor)[4] = (GLfloat (*)[4]) _tnl_vb_vector(VB, &store->LitColor[0])->data;
+   GLfloat (*Fspec)[4] = (GLfloat (*)[4]) _tnl_vb_vector(VB, &store->LitSecondary[0])->data;
 #if IDX & LIGHT_TWOSIDE
-   GLfloat (*Bcolor)[4] = (GLfloat (*)[4]) store->LitColor[1].data;
-   GLfloat (*Bspec)[4] = (GLfloat (*)[4]) store->LitSecondary[1].data;
+   GLfloat (*Bcolor)[4] = (GLfloat (*)[4]) _tnl_vb_vector(VB, &store->LitColor[1])->data;
+   GLfloat (*Bspec)[4] = (GLfloat (*)[4]) _tnl_vb_vector(VB, &store->LitSecondary[1])->data;
 #endif
 
    const GLuint nr = VB->Count;
@@ -72,19 +72,19 @@ static void TAG(light_rgba_spec)( GLcontext *ctx,
    fprintf(stderr, "%s\n", __FUNCTION__ );
 #endif
 
-   VB->ColorPtr[0] = &store->LitColor[0];
-   VB->SecondaryColorPtr[0] = &store->LitSecondary[0];
+   VB->ColorPtr[0] = _tnl_vb_vector(VB, &store->LitColor[0]);
+   VB->SecondaryColorPtr[0] = _tnl_vb_vector(VB, &store->LitSecondary[0]);
    sumA[0] = ctx->Light.Material.Attrib[MAT_ATTRIB_FRONT_DIFFUSE][3];
 
 #if IDX & LIGHT_TWOSIDE
-   VB->ColorPtr[1] = &store->LitColor[1];
-   VB->SecondaryColorPtr[1] = &store->LitSecondary[1];
+   VB->ColorPtr[1] = _tnl_vb_vector(VB, &store->LitColor[1]);
+   VB->SecondaryColorPtr[1] = _tnl_vb_vector(VB, &store->LitSecondary[1]);
    sumA[1] = ctx->Light.Material.Attrib[MAT_ATTRIB_BACK_DIFFUSE][3];
 #endif
 
 
-   store->LitColor[0].stride = 16;
-   store->LitColor[1].stride = 16;
+   _tnl_vb_vector(VB, &store->LitColor[0])->stride = 16;
+   _tnl_vb_vector(VB, &store->LitColor[1])->stride = 16;
 
    for (j = 0; j < nr; j++,STRIDE_F(vertex,vstride),STRIDE_F(normal,nstride)) {
       GLfloat sum[2][3], spec[2][3];
@@ -248,9 +248,9 @@ static void TAG(light_rgba)( GLcontext *ctx,
    const GLuint nstride = VB->AttribPtr[_TNL_ATTRIB_NORMAL]->stride;
    const GLfloat *normal = (GLfloat *)VB->AttribPtr[_TNL_ATTRIB_NORMAL]->data;
 
-   GLfloat (*Fcolor)[4] = (GLfloat (*)[4]) store->LitColor[0].data;
+   GLfloat (*Fcolor)[4] = (GLfloat (*)[4]) _tnl_vb_vector(VB, &store->LitColor[0])->data;
 #if IDX & LIGHT_TWOSIDE
-   GLfloat (*Bcolor)[4] = (GLfloat (*)[4]) store->LitColor[1].data;
+   GLfloat (*Bcolor)[4] = (GLfloat (*)[4]) _tnl_vb_vector(VB, &store->LitColor[1])->data;
 #endif
 
    const GLuint nr = VB->Count;
@@ -259,16 +259,16 @@ static void TAG(light_rgba)( GLcontext *ctx,
    fprintf(stderr, "%s\n", __FUNCTION__ );
 #endif
 
-   VB->ColorPtr[0] = &store->LitColor[0];
+   VB->ColorPtr[0] = _tnl_vb_vector(VB, &store->LitColor[0]);
    sumA[0] = ctx->Light.Material.Attrib[MAT_ATTRIB_FRONT_DIFFUSE][3];
 
 #if IDX & LIGHT_TWOSIDE
-   VB->ColorPtr[1] = &store->LitColor[1];
+   VB->ColorPtr[1] = _tnl_vb_vector(VB, &store->LitColor[1]);
    sumA[1] = ctx->Light.Material.Attrib[MAT_ATTRIB_BACK_DIFFUSE][3];
 #endif
 
-   store->LitColor[0].stride = 16;
-   store->LitColor[1].stride = 16;
+   _tnl_vb_vector(VB, &store->LitColor[0])->stride = 16;
+   _tnl_vb_vector(VB, &store->LitColor[1])->stride = 16;
 
    for (j = 0; j < nr; j++,STRIDE_F(vertex,vstride),STRIDE_F(normal,nstride)) {
       GLfloat sum[2][3];
@@ -430,9 +430,9 @@ static void TAG(light_fast_rgba_single)( GLcontext *ctx,
    struct light_stage_data *store = LIGHT_STAGE_DATA(stage);
    const GLuint nstride = VB->AttribPtr[_TNL_ATTRIB_NORMAL]->stride;
    const GLfloat *normal = (GLfloat *)VB->AttribPtr[_TNL_ATTRIB_NORMAL]->data;
-   GLfloat (*Fcolor)[4] = (GLfloat (*)[4]) store->LitColor[0].data;
+   GLfloat (*Fcolor)[4] = (GLfloat (*)[4]) _tnl_vb_vector(VB, &store->LitColor[0])->data;
 #if IDX & LIGHT_TWOSIDE
-   GLfloat (*Bcolor)[4] = (GLfloat (*)[4]) store->LitColor[1].data;
+   GLfloat (*Bcolor)[4] = (GLfloat (*)[4]) _tnl_vb_vector(VB, &store->LitColor[1])->data;
 #endif
    const struct gl_light *light = ctx->Light.EnabledList.next;
    GLuint j = 0;
@@ -449,18 +449,18 @@ static void TAG(light_fast_rgba_single)( GLcontext *ctx,
 
    (void) input;		/* doesn't refer to Eye or Obj */
 
-   VB->ColorPtr[0] = &store->LitColor[0];
+   VB->ColorPtr[0] = _tnl_vb_vector(VB, &store->LitColor[0]);
 #if IDX & LIGHT_TWOSIDE
-   VB->ColorPtr[1] = &store->LitColor[1];
+   VB->ColorPtr[1] = _tnl_vb_vector(VB, &store->LitColor[1]);
 #endif
 
    if (nr > 1) {
-      store->LitColor[0].stride = 16;
-      store->LitColor[1].stride = 16;
+      _tnl_vb_vector(VB, &store->LitColor[0])->stride = 16;
+      _tnl_vb_vector(VB, &store->LitColor[1])->stride = 16;
    }
    else {
-      store->LitColor[0].stride = 0;
-      store->LitColor[1].stride = 0;
+      _tnl_vb_vector(VB, &store->LitColor[0])->stride = 0;
+      _tnl_vb_vector(VB, &store->LitColor[1])->stride = 0;
    }
 
    for (j = 0; j < nr; j++, STRIDE_F(normal,nstride)) {
@@ -538,9 +538,9 @@ static void TAG(light_fast_rgba)( GLcontext *ctx,
    GLfloat sumA[2];
    const GLuint nstride = VB->AttribPtr[_TNL_ATTRIB_NORMAL]->stride;
    const GLfloat *normal = (GLfloat *)VB->AttribPtr[_TNL_ATTRIB_NORMAL]->data;
-   GLfloat (*Fcolor)[4] = (GLfloat (*)[4]) store->LitColor[0].data;
+   GLfloat (*Fcolor)[4] = (GLfloat (*)[4]) _tnl_vb_vector(VB, &store->LitColor[0])->data;
 #if IDX & LIGHT_TWOSIDE
-   GLfloat (*Bcolor)[4] = (GLfloat (*)[4]) store->LitColor[1].data;
+   GLfloat (*Bcolor)[4] = (GLfloat (*)[4]) _tnl_vb_vector(VB, &store->LitColor[1])->data;
 #endif
    GLuint j = 0;
 #if IDX & LIGHT_MATERIAL
@@ -559,18 +559,18 @@ static void TAG(light_fast_rgba)( GLcontext *ctx,
    sumA[0] = ctx->Light.Material.Attrib[MAT_ATTRIB_FRONT_DIFFUSE][3];
    sumA[1] = ctx->Light.Material.Attrib[MAT_ATTRIB_BACK_DIFFUSE][3];
 
-   VB->ColorPtr[0] = &store->LitColor[0];
+   VB->ColorPtr[0] = _tnl_vb_vector(VB, &store->LitColor[0]);
 #if IDX & LIGHT_TWOSIDE
-   VB->ColorPtr[1] = &store->LitColor[1];
+   VB->ColorPtr[1] = _tnl_vb_vector(VB, &store->LitColor[1]);
 #endif
 
    if (nr > 1) {
-      store->LitColor[0].stride = 16;
-      store->LitColor[1].stride = 16;
+      _tnl_vb_vector(VB, &store->LitColor[0])->stride = 16;
+      _tnl_vb_vector(VB, &store->LitColor[1])->stride = 16;
    }
    else {
-      store->LitColor[0].stride = 0;
-      store->LitColor[1].stride = 0;
+      _tnl_vb_vector(VB, &store->LitColor[0])->stride = 0;
+      _tnl_vb_vector(VB, &store->LitColor[1])->stride = 0;
    }
 
    for (j = 0; j < nr; j++, STRIDE_F(normal,nstride)) {
@@ -665,9 +665,9 @@ static void TAG(light_ci)( GLcontext *ctx,
    fprintf(stderr, "%s\n", __FUNCTION__ );
 #endif
 
-   VB->IndexPtr[0] = &store->LitIndex[0];
+   VB->IndexPtr[0] = _tnl_vb_vector(VB, &store->LitIndex[0]);
 #if IDX & LIGHT_TWOSIDE
-   VB->IndexPtr[1] = &store->LitIndex[1];
+   VB->IndexPtr[1] = _tnl_vb_vector(VB, &store->LitIndex[1]);
 #endif
 
    indexResult[0] = (GLfloat *)VB->IndexPtr[0]->data;
@@ -37,6 +37,7 @@
 
 #include "t_context.h"
 #include "t_pipeline.h"
+#include "t_threads.h"
 
 
 struct normal_stage_data {
@@ -48,10 +49,11 @@ struct normal_stage_data {
 
 
 static GLboolean
-run_normal_stage(GLcontext *ctx, struct tnl_pipeline_stage *stage)
+run_normal_chunk(GLcontext *ctx, struct tnl_pipeline_stage *stage,
+                 struct vertex_buffer *VB)
 {
    struct normal_stage_data *store = NORMAL_STAGE_DATA(stage);
-   struct vertex_buffer *VB = &TNL_CONTEXT(ctx)->vb;
+   GLvector4f *normal = _tnl_vb_vector(VB, &store->normal);
    const GLfloat *lengths;
 
    if (!store->NormalTransform)
@@ -69,23 +71,30 @@ run_normal_stage(GLcontext *ctx, struct tnl_pipeline_stage *stage)
 			   ctx->_ModelViewInvScale,
 			   VB->AttribPtr[_TNL_ATTRIB_NORMAL],  /* input normals */
 			   lengths,
-			   &store->normal ); /* resulting normals */
+			   normal ); /* resulting normals */
 
    if (VB->AttribPtr[_TNL_ATTRIB_NORMAL]->count > 1) {
-      store->normal.stride = 4 * sizeof(GLfloat);
+      normal->stride = 4 * sizeof(GLfloat);
    }
    else {
-      store->normal.stride = 0;
+      normal->stride = 0;
    }
 
-   VB->AttribPtr[_TNL_ATTRIB_NORMAL] = &store->normal;
-   VB->NormalPtr = &store->normal;
+   VB->AttribPtr[_TNL_ATTRIB_NORMAL] = normal;
+   VB->NormalPtr = normal;
 
    VB->NormalLengthPtr = NULL;	/* no longer valid */
    return GL_TRUE;
 }
 
 
+static GLboolean
+run_normal_stage(GLcontext *ctx, struct tnl_pipeline_stage *stage)
+{
+   return run_normal_chunk(ctx, stage, &TNL_CONTEXT(ctx)->vb);
+}
+
+
 /**
  * Examine current GL state and set the store->NormalTransform pointer
  * to point to the appropriate normal transformation routine.
@@ -185,5 +194,6 @@ const struct tnl_pipeline_stage _tnl_normal_transform_stage =
    alloc_normal_data,		/* create */
    free_normal_data,		/* destroy */
    validate_normal_stage,	/* validate */
-   run_normal_stage             /* run */
+   run_normal_stage,		/* run */
+   run_normal_chunk		/* run_chunk */
 };
@@ -31,6 +31,7 @@
 #include "main/imports.h"
 #include "t_context.h"
 #include "t_pipeline.h"
+#include "t_threads.h"
 
 
 struct point_stage_data {
@@ -47,18 +48,19 @@ struct point_stage_data {
  * disabled.
  */
 static GLboolean
-run_point_stage(GLcontext *ctx, struct tnl_pipeline_stage *stage)
+run_point_chunk(GLcontext *ctx, struct tnl_pipeline_stage *stage,
+                struct vertex_buffer *VB)
 {
    if (ctx->Point._Attenuated && !ctx->VertexProgram._Current) {
       struct point_stage_data *store = POINT_STAGE_DATA(stage);
-      struct vertex_buffer *VB = &TNL_CONTEXT(ctx)->vb;
+      GLvector4f *out = _tnl_vb_vector(VB, &store->PointSize);
       const GLfloat *eyeCoord = (GLfloat *) VB->EyePtr->data + 2;
       const GLint eyeCoordStride = VB->EyePtr->stride / sizeof(GLfloat);
       const GLfloat p0 = ctx->Point.Params[0];
       const GLfloat p1 = ctx->Point.Params[1];
       const GLfloat p2 = ctx->Point.Params[2];
       const GLfloat pointSize = ctx->Point.Size;
-      GLfloat (*size)[4] = store->PointSize.data;
+      GLfloat (*size)[4] = out->data;
       GLuint i;
 
       for (i = 0; i < VB->Count; i++) {
@@ -69,13 +71,20 @@ run_point_stage(GLcontext *ctx, struct tnl_pipeline_stage *stage)
          eyeCoord += eyeCoordStride;
       }
 
-      VB->AttribPtr[_TNL_ATTRIB_POINTSIZE] = &store->PointSize;
+      VB->AttribPtr[_TNL_ATTRIB_POINTSIZE] = out;
    }
 
    return GL_TRUE;
 }
 
 
+static GLboolean
+run_point_stage(GLcontext *ctx, struct tnl_pipeline_stage *stage)
+{
+   return run_point_chunk(ctx, stage, &TNL_CONTEXT(ctx)->vb);
+}
+
+
 static GLboolean
 alloc_point_data(GLcontext *ctx, struct tnl_pipeline_stage *stage)
 {
@@ -110,5 +119,6 @@ const struct tnl_pipeline_stage _tnl_point_attenuation_stage =
    alloc_point_data,		/* alloc data */
    free_point_data,		/* destructor */
    NULL,
-   run_point_stage		/* run */
+   run_point_stage,		/* run */
+   run_point_chunk		/* run_chunk */
 };
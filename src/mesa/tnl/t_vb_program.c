@@ -68,6 +68,13 @@ struct vp_stage_data {
    GLvector4f ndcCoords;              /**< normalized device coords */
    GLubyte *clipmask;                 /**< clip flags */
    GLubyte ormask, andmask;           /**< for clipping */
+
+   /** Can the current program be run on several vertices at once? */
+   GLboolean batchable;
+   /** State for running the program on several vertices at once */
+   struct gl_program_batch_machine *batch;
+   /** Cleaned-up input attributes of the current batch */
+   GLfloat batchInputs[VERT_ATTRIB_MAX][PROG_BATCH_SIZE][4];
 };
 
 
@@ -200,6 +207,21 @@ vp_fetch_texel(GLcontext *ctx, const GLfloat texcoord[4], GLfloat lambda,
 }
 
 
+/**
+ * Fetch texels for a batch of vertices.
+ * Called via gl_program_batch_machine::FetchTexelsLod().
+ */
+static void
+vp_fetch_texels(GLcontext *ctx, GLuint n, const GLfloat texcoord[][4],
+                const GLfloat lambda[], GLuint unit, GLfloat color[][4])
+{
+   SWcontext *swrast = SWRAST_CONTEXT(ctx);
+
+   swrast->TextureSample[unit](ctx, ctx->Texture.Unit[unit]._Current,
+                               n, texcoord, lambda, color);
+}
+
+
 /**
  * Called via ctx->Driver.ProgramStringNotify() after a new vertex program
  * string has been parsed.
@@ -301,6 +323,67 @@ unmap_textures(GLcontext *ctx, const struct gl_vertex_program *vp)
 }
 
 
+/**
+ * Execute the vertex program on all the vertices in the VB,
+ * PROG_BATCH_SIZE vertices at a time.  Only used for programs accepted
+ * by _mesa_program_batchable(); the results must match the per-vertex
+ * loop in run_vp().
+ */
+static void
+run_vp_batched(GLcontext *ctx, struct vp_stage_data *store,
+               const struct gl_vertex_program *program,
+               const GLuint outputs[], GLuint numOutputs)
+{
+   TNLcontext *tnl = TNL_CONTEXT(ctx);
+   struct vertex_buffer *VB = &tnl->vb;
+   struct gl_program_batch_machine *machine = store->batch;
+   GLuint attr, i, j, k;
+
+   machine->NumInputs = VERT_ATTRIB_MAX;
+   machine->NumDeriv = 0;
+   machine->Samplers = program->Base.SamplerUnits;
+   machine->FetchTexelsLod = vp_fetch_texels;
+   machine->FetchTexelsDeriv = NULL; /* not used by vertex programs */
+
+   for (attr = 0; attr < VERT_ATTRIB_MAX; attr++) {
+      if (program->Base.InputsRead & (1 << attr))
+         machine->Inputs[attr] =
+            (const GLfloat (*)[4]) store->batchInputs[attr];
+      else
+         machine->Inputs[attr] = NULL;
+   }
+
+   for (i = 0; i < VB->Count; i += PROG_BATCH_SIZE) {
+      const GLuint n = MIN2(PROG_BATCH_SIZE, VB->Count - i);
+
+      /* the vertex array case */
+      for (attr = 0; attr < VERT_ATTRIB_MAX; attr++) {
+	 if (program->Base.InputsRead & (1 << attr)) {
+	    const GLubyte *ptr = (const GLubyte*) VB->AttribPtr[attr]->data;
+	    const GLuint size = VB->AttribPtr[attr]->size;
+	    const GLuint stride = VB->AttribPtr[attr]->stride;
+            for (k = 0; k < n; k++) {
+               const GLfloat *data = (GLfloat *) (ptr + stride * (i + k));
+               COPY_CLEAN_4V(store->batchInputs[attr][k], size, data);
+            }
+	 }
+      }
+
+      /* execute the program */
+      _mesa_execute_program_batch(ctx, &program->Base, machine, n);
+
+      /* copy the output registers into the VB->attribs arrays */
+      for (j = 0; j < numOutputs; j++) {
+         const GLuint attr = outputs[j];
+         for (k = 0; k < n; k++) {
+            COPY_4V(store->results[attr].data[i + k],
+                    machine->Outputs[attr][k]);
+         }
+      }
+   }
+}
+
+
 /**
  * This function executes vertex programs
  */
@@ -336,7 +419,10 @@ run_vp( GLcontext *ctx, struct tnl_pipeline_stage *stage )
 
    map_textures(ctx, program);
 
-   for (i = 0; i < VB->Count; i++) {
+   if (store->batchable && store->batch) {
+      run_vp_batched(ctx, store, program, outputs, numOutputs);
+   }
+   else for (i = 0; i < VB->Count; i++) {
       GLuint attr;
 
       init_machine(ctx, &machine);
@@ -514,6 +600,11 @@ init_vp(GLcontext *ctx, struct tnl_pipeline_stage *stage)
    _mesa_vector4f_alloc( &store->ndcCoords, 0, size, 32 );
    store->clipmask = (GLubyte *) ALIGN_MALLOC(sizeof(GLubyte)*size, 32 );
 
+   /* batched execution is optional, so don't fail if this doesn't work */
+   store->batch = (struct gl_program_batch_machine *)
+      MALLOC(sizeof(struct gl_program_batch_machine));
+   store->batchable = GL_FALSE;
+
    return GL_TRUE;
 }
 
@@ -536,6 +627,8 @@ dtr(struct tnl_pipeline_stage *stage)
       /* free misc arrays */
       _mesa_vector4f_free( &store->ndcCoords );
       ALIGN_FREE( store->clipmask );
+      if (store->batch)
+         FREE( store->batch );
 
       FREE( store );
       stage->privatePtr = NULL;
@@ -543,12 +636,41 @@ dtr(struct tnl_pipeline_stage *stage)
 }
 
 
+/**
+ * Without a vertex program this stage does nothing, so the fixed
+ * function stages after it can still be run on chunks.
+ */
+static GLboolean
+run_vp_chunk( GLcontext *ctx, struct tnl_pipeline_stage *stage,
+              struct vertex_buffer *VB )
+{
+   (void) ctx;
+   (void) stage;
+   (void) VB;
+   return GL_TRUE;
+}
+
+
 static void
 validate_vp_stage(GLcontext *ctx, struct tnl_pipeline_stage *stage)
 {
-   if (ctx->VertexProgram._Current) {
+   struct vp_stage_data *store = VP_STAGE_DATA(stage);
+   const struct gl_vertex_program *program = ctx->VertexProgram._Current;
+
+   if (program) {
       _swrast_update_texture_samplers(ctx);
    }
+
+   stage->run_chunk = program ? NULL : run_vp_chunk;
+
+   if (store) {
+      /* NV programs expect registers to be reset per vertex, which the
+       * batched path doesn't do.
+       */
+      store->batchable = program &&
+                         !program->IsNVProgram &&
+                         _mesa_program_batchable(&program->Base);
+   }
 }
 
 
@@ -563,5 +685,6 @@ const struct tnl_pipeline_stage _tnl_vertex_program_stage =
    init_vp,			/* create */
    dtr,				/* destroy */
    validate_vp_stage, 		/* validate */
-   run_vp			/* run -- initially set to ctr */
+   run_vp,			/* run -- initially set to ctr */
+   run_vp_chunk			/* run_chunk */
 };
@@ -46,6 +46,7 @@
 
 #include "t_context.h"
 #include "t_pipeline.h"
+#include "t_threads.h"
 
 
 /***********************************************************************
@@ -56,6 +57,7 @@
 struct texgen_stage_data;
 
 typedef void (*texgen_func)( GLcontext *ctx,
+			     struct vertex_buffer *VB,
 			     struct texgen_stage_data *store,
 			     GLuint unit);
 
@@ -67,7 +69,7 @@ struct texgen_stage_data {
    GLuint TexgenSize[MAX_TEXTURE_COORD_UNITS];
    texgen_func TexgenFunc[MAX_TEXTURE_COORD_UNITS];
 
-   /* Temporary values used in texgen.
+   /* Temporary values used in texgen, indexed by vertex.
     */
    GLfloat (*tmp_f)[3];
    GLfloat *tmp_m;
@@ -250,12 +252,12 @@ static build_f_func build_f_tab[5] = {
 /* Special case texgen functions.
  */
 static void texgen_reflection_map_nv( GLcontext *ctx,
+				      struct vertex_buffer *VB,
 				      struct texgen_stage_data *store,
 				      GLuint unit )
 {
-   struct vertex_buffer *VB = &TNL_CONTEXT(ctx)->vb;
    GLvector4f *in = VB->AttribPtr[VERT_ATTRIB_TEX0 + unit];
-   GLvector4f *out = &store->texcoord[unit];
+   GLvector4f *out = _tnl_vb_vector(VB, &store->texcoord[unit]);
 
    build_f_tab[VB->EyePtr->size]( out->start,
 				  out->stride,
@@ -272,12 +274,12 @@ static void texgen_reflection_map_nv( GLcontext *ctx,
 
 
 static void texgen_normal_map_nv( GLcontext *ctx,
+				  struct vertex_buffer *VB,
 				  struct texgen_stage_data *store,
 				  GLuint unit )
 {
-   struct vertex_buffer *VB = &TNL_CONTEXT(ctx)->vb;
    GLvector4f *in = VB->AttribPtr[VERT_ATTRIB_TEX0 + unit];
-   GLvector4f *out = &store->texcoord[unit];
+   GLvector4f *out = _tnl_vb_vector(VB, &store->texcoord[unit]);
    GLvector4f *normal = VB->AttribPtr[_TNL_ATTRIB_NORMAL];
    GLfloat (*texcoord)[4] = (GLfloat (*)[4])out->start;
    GLuint count = VB->Count;
@@ -300,20 +302,20 @@ static void texgen_normal_map_nv( GLcontext *ctx,
 
 
 static void texgen_sphere_map( GLcontext *ctx,
+			       struct vertex_buffer *VB,
 			       struct texgen_stage_data *store,
 			       GLuint unit )
 {
-   struct vertex_buffer *VB = &TNL_CONTEXT(ctx)->vb;
    GLvector4f *in = VB->AttribPtr[VERT_ATTRIB_TEX0 + unit];
-   GLvector4f *out = &store->texcoord[unit];
+   GLvector4f *out = _tnl_vb_vector(VB, &store->texcoord[unit]);
    GLfloat (*texcoord)[4] = (GLfloat (*)[4]) out->start;
    GLuint count = VB->Count;
    GLuint i;
-   GLfloat (*f)[3] = store->tmp_f;
-   GLfloat *m = store->tmp_m;
+   GLfloat (*f)[3] = store->tmp_f + VB->Start;
+   GLfloat *m = store->tmp_m + VB->Start;
 
-   (build_m_tab[VB->EyePtr->size])( store->tmp_f,
-				    store->tmp_m,
+   (build_m_tab[VB->EyePtr->size])( f,
+				    m,
 				    VB->AttribPtr[_TNL_ATTRIB_NORMAL],
 				    VB->EyePtr );
 
@@ -333,27 +335,26 @@ static void texgen_sphere_map( GLcontext *ctx,
 
 
 static void texgen( GLcontext *ctx,
+		    struct vertex_buffer *VB,
 		    struct texgen_stage_data *store,
 		    GLuint unit )
 {
-   TNLcontext *tnl = TNL_CONTEXT(ctx);
-   struct vertex_buffer *VB = &tnl->vb;
    GLvector4f *in = VB->AttribPtr[VERT_ATTRIB_TEX0 + unit];
-   GLvector4f *out = &store->texcoord[unit];
+   GLvector4f *out = _tnl_vb_vector(VB, &store->texcoord[unit]);
    const struct gl_texture_unit *texUnit = &ctx->Texture.Unit[unit];
    const GLvector4f *obj = VB->ObjPtr;
    const GLvector4f *eye = VB->EyePtr;
    const GLvector4f *normal = VB->AttribPtr[_TNL_ATTRIB_NORMAL];
-   const GLfloat *m = store->tmp_m;
+   GLfloat *m = store->tmp_m + VB->Start;
    const GLuint count = VB->Count;
    GLfloat (*texcoord)[4] = (GLfloat (*)[4])out->data;
-   GLfloat (*f)[3] = store->tmp_f;
+   GLfloat (*f)[3] = store->tmp_f + VB->Start;
    GLuint copy;
 
    if (texUnit->_GenFlags & TEXGEN_NEED_M) {
-      build_m_tab[eye->size]( store->tmp_f, store->tmp_m, normal, eye );
+      build_m_tab[eye->size]( f, m, normal, eye );
    } else if (texUnit->_GenFlags & TEXGEN_NEED_F) {
-      build_f_tab[eye->size]( (GLfloat *)store->tmp_f, 3, normal, eye );
+      build_f_tab[eye->size]( (GLfloat *)f, 3, normal, eye );
    }
 
 
@@ -481,10 +482,10 @@ static void texgen( GLcontext *ctx,
 
 
 
-static GLboolean run_texgen_stage( GLcontext *ctx,
-				   struct tnl_pipeline_stage *stage )
+static GLboolean run_texgen_chunk( GLcontext *ctx,
+				   struct tnl_pipeline_stage *stage,
+				   struct vertex_buffer *VB )
 {
-   struct vertex_buffer *VB = &TNL_CONTEXT(ctx)->vb;
    struct texgen_stage_data *store = TEXGEN_STAGE_DATA(stage);
    GLuint i;
 
@@ -496,10 +497,11 @@ static GLboolean run_texgen_stage( GLcontext *ctx,
 
       if (texUnit->TexGenEnabled) {
 
-	 store->TexgenFunc[i]( ctx, store, i );
+	 store->TexgenFunc[i]( ctx, VB, store, i );
 
          VB->TexCoordPtr[i] =
-         VB->AttribPtr[VERT_ATTRIB_TEX0 + i] = &store->texcoord[i];
+         VB->AttribPtr[VERT_ATTRIB_TEX0 + i] =
+            _tnl_vb_vector(VB, &store->texcoord[i]);
       }
    }
 
@@ -507,6 +509,13 @@ static GLboolean run_texgen_stage( GLcontext *ctx,
 }
 
 
+static GLboolean run_texgen_stage( GLcontext *ctx,
+				   struct tnl_pipeline_stage *stage )
+{
+   return run_texgen_chunk( ctx, stage, &TNL_CONTEXT(ctx)->vb );
+}
+
+
 static void validate_texgen_stage( GLcontext *ctx,
 				   struct tnl_pipeline_stage *stage )
 {
@@ -607,5 +616,6 @@ const struct tnl_pipeline_stage _tnl_texgen_stage =
    alloc_texgen_data,		/* destructor */
    free_texgen_data,		/* destructor */
    validate_texgen_stage,		/* check */
-   run_texgen_stage		/* run -- initially set to alloc data */
+   run_texgen_stage,		/* run -- initially set to alloc data */
+   run_texgen_chunk		/* run_chunk */
 };
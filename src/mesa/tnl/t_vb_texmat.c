@@ -37,6 +37,7 @@
 
 #include "t_context.h"
 #include "t_pipeline.h"
+#include "t_threads.h"
 
 /* Is there any real benefit seperating texmat from texgen?  It means
  * we need two lots of intermediate storage.  Any changes to
@@ -54,11 +55,11 @@ struct texmat_stage_data {
 
 
 
-static GLboolean run_texmat_stage( GLcontext *ctx,
-				   struct tnl_pipeline_stage *stage )
+static GLboolean run_texmat_chunk( GLcontext *ctx,
+				   struct tnl_pipeline_stage *stage,
+				   struct vertex_buffer *VB )
 {
    struct texmat_stage_data *store = TEXMAT_STAGE_DATA(stage);
-   struct vertex_buffer *VB = &TNL_CONTEXT(ctx)->vb;
    GLuint i;
 
    if (!ctx->Texture._TexMatEnabled || ctx->VertexProgram._Current) 
@@ -69,12 +70,14 @@ static GLboolean run_texmat_stage( GLcontext *ctx,
     */
    for (i = 0 ; i < ctx->Const.MaxTextureCoordUnits ; i++) {
       if (ctx->Texture._TexMatEnabled & ENABLE_TEXMAT(i)) {
-	 (void) TransformRaw( &store->texcoord[i],
+	 GLvector4f *out = _tnl_vb_vector(VB, &store->texcoord[i]);
+
+	 (void) TransformRaw( out,
 			      ctx->TextureMatrixStack[i].Top,
 			      VB->AttribPtr[_TNL_ATTRIB_TEX0 + i]);
 
          VB->TexCoordPtr[i] = 
-	 VB->AttribPtr[VERT_ATTRIB_TEX0+i] = &store->texcoord[i];
+	 VB->AttribPtr[VERT_ATTRIB_TEX0+i] = out;
       }
    }
 
@@ -82,6 +85,13 @@ static GLboolean run_texmat_stage( GLcontext *ctx,
 }
 
 
+static GLboolean run_texmat_stage( GLcontext *ctx,
+				   struct tnl_pipeline_stage *stage )
+{
+   return run_texmat_chunk( ctx, stage, &TNL_CONTEXT(ctx)->vb );
+}
+
+
 /* Called the first time stage->run() is invoked.
  */
 static GLboolean alloc_texmat_data( GLcontext *ctx,
@@ -127,4 +137,5 @@ const struct tnl_pipeline_stage _tnl_texture_transform_stage =
    free_texmat_data,			/* destructor */
    NULL,
    run_texmat_stage,
+   run_texmat_chunk,
 };
@@ -37,6 +37,7 @@
 
 #include "t_context.h"
 #include "t_pipeline.h"
+#include "t_threads.h"
 
 
 
@@ -45,8 +46,6 @@ struct vertex_stage_data {
    GLvector4f clip;
    GLvector4f proj;
    GLubyte *clipmask;
-   GLubyte ormask;
-   GLubyte andmask;
 };
 
 #define VERTEX_STAGE_DATA(stage) ((struct vertex_stage_data *)stage->privatePtr)
@@ -135,18 +134,18 @@ tnl_clip_prepare(GLcontext *ctx)
 
 
 
-static GLboolean run_vertex_stage( GLcontext *ctx,
-				   struct tnl_pipeline_stage *stage )
+static GLboolean run_vertex_chunk( GLcontext *ctx,
+				   struct tnl_pipeline_stage *stage,
+				   struct vertex_buffer *VB )
 {
    struct vertex_stage_data *store = (struct vertex_stage_data *)stage->privatePtr;
    TNLcontext *tnl = TNL_CONTEXT(ctx);
-   struct vertex_buffer *VB = &tnl->vb;
+   GLubyte *clipmask = store->clipmask + VB->Start;
+   GLubyte ormask, andmask;
 
    if (ctx->VertexProgram._Current) 
       return GL_TRUE;
 
-   tnl_clip_prepare(ctx);
-
    if (ctx->_NeedEyeCoords) {
       /* Separate modelview transformation:
        * Use combined ModelProject to avoid some depth artifacts
@@ -154,12 +153,12 @@ static GLboolean run_vertex_stage( GLcontext *ctx,
       if (ctx->ModelviewMatrixStack.Top->type == MATRIX_IDENTITY)
 	 VB->EyePtr = VB->ObjPtr;
       else
-	 VB->EyePtr = TransformRaw( &store->eye,
+	 VB->EyePtr = TransformRaw( _tnl_vb_vector(VB, &store->eye),
 				    ctx->ModelviewMatrixStack.Top,
 				    VB->ObjPtr);
    }
 
-   VB->ClipPtr = TransformRaw( &store->clip,
+   VB->ClipPtr = TransformRaw( _tnl_vb_vector(VB, &store->clip),
 			       &ctx->_ModelProjectMatrix,
 			       VB->ObjPtr );
 
@@ -182,29 +181,32 @@ static GLboolean run_vertex_stage( GLcontext *ctx,
    /* Cliptest and perspective divide.  Clip functions must clear
     * the clipmask.
     */
-   store->ormask = 0;
-   store->andmask = CLIP_FRUSTUM_BITS;
+   ormask = 0;
+   andmask = CLIP_FRUSTUM_BITS;
 
    if (tnl->NeedNdcCoords) {
       VB->NdcPtr =
 	 _mesa_clip_tab[VB->ClipPtr->size]( VB->ClipPtr,
-					    &store->proj,
-					    store->clipmask,
-					    &store->ormask,
-					    &store->andmask,
+					    _tnl_vb_vector(VB, &store->proj),
+					    clipmask,
+					    &ormask,
+					    &andmask,
 					    !ctx->Transform.DepthClamp );
    }
    else {
       VB->NdcPtr = NULL;
       _mesa_clip_np_tab[VB->ClipPtr->size]( VB->ClipPtr,
 					    NULL,
-					    store->clipmask,
-					    &store->ormask,
-					    &store->andmask,
+					    clipmask,
+					    &ormask,
+					    &andmask,
 					    !ctx->Transform.DepthClamp );
    }
 
-   if (store->andmask)
+   /* A chunk carries on, as the rest of the vertex buffer may still
+    * need the user clip bits of its vertices.
+    */
+   if (andmask && !VB->Chunk)
       return GL_FALSE;
 
 
@@ -214,19 +216,35 @@ static GLboolean run_vertex_stage( GLcontext *ctx,
    if (ctx->Transform.ClipPlanesEnabled) {
       usercliptab[VB->ClipPtr->size]( ctx,
 				      VB->ClipPtr,
-				      store->clipmask,
-				      &store->ormask,
-				      &store->andmask );
+				      clipmask,
+				      &ormask,
+				      &andmask );
 
-      if (store->andmask)
+      if (andmask && !VB->Chunk)
 	 return GL_FALSE;
    }
 
-   VB->ClipAndMask = store->andmask;
-   VB->ClipOrMask = store->ormask;
-   VB->ClipMask = store->clipmask;
+   VB->ClipAndMask = andmask;
+   VB->ClipOrMask = ormask;
+   VB->ClipMask = clipmask;
 
-   return GL_TRUE;
+   return andmask ? GL_FALSE : GL_TRUE;
+}
+
+
+static GLboolean run_vertex_stage( GLcontext *ctx,
+				   struct tnl_pipeline_stage *stage )
+{
+   return run_vertex_chunk( ctx, stage, &TNL_CONTEXT(ctx)->vb );
+}
+
+
+static void validate_vertex_stage( GLcontext *ctx,
+				   struct tnl_pipeline_stage *stage )
+{
+   tnl_clip_prepare(ctx);
+
+   stage->run_chunk = ctx->VertexProgram._Current ? NULL : run_vertex_chunk;
 }
 
 
@@ -279,6 +297,7 @@ const struct tnl_pipeline_stage _tnl_vertex_transform_stage =
    NULL,			/* private data */
    init_vertex_stage,
    dtr,				/* destructor */
-   NULL,
-   run_vertex_stage		/* run -- initially set to init */
+   validate_vertex_stage,	/* validate */
+   run_vertex_stage,		/* run -- initially set to init */
+   run_vertex_chunk		/* run_chunk */
 };
@@ -92,6 +92,48 @@ void vbo_exec_invalidate_state( GLcontext *ctx, GLuint new_state )
 }
 
 
+/**
+ * Append prim to prev, the primitive before it in the same vertex
+ * buffer, if the two can be drawn as one: lists of independent points,
+ * lines, triangles or quads whose vertices are adjacent, where prev
+ * holds whole primitives only.  Consecutive glBegin/glEnd pairs always
+ * share their state, as state changes flush the vertices first.
+ *
+ * \return GL_TRUE if prim was merged into prev.
+ */
+GLboolean vbo_merge_prims( struct _mesa_prim *prev,
+                           const struct _mesa_prim *prim )
+{
+   GLuint verts;
+
+   if (prev->mode != prim->mode ||
+       !prev->end || !prim->begin ||
+       prev->weak || prim->weak ||
+       prev->indexed || prim->indexed ||
+       prev->start + prev->count != prim->start)
+      return GL_FALSE;
+
+   switch (prim->mode) {
+   case GL_POINTS:
+      verts = 1;
+      break;
+   case GL_LINES:
+      verts = 2;
+      break;
+   case GL_TRIANGLES:
+      verts = 3;
+      break;
+   case GL_QUADS:
+      verts = 4;
+      break;
+   default:
+      return GL_FALSE;
+   }
 
+   if (prev->count % verts)
+      return GL_FALSE;
 
-
+   prev->count += prim->count;
+   prev->end = prim->end;
+   return GL_TRUE;
+}
@@ -43,7 +43,7 @@ USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 /* Wierd implementation stuff:
  */
-#define VBO_VERT_BUFFER_SIZE (1024*64)	/* bytes */
+#define VBO_VERT_BUFFER_SIZE (1024*256)	/* bytes */
 #define VBO_MAX_ATTR_CODEGEN 16 
 #define ERROR_ATTRIB 16
 
@@ -194,4 +194,7 @@ void vbo_exec_do_EvalCoord1f( struct vbo_exec_context *exec,
 extern GLboolean 
 vbo_validate_shaders(GLcontext *ctx);
 
+GLboolean vbo_merge_prims( struct _mesa_prim *prev,
+                           const struct _mesa_prim *prim );
+
 #endif
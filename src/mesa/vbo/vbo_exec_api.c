@@ -544,6 +544,11 @@ static void GLAPIENTRY vbo_exec_End( void )
       exec->vtx.prim[i].end = 1; 
       exec->vtx.prim[i].count = idx - exec->vtx.prim[i].start;
 
+      /* Draw runs of glBegin/glEnd pairs as a single primitive.
+       */
+      if (i > 0 && vbo_merge_prims(&exec->vtx.prim[i-1], &exec->vtx.prim[i]))
+	 exec->vtx.prim_count--;
+
       ctx->Driver.CurrentExecPrimitive = PRIM_OUTSIDE_BEGIN_END;
 
       if (exec->vtx.prim_count == VBO_MAX_PRIM)
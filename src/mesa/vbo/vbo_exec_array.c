@@ -34,6 +34,7 @@
 #include "main/varray.h"
 #include "main/bufferobj.h"
 #include "main/macros.h"
+#include "main/queryobj.h"
 #include "glapi/dispatch.h"
 
 #include "vbo_context.h"
@@ -41,6 +42,11 @@
 
 /**
  * Compute min and max elements for glDraw[Range]Elements() calls.
+ *
+ * The bounds of indices held in a buffer object are remembered with the
+ * buffer, keyed by offset, count and type, until its contents change.
+ * So a static element buffer drawn every frame is only scanned (and
+ * mapped) the first time.
  */
 void
 vbo_get_minmax_index(GLcontext *ctx,
@@ -51,12 +57,27 @@ vbo_get_minmax_index(GLcontext *ctx,
    GLuint i;
    GLsizei count = prim->count;
    const void *indices;
+   struct gl_index_range *range = NULL;
+   const GLvoid *map;
 
    if (_mesa_is_bufferobj(ib->obj)) {
-      const GLvoid *map = ctx->Driver.MapBuffer(ctx,
-                                                GL_ELEMENT_ARRAY_BUFFER_ARB,
-                                                GL_READ_ONLY,
-                                                ib->obj);
+      const GLintptr offset = (GLintptr) ib->ptr;
+
+      range = &ib->obj->IndexRanges[((offset >> 1) + count) %
+                                    MAX_INDEX_RANGES];
+      if (range->Stamp == ib->obj->WriteStamp &&
+          range->Offset == offset &&
+          range->Count == count &&
+          range->Type == ib->type) {
+         *min_index = range->Min;
+         *max_index = range->Max;
+         return;
+      }
+
+      map = ctx->Driver.MapBuffer(ctx,
+                                  GL_ELEMENT_ARRAY_BUFFER_ARB,
+                                  GL_READ_ONLY,
+                                  ib->obj);
       indices = ADD_POINTERS(map, ib->ptr);
    } else {
       indices = ib->ptr;
@@ -108,6 +129,13 @@ vbo_get_minmax_index(GLcontext *ctx,
       ctx->Driver.UnmapBuffer(ctx,
 			      GL_ELEMENT_ARRAY_BUFFER_ARB,
 			      ib->obj);
+
+      range->Offset = (GLintptr) ib->ptr;
+      range->Count = count;
+      range->Type = ib->type;
+      range->Stamp = ib->obj->WriteStamp;
+      range->Min = *min_index;
+      range->Max = *max_index;
    }
 }
 
@@ -494,6 +522,9 @@ vbo_exec_DrawArrays(GLenum mode, GLint start, GLsizei count)
       return;
    }
 
+   if (!_mesa_check_conditional_render(ctx))
+      return;
+
 #if 0
    check_draw_arrays_data(ctx, start, count);
 #else
@@ -610,6 +641,9 @@ vbo_validated_drawrangeelements(GLcontext *ctx, GLenum mode,
       return;
    }
 
+   if (!_mesa_check_conditional_render(ctx))
+      return;
+
    if (ctx->NewState)
       _mesa_update_state( ctx );
 
@@ -781,6 +815,9 @@ vbo_validated_multidrawelements(GLcontext *ctx, GLenum mode,
       return;
    }
 
+   if (!_mesa_check_conditional_render(ctx))
+      return;
+
    if (ctx->NewState)
       _mesa_update_state( ctx );
 
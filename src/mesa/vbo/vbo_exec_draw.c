@@ -31,6 +31,7 @@
 #include "main/enums.h"
 #include "main/state.h"
 #include "main/macros.h"
+#include "main/queryobj.h"
 
 #include "vbo_context.h"
 
@@ -378,14 +379,15 @@ vbo_exec_vtx_flush( struct vbo_exec_context *exec, GLboolean unmap )
             _mesa_printf("%s %d %d\n", __FUNCTION__, exec->vtx.prim_count,
                          exec->vtx.vert_count);
 
-	 vbo_context(ctx)->draw_prims( ctx, 
-				       exec->vtx.inputs, 
-				       exec->vtx.prim, 
-				       exec->vtx.prim_count,
-				       NULL,
-				       GL_TRUE,
-				       0,
-				       exec->vtx.vert_count - 1);
+         if (_mesa_check_conditional_render(ctx))
+            vbo_context(ctx)->draw_prims( ctx, 
+                                          exec->vtx.inputs, 
+                                          exec->vtx.prim, 
+                                          exec->vtx.prim_count,
+                                          NULL,
+                                          GL_TRUE,
+                                          0,
+                                          exec->vtx.vert_count - 1);
 
 	 /* If using a real VBO, get new storage -- unless asked not to.
           */
@@ -792,6 +792,11 @@ static void GLAPIENTRY _save_End( void )
    save->prim[i].count = (save->vert_count - 
 			  save->prim[i].start);
 
+   if (i > 0 && vbo_merge_prims(&save->prim[i-1], &save->prim[i])) {
+      save->prim_count--;
+      i--;
+   }
+
    if (i == (GLint) save->prim_max - 1) {
       _save_compile_vertex_list( ctx );
       assert(save->copied.nr == 0);
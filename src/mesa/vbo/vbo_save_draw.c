@@ -34,6 +34,7 @@
 #include "main/macros.h"
 #include "main/light.h"
 #include "main/state.h"
+#include "main/queryobj.h"
 
 #include "vbo_context.h"
 
@@ -274,14 +275,15 @@ void vbo_save_playback_vertex_list( GLcontext *ctx, void *data )
       if (ctx->NewState)
 	 _mesa_update_state( ctx );
 
-      vbo_context(ctx)->draw_prims( ctx, 
-				    save->inputs, 
-				    node->prim, 
-				    node->prim_count,
-				    NULL,
-				    GL_TRUE,
-				    0,	/* Node is a VBO, so this is ok */
-				    node->count - 1);
+      if (_mesa_check_conditional_render(ctx))
+         vbo_context(ctx)->draw_prims( ctx, 
+                                       save->inputs, 
+                                       node->prim, 
+                                       node->prim_count,
+                                       NULL,
+                                       GL_TRUE,
+                                       0,	/* Node is a VBO, so this is ok */
+                                       node->count - 1);
    }
 
    /* Copy to current?
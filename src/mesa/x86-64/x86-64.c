@@ -43,9 +43,61 @@
 
 extern void _mesa_x86_64_cpuid(unsigned int *regs);
 
-DECLARE_XFORM_GROUP( x86_64, 4 )
+/* Only the entries which beat the (vectorized) C code have SSE versions.
+ */
+extern void _mesa_x86_64_transform_points1_general( XFORM_ARGS );
+extern void _mesa_x86_64_transform_points1_2d( XFORM_ARGS );
+extern void _mesa_x86_64_transform_points1_2d_no_rot( XFORM_ARGS );
+extern void _mesa_x86_64_transform_points1_3d( XFORM_ARGS );
+
+extern void _mesa_x86_64_transform_points2_general( XFORM_ARGS );
+extern void _mesa_x86_64_transform_points2_3d( XFORM_ARGS );
+
+extern void _mesa_x86_64_transform_points3_general( XFORM_ARGS );
+extern void _mesa_x86_64_transform_points3_identity( XFORM_ARGS );
+extern void _mesa_x86_64_transform_points3_3d_no_rot( XFORM_ARGS );
+extern void _mesa_x86_64_transform_points3_3d( XFORM_ARGS );
+
+extern void _mesa_x86_64_transform_points4_general( XFORM_ARGS );
+extern void _mesa_x86_64_transform_points4_identity( XFORM_ARGS );
+extern void _mesa_x86_64_transform_points4_perspective( XFORM_ARGS );
+extern void _mesa_x86_64_transform_points4_3d_no_rot( XFORM_ARGS );
+extern void _mesa_x86_64_transform_points4_3d( XFORM_ARGS );
+
 DECLARE_XFORM_GROUP( 3dnow, 4 )
 
+extern GLvector4f *
+_mesa_x86_64_cliptest_points4( GLvector4f *clip_vec,
+                               GLvector4f *proj_vec,
+                               GLubyte clipMask[],
+                               GLubyte *orMask,
+                               GLubyte *andMask,
+                               GLboolean viewport_z_clip );
+
+extern GLvector4f *
+_mesa_x86_64_cliptest_points4_np( GLvector4f *clip_vec,
+                                  GLvector4f *proj_vec,
+                                  GLubyte clipMask[],
+                                  GLubyte *orMask,
+                                  GLubyte *andMask,
+                                  GLboolean viewport_z_clip );
+
+extern GLvector4f *
+_mesa_x86_64_cliptest_points3( GLvector4f *clip_vec,
+                               GLvector4f *proj_vec,
+                               GLubyte clipMask[],
+                               GLubyte *orMask,
+                               GLubyte *andMask,
+                               GLboolean viewport_z_clip );
+
+extern void _mesa_x86_64_transform_normals( NORM_ARGS );
+extern void _mesa_x86_64_transform_normals_no_rot( NORM_ARGS );
+extern void _mesa_x86_64_transform_rescale_normals( NORM_ARGS );
+extern void _mesa_x86_64_transform_rescale_normals_no_rot( NORM_ARGS );
+extern void _mesa_x86_64_transform_normalize_normals( NORM_ARGS );
+extern void _mesa_x86_64_transform_normalize_normals_no_rot( NORM_ARGS );
+extern void _mesa_x86_64_rescale_normals( NORM_ARGS );
+
 #else
 /* just to silence warning below */
 #include "x86-64.h"
@@ -93,13 +145,64 @@ void _mesa_init_all_x86_64_transform_asm(void)
    message("Initializing x86-64 optimizations\n");
 
 
+   _mesa_transform_tab[1][MATRIX_GENERAL] =
+      _mesa_x86_64_transform_points1_general;
+   _mesa_transform_tab[1][MATRIX_PERSPECTIVE] =
+      _mesa_x86_64_transform_points1_general;
+   _mesa_transform_tab[1][MATRIX_2D] =
+      _mesa_x86_64_transform_points1_2d;
+   _mesa_transform_tab[1][MATRIX_2D_NO_ROT] =
+      _mesa_x86_64_transform_points1_2d_no_rot;
+   _mesa_transform_tab[1][MATRIX_3D] =
+      _mesa_x86_64_transform_points1_3d;
+
+   _mesa_transform_tab[2][MATRIX_GENERAL] =
+      _mesa_x86_64_transform_points2_general;
+   _mesa_transform_tab[2][MATRIX_3D] =
+      _mesa_x86_64_transform_points2_3d;
+
+   _mesa_transform_tab[3][MATRIX_GENERAL] =
+      _mesa_x86_64_transform_points3_general;
+   _mesa_transform_tab[3][MATRIX_IDENTITY] =
+      _mesa_x86_64_transform_points3_identity;
+   _mesa_transform_tab[3][MATRIX_PERSPECTIVE] =
+      _mesa_x86_64_transform_points3_general;
+   _mesa_transform_tab[3][MATRIX_3D_NO_ROT] =
+      _mesa_x86_64_transform_points3_3d_no_rot;
+   _mesa_transform_tab[3][MATRIX_3D] =
+      _mesa_x86_64_transform_points3_3d;
+
    _mesa_transform_tab[4][MATRIX_GENERAL] =
       _mesa_x86_64_transform_points4_general;
    _mesa_transform_tab[4][MATRIX_IDENTITY] =
       _mesa_x86_64_transform_points4_identity;
+   _mesa_transform_tab[4][MATRIX_PERSPECTIVE] =
+      _mesa_x86_64_transform_points4_perspective;
+   _mesa_transform_tab[4][MATRIX_3D_NO_ROT] =
+      _mesa_x86_64_transform_points4_3d_no_rot;
    _mesa_transform_tab[4][MATRIX_3D] =
       _mesa_x86_64_transform_points4_3d;
 
+   _mesa_clip_tab[4] = _mesa_x86_64_cliptest_points4;
+   _mesa_clip_np_tab[4] = _mesa_x86_64_cliptest_points4_np;
+   _mesa_clip_tab[3] = _mesa_x86_64_cliptest_points3;
+   _mesa_clip_np_tab[3] = _mesa_x86_64_cliptest_points3;
+
+   _mesa_normal_tab[NORM_TRANSFORM] =
+      _mesa_x86_64_transform_normals;
+   _mesa_normal_tab[NORM_TRANSFORM_NO_ROT] =
+      _mesa_x86_64_transform_normals_no_rot;
+   _mesa_normal_tab[NORM_TRANSFORM | NORM_RESCALE] =
+      _mesa_x86_64_transform_rescale_normals;
+   _mesa_normal_tab[NORM_TRANSFORM_NO_ROT | NORM_RESCALE] =
+      _mesa_x86_64_transform_rescale_normals_no_rot;
+   _mesa_normal_tab[NORM_TRANSFORM | NORM_NORMALIZE] =
+      _mesa_x86_64_transform_normalize_normals;
+   _mesa_normal_tab[NORM_TRANSFORM_NO_ROT | NORM_NORMALIZE] =
+      _mesa_x86_64_transform_normalize_normals_no_rot;
+   _mesa_normal_tab[NORM_RESCALE] =
+      _mesa_x86_64_rescale_normals;
+
    regs[0] = 0x80000001;
    regs[1] = 0x00000000;
    regs[2] = 0x00000000;